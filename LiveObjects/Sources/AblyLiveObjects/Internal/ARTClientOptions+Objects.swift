@@ -1,5 +1,6 @@
 internal import _AblyPluginSupportPrivate
 import Ably
+import Foundation
 
 @available(macOS 11.0, iOS 14.0, tvOS 14.0, *)
 internal extension ARTClientOptions {
@@ -44,4 +45,65 @@ internal extension ARTClientOptions {
             )
         }
     }
+
+    private static let updateCoalescingKey = "Objects.updateCoalescing"
+
+    /// Set through ``liveObjectsUpdateCoalescing``; `.disabled` until it's set.
+    var updateCoalescing: LiveObjectsUpdateCoalescing {
+        get {
+            let optionsValue = Plugin.defaultPluginAPI.pluginOptionsValue(
+                forKey: Self.updateCoalescingKey,
+                clientOptions: asPluginPublicClientOptions,
+            )
+
+            guard let optionsValue else {
+                return .disabled
+            }
+
+            guard let box = optionsValue as? Box<LiveObjectsUpdateCoalescing> else {
+                preconditionFailure("Expected UpdateCoalescingBox, got \(optionsValue)")
+            }
+
+            return box.boxed
+        }
+
+        set {
+            Plugin.defaultPluginAPI.setPluginOptionsValue(
+                Box<LiveObjectsUpdateCoalescing>(boxed: newValue),
+                forKey: Self.updateCoalescingKey,
+                clientOptions: asPluginPublicClientOptions,
+            )
+        }
+    }
+
+    private static let snapshotDirectoryKey = "Objects.snapshotDirectory"
+
+    /// Set through ``liveObjectsSnapshotDirectory``.
+    var snapshotDirectory: URL? {
+        get {
+            let optionsValue = Plugin.defaultPluginAPI.pluginOptionsValue(
+                forKey: Self.snapshotDirectoryKey,
+                clientOptions: asPluginPublicClientOptions,
+            )
+
+            guard let optionsValue else {
+                return nil
+            }
+
+            guard let box = optionsValue as? Box<URL?> else {
+                preconditionFailure("Expected SnapshotDirectoryBox, got \(optionsValue)")
+            }
+
+            return box.boxed
+        }
+
+        set {
+            // Boxing the optional lets a directory be un-set
+            Plugin.defaultPluginAPI.setPluginOptionsValue(
+                Box<URL?>(boxed: newValue),
+                forKey: Self.snapshotDirectoryKey,
+                clientOptions: asPluginPublicClientOptions,
+            )
+        }
+    }
 }
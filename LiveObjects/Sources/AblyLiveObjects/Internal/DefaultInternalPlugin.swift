@@ -66,8 +66,19 @@ internal final class DefaultInternalPlugin: NSObject, _AblyPluginSupportPrivate.
             clock: DefaultSimpleClock(),
             channelName: pluginAPI.name(for: channel),
             garbageCollectionOptions: garbageCollectionOptions,
+            updateCoalescing: options.updateCoalescing,
+            snapshotStore: options.snapshotDirectory.map { directoryURL in
+                // Weak, since the channel holds the store through its plugin data
+                .init(directoryURL: directoryURL, logger: logger) { [pluginAPI, weak channel, weak client] in
+                    guard let channel, let client, !pluginAPI.nosync_isEncryptedChannel(channel), let appID = pluginAPI.nosync_appId(for: client) else {
+                        return nil
+                    }
+                    return .init(appID: appID, clientID: pluginAPI.nosync_clientId(for: client))
+                }
+            },
         )
         pluginAPI.nosync_setPluginDataValue(liveObjects, forKey: Self.pluginDataKey, channel: channel)
+        liveObjects.nosync_warmStartFromSnapshot()
 
         // Seed the RTO20c1 siteCode from the latest connection details at engine creation, through the
         // same `nosync_setSiteCode` path that the CONNECTED `ProtocolMessage` handler
@@ -12,4 +12,11 @@ internal struct DefaultLiveCounterUpdate: LiveCounterUpdate, Equatable {
         self.objectMessage = objectMessage
         self.tombstone = tombstone
     }
+
+    /// The amounts add up; the message is the latest one's.
+    internal mutating func merge(_ later: Self) {
+        amount += later.amount
+        objectMessage = later.objectMessage
+        tombstone = tombstone || later.tombstone
+    }
 }
@@ -12,4 +12,11 @@ internal struct DefaultLiveMapUpdate: LiveMapUpdate, Equatable {
         self.objectMessage = objectMessage
         self.tombstone = tombstone
     }
+
+    /// A key's action is the latest one; the message is the latest one's.
+    internal mutating func merge(_ later: Self) {
+        update.merge(later.update) { _, laterAction in laterAction }
+        objectMessage = later.objectMessage
+        tombstone = tombstone || later.tombstone
+    }
 }
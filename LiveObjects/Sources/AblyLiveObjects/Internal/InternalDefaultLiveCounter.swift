@@ -15,6 +15,23 @@ internal final class InternalDefaultLiveCounter: Sendable {
     /// directly on the object and read without a queue hop.
     internal let objectID: String // internal for AblyLiveObjectsTesting
 
+    /// Incremented whenever the counter's data changes.
+    private let readVersion: ReadVersion
+
+    /// The ``ObjectsPool/readVersion`` of the pool that this counter is in, or `nil` if it isn't in one.
+    private let poolReadVersion: ReadVersion?
+
+    /// The counter's value as last read on the internal queue, which ``value(coreSDK:)`` returns
+    /// without dispatching to the queue for as long as neither `readVersion` nor `poolReadVersion`
+    /// has changed.
+    private let readSnapshot = LockedValue<ReadSnapshot?>(nil)
+
+    private struct ReadSnapshot {
+        var readVersion: UInt64
+        var poolReadVersion: UInt64
+        var value: Double
+    }
+
     // MARK: - Initialization
 
     internal init( // internal for AblyLiveObjectsTesting
@@ -23,12 +40,18 @@ internal final class InternalDefaultLiveCounter: Sendable {
         logger: Logger,
         internalQueue: DispatchQueue,
         userCallbackQueue: DispatchQueue,
-        clock: SimpleClock
+        clock: SimpleClock,
+        poolReadVersion: ReadVersion? = nil,
     ) {
         self.objectID = objectID
+        let readVersion = ReadVersion()
+        self.readVersion = readVersion
+        self.poolReadVersion = poolReadVersion
+        var liveObjectMutableState = LiveObjectMutableState<DefaultLiveCounterUpdate>(objectID: objectID)
+        liveObjectMutableState.poolReadVersion = poolReadVersion
         mutableStateMutex = .init(
             dispatchQueue: internalQueue,
-            initialValue: .init(liveObjectMutableState: .init(objectID: objectID), data: data),
+            initialValue: .init(liveObjectMutableState: liveObjectMutableState, data: data, readVersion: readVersion),
         )
         self.logger = logger
         self.userCallbackQueue = userCallbackQueue
@@ -39,12 +62,14 @@ internal final class InternalDefaultLiveCounter: Sendable {
     ///
     /// - Parameters:
     ///   - objectID: The value for the "private objectId field" of RTO5c1b1a.
+    ///   - poolReadVersion: The ``ObjectsPool/readVersion`` of the pool that the counter is being created for.
     internal static func createZeroValued(
         objectID: String,
         logger: Logger,
         internalQueue: DispatchQueue,
         userCallbackQueue: DispatchQueue,
         clock: SimpleClock,
+        poolReadVersion: ReadVersion? = nil,
     ) -> Self {
         .init(
             data: 0,
@@ -53,14 +78,28 @@ internal final class InternalDefaultLiveCounter: Sendable {
             internalQueue: internalQueue,
             userCallbackQueue: userCallbackQueue,
             clock: clock,
+            poolReadVersion: poolReadVersion,
         )
     }
 
     // MARK: - Internal methods that back LiveCounter conformance
 
     internal func value(coreSDK: CoreSDK) throws(ARTErrorInfo) -> Double {
-        try mutableStateMutex.withSync { mutableState throws(ARTErrorInfo) in
-            try mutableState.nosync_value(coreSDK: coreSDK)
+        if let poolReadVersion,
+           let readSnapshot = readSnapshot.load(),
+           readSnapshot.readVersion == readVersion.current,
+           readSnapshot.poolReadVersion == poolReadVersion.current {
+            return readSnapshot.value
+        }
+
+        return try mutableStateMutex.withSync { mutableState throws(ARTErrorInfo) in
+            let value = try mutableState.nosync_value(coreSDK: coreSDK)
+            // Only stored once the RTO25 check has passed; a channel state change that would make it
+            // fail increments poolReadVersion
+            if let poolReadVersion {
+                readSnapshot.store(.init(readVersion: readVersion.current, poolReadVersion: poolReadVersion.current, value: value))
+            }
+            return value
         }
     }
 
@@ -69,25 +108,12 @@ internal final class InternalDefaultLiveCounter: Sendable {
             do throws(ARTErrorInfo) {
                 try mutableStateMutex.withSync { mutableState throws(ARTErrorInfo) in
                     // RTLC12e1
-                    if !amount.isFinite {
-                        throw LiveObjectsError.counterIncrementAmountInvalid(amount: amount).toARTErrorInfo()
-                    }
+                    try Self.validateIncrementAmount(amount)
 
                     // RTO26
                     try coreSDK.nosync_validateChannelStateForWriteAPI(operationDescription: "LiveCounter.increment")
 
-                    let objectMessage = ProtocolTypes.OutboundObjectMessage(
-                        operation: .init(
-                            // RTLC12e2
-                            action: .known(.counterInc),
-                            // RTLC12e3
-                            objectId: mutableState.liveObjectMutableState.objectID,
-                            counterInc: .init(
-                                // RTLC12e5
-                                number: .init(value: amount),
-                            ),
-                        ),
-                    )
+                    let objectMessage = Self.counterIncMessage(objectID: mutableState.liveObjectMutableState.objectID, amount: amount)
 
                     // RTLC12g
                     realtimeObjects.nosync_publishAndApply(objectMessages: [objectMessage], coreSDK: coreSDK) { result in
@@ -105,6 +131,33 @@ internal final class InternalDefaultLiveCounter: Sendable {
         try await increment(amount: -amount, coreSDK: coreSDK, realtimeObjects: realtimeObjects)
     }
 
+    // MARK: - Building operations
+
+    // These are shared by `increment` and ``InternalDefaultRealtimeObjects/publishBatch(_:coreSDK:)``.
+
+    /// RTLC12e1: an increment amount must be finite.
+    internal static func validateIncrementAmount(_ amount: Double) throws(ARTErrorInfo) {
+        if !amount.isFinite {
+            throw LiveObjectsError.counterIncrementAmountInvalid(amount: amount).toARTErrorInfo()
+        }
+    }
+
+    /// RTLC12e: the `COUNTER_INC` ObjectMessage.
+    internal static func counterIncMessage(objectID: String, amount: Double) -> ProtocolTypes.OutboundObjectMessage {
+        .init(
+            operation: .init(
+                // RTLC12e2
+                action: .known(.counterInc),
+                // RTLC12e3
+                objectId: objectID,
+                counterInc: .init(
+                    // RTLC12e5
+                    number: .init(value: amount),
+                ),
+            ),
+        )
+    }
+
     @discardableResult
     internal func subscribe(listener: @escaping LiveObjectUpdateCallback<DefaultLiveCounterUpdate>, coreSDK: CoreSDK) throws(ARTErrorInfo) -> any SubscribeResponse {
         try mutableStateMutex.withSync { mutableState throws(ARTErrorInfo) in
@@ -160,6 +213,13 @@ internal final class InternalDefaultLiveCounter: Sendable {
         }
     }
 
+    /// Emits the update that this counter held back while an ``ObjectsUpdateCoalescer`` was in use, if any.
+    internal func nosync_emitCoalescedUpdate() {
+        mutableStateMutex.withoutSync { mutableState in
+            mutableState.liveObjectMutableState.emitCoalescedUpdate(on: userCallbackQueue)
+        }
+    }
+
     // MARK: - Data manipulation
 
     /// Replaces the internal data of this counter with the provided ObjectState, per RTLC6.
@@ -230,6 +290,22 @@ internal final class InternalDefaultLiveCounter: Sendable {
         }
     }
 
+    /// This counter's data, in the form in which an `OBJECT_SYNC` would convey it, for an
+    /// ``ObjectsPoolSnapshot``. The create operation isn't retained, so `createOp` is `nil`; its
+    /// initial value is part of `counter.count`.
+    internal var nosync_objectState: ProtocolTypes.ObjectState {
+        mutableStateMutex.withoutSync { mutableState in
+            .init(
+                objectId: objectID,
+                siteTimeserials: mutableState.liveObjectMutableState.siteTimeserials.dictionary,
+                tombstone: mutableState.liveObjectMutableState.isTombstone,
+                createOp: nil,
+                map: nil,
+                counter: .init(count: NSNumber(value: mutableState.data)),
+            )
+        }
+    }
+
     // MARK: - LiveObject
 
     /// Returns the object's RTLO3d `isTombstone` property.
@@ -246,6 +322,14 @@ internal final class InternalDefaultLiveCounter: Sendable {
         }
     }
 
+    /// Sets the queue on which this counter schedules its tombstone for garbage collection, and
+    /// schedules it if the counter is already tombstoned.
+    internal func nosync_setGarbageCollectionQueue(_ garbageCollectionQueue: ObjectsGarbageCollectionQueue) {
+        mutableStateMutex.withoutSync { mutableState in
+            mutableState.liveObjectMutableState.garbageCollectionQueue = garbageCollectionQueue
+        }
+    }
+
     // MARK: - Parent-reference graph (RTLO3f)
 
     /// The object's RTLO3f `parentReferences`.
@@ -255,6 +339,13 @@ internal final class InternalDefaultLiveCounter: Sendable {
         }
     }
 
+    /// Changes whenever `parentReferences` changes; see ``ObjectPathIndex``.
+    internal var nosync_parentReferencesVersion: Int {
+        mutableStateMutex.withoutSync { mutableState in
+            mutableState.liveObjectMutableState.parentReferencesVersion
+        }
+    }
+
     /// Records that the map identified by `parentObjectID` references this object at `key`, per RTLO4g.
     internal func nosync_addParentReference(parentObjectID: String, key: String) {
         mutableStateMutex.withoutSync { mutableState in
@@ -288,7 +379,14 @@ internal final class InternalDefaultLiveCounter: Sendable {
         internal var liveObjectMutableState: LiveObjectMutableState<DefaultLiveCounterUpdate>
 
         /// The internal data that this map holds, per RTLC3.
-        internal var data: Double
+        internal var data: Double {
+            didSet {
+                readVersion?.nosync_increment()
+            }
+        }
+
+        /// Incremented whenever `data` changes; see ``ReadVersion``.
+        internal var readVersion: ReadVersion?
 
         /// Replaces the internal data of this counter with the provided ObjectState, per RTLC6.
         ///
@@ -302,7 +400,7 @@ internal final class InternalDefaultLiveCounter: Sendable {
             userCallbackQueue: DispatchQueue,
         ) -> LiveObjectUpdate<DefaultLiveCounterUpdate> {
             // RTLC6a: Replace the private siteTimeserials with the value from ObjectState.siteTimeserials
-            liveObjectMutableState.siteTimeserials = state.siteTimeserials
+            liveObjectMutableState.siteTimeserials = .init(state.siteTimeserials)
 
             // RTLC6e, RTLC6e1: No-op if we're already tombstone
             if liveObjectMutableState.isTombstone {
@@ -389,7 +487,7 @@ internal final class InternalDefaultLiveCounter: Sendable {
 
             // RTLC7c
             if source == .channel {
-                liveObjectMutableState.siteTimeserials[applicableOperation.objectMessageSiteCode] = applicableOperation.objectMessageSerial
+                liveObjectMutableState.siteTimeserials[applicableOperation.objectMessageSiteCode] = applicableOperation.objectMessageTimeserial
             }
 
             // RTLC7e
@@ -406,12 +504,12 @@ internal final class InternalDefaultLiveCounter: Sendable {
                     logger: logger,
                 )
                 // RTLC7d1a, RTLC7d1b: emit the enriched update (carrying the source message)
-                return nosync_emitAndTearDown(update, sourceObjectMessage: objectMessage, userCallbackQueue: userCallbackQueue)
+                return nosync_emitAndTearDown(update, sourceObjectMessage: objectMessage, userCallbackQueue: userCallbackQueue, updateCoalescer: objectsPool.updateCoalescer)
             case .known(.counterInc):
                 // RTLC7d5
                 let update = applyCounterIncOperation(operation.counterInc)
                 // RTLC7d5a, RTLC7d5b
-                return nosync_emitAndTearDown(update, sourceObjectMessage: objectMessage, userCallbackQueue: userCallbackQueue)
+                return nosync_emitAndTearDown(update, sourceObjectMessage: objectMessage, userCallbackQueue: userCallbackQueue, updateCoalescer: objectsPool.updateCoalescer)
             case .known(.objectDelete):
                 let dataBeforeApplyingOperation = data
 
@@ -426,7 +524,7 @@ internal final class InternalDefaultLiveCounter: Sendable {
                 // RTLC7d4c, RTLC7d4b: tombstone update drives the RTLO4b4c3c teardown
                 // The diff helper is deliberately bypassed here: a zero-valued counter's tombstone must still emit an update (RTLO4b4c3c teardown), whereas calculateCounterDiff would return a noop for the zero delta (the RTLC14c zero-delta exception).
                 let update: LiveObjectUpdate<DefaultLiveCounterUpdate> = .update(.init(amount: -dataBeforeApplyingOperation, tombstone: true))
-                return nosync_emitAndTearDown(update, sourceObjectMessage: objectMessage, userCallbackQueue: userCallbackQueue)
+                return nosync_emitAndTearDown(update, sourceObjectMessage: objectMessage, userCallbackQueue: userCallbackQueue, updateCoalescer: objectsPool.updateCoalescer)
             default:
                 // RTLC7d3
                 logger.log("Operation \(operation) has unsupported action for LiveCounter; discarding", level: .warn)
@@ -21,6 +21,41 @@ internal final class InternalDefaultLiveMap: Sendable {
     /// directly on the object and read without a queue hop.
     internal let objectID: String // internal for AblyLiveObjectsTesting
 
+    /// Incremented whenever the map's data changes.
+    private let readVersion: ReadVersion
+
+    /// The ``ObjectsPool/readVersion`` of the pool that this map is in, or `nil` if it isn't in one.
+    private let poolReadVersion: ReadVersion?
+
+    /// The map's size and entries as last read on the internal queue, which ``size(coreSDK:delegate:)``
+    /// and ``entries(coreSDK:delegate:)`` return without dispatching to the queue for as long as
+    /// neither `readVersion` nor `poolReadVersion` has changed.
+    private let readSnapshot = LockedValue<ReadSnapshot?>(nil)
+
+    private struct ReadSnapshot {
+        var versions: ReadVersions
+        var size: Int
+        var entries: [(key: String, value: InternalLiveMapValue)]
+    }
+
+    /// The values of the keys that ``get(key:coreSDK:delegate:)`` has read on the internal queue since
+    /// `readVersion` or `poolReadVersion` last changed, which it returns without dispatching to the
+    /// queue. Filled one key at a time, so that a `get` after a change costs no more than reading that
+    /// key, however many entries the map has.
+    private let valueCache = LockedValue(ValueCache())
+
+    private struct ValueCache {
+        var versions: ReadVersions?
+        /// `nil` values are keys that have no value.
+        var valuesByKey: [String: InternalLiveMapValue?] = [:]
+    }
+
+    /// The values of `readVersion` and `poolReadVersion` when something was read.
+    private struct ReadVersions: Equatable {
+        var readVersion: UInt64
+        var poolReadVersion: UInt64
+    }
+
     // MARK: - Initialization
 
     internal init( // internal for AblyLiveObjectsTesting
@@ -31,11 +66,19 @@ internal final class InternalDefaultLiveMap: Sendable {
         internalQueue: DispatchQueue,
         userCallbackQueue: DispatchQueue,
         clock: SimpleClock,
+        poolReadVersion: ReadVersion? = nil,
     ) {
         self.objectID = objectID
+        let readVersion = ReadVersion()
+        self.readVersion = readVersion
+        self.poolReadVersion = poolReadVersion
+        var initialState = MutableState(liveObjectMutableState: .init(objectID: objectID), data: data, semantics: semantics)
+        initialState.readVersion = readVersion
+        initialState.liveObjectMutableState.poolReadVersion = poolReadVersion
+        initialState.rescheduleTombstonedEntries()
         mutableStateMutex = .init(
             dispatchQueue: internalQueue,
-            initialValue: .init(liveObjectMutableState: .init(objectID: objectID), data: data, semantics: semantics),
+            initialValue: initialState,
         )
         self.logger = logger
         self.userCallbackQueue = userCallbackQueue
@@ -47,6 +90,7 @@ internal final class InternalDefaultLiveMap: Sendable {
     /// - Parameters:
     ///   - objectID: The value to use for the RTLO3a `objectID` property.
     ///   - semantics: The value to use for the "private `semantics` field" of RTO5c1b1b.
+    ///   - poolReadVersion: The ``ObjectsPool/readVersion`` of the pool that the map is being created for.
     internal static func createZeroValued(
         objectID: String,
         semantics: WireEnum<ProtocolTypes.ObjectsMapSemantics>? = nil,
@@ -54,6 +98,7 @@ internal final class InternalDefaultLiveMap: Sendable {
         internalQueue: DispatchQueue,
         userCallbackQueue: DispatchQueue,
         clock: SimpleClock,
+        poolReadVersion: ReadVersion? = nil,
     ) -> Self {
         .init(
             data: [:],
@@ -63,6 +108,7 @@ internal final class InternalDefaultLiveMap: Sendable {
             internalQueue: internalQueue,
             userCallbackQueue: userCallbackQueue,
             clock: clock,
+            poolReadVersion: poolReadVersion,
         )
     }
 
@@ -72,30 +118,89 @@ internal final class InternalDefaultLiveMap: Sendable {
 
     /// Returns the value associated with a given key, following RTLM5d specification.
     internal func get(key: String, coreSDK: CoreSDK, delegate: LiveMapObjectsPoolDelegate) throws(ARTErrorInfo) -> InternalLiveMapValue? {
-        try mutableStateMutex.withSync { mutableState throws(ARTErrorInfo) in
-            try mutableState.nosync_get(
+        if let versions = currentReadVersions,
+           let cachedValue = valueCache.withLock({ valueCache in valueCache.versions == versions ? valueCache.valuesByKey[key] : nil }) {
+            return cachedValue
+        }
+
+        return try mutableStateMutex.withSync { mutableState throws(ARTErrorInfo) in
+            let value = try mutableState.nosync_get(
                 key: key,
                 coreSDK: coreSDK,
                 objectsPool: delegate.nosync_objectsPool,
             )
+            // Only cached once the RTO25 check in nosync_get has passed; a channel state change that
+            // would make it fail increments poolReadVersion
+            if let versions = currentReadVersions {
+                valueCache.withLock { valueCache in
+                    if valueCache.versions != versions {
+                        valueCache = .init(versions: versions)
+                    }
+                    valueCache.valuesByKey[key] = .some(value)
+                }
+            }
+            return value
         }
     }
 
+    /// The current values of `readVersion` and `poolReadVersion`, or `nil` if the map isn't in a pool.
+    private var currentReadVersions: ReadVersions? {
+        poolReadVersion.map { .init(readVersion: readVersion.current, poolReadVersion: $0.current) }
+    }
+
     internal func size(coreSDK: CoreSDK, delegate: LiveMapObjectsPoolDelegate) throws(ARTErrorInfo) -> Int {
-        try mutableStateMutex.withSync { mutableState throws(ARTErrorInfo) in
-            try mutableState.nosync_size(
-                coreSDK: coreSDK,
-                objectsPool: delegate.nosync_objectsPool,
-            )
+        guard poolReadVersion != nil else {
+            return try mutableStateMutex.withSync { mutableState throws(ARTErrorInfo) in
+                try mutableState.nosync_size(
+                    coreSDK: coreSDK,
+                    objectsPool: delegate.nosync_objectsPool,
+                )
+            }
         }
+
+        return try currentReadSnapshot(operationDescription: "LiveMap.size", coreSDK: coreSDK, delegate: delegate).size
     }
 
     internal func entries(coreSDK: CoreSDK, delegate: LiveMapObjectsPoolDelegate) throws(ARTErrorInfo) -> [(key: String, value: InternalLiveMapValue)] {
-        try mutableStateMutex.withSync { mutableState throws(ARTErrorInfo) in
-            try mutableState.nosync_entries(
-                coreSDK: coreSDK,
-                objectsPool: delegate.nosync_objectsPool,
+        guard poolReadVersion != nil else {
+            return try mutableStateMutex.withSync { mutableState throws(ARTErrorInfo) in
+                try mutableState.nosync_entries(
+                    coreSDK: coreSDK,
+                    objectsPool: delegate.nosync_objectsPool,
+                )
+            }
+        }
+
+        return try currentReadSnapshot(operationDescription: "LiveMap.entries", coreSDK: coreSDK, delegate: delegate).entries
+    }
+
+    /// Returns `readSnapshot` if it's still current, and otherwise replaces it with a new one taken
+    /// on the internal queue. Only for a map that's in a pool.
+    private func currentReadSnapshot(operationDescription: String, coreSDK: CoreSDK, delegate: LiveMapObjectsPoolDelegate) throws(ARTErrorInfo) -> ReadSnapshot {
+        guard let versions = currentReadVersions else {
+            preconditionFailure("A map that isn't in a pool has no read snapshot")
+        }
+
+        if let readSnapshot = readSnapshot.load(), readSnapshot.versions == versions {
+            return readSnapshot
+        }
+
+        return try mutableStateMutex.withSync { mutableState throws(ARTErrorInfo) in
+            // RTO25: If the channel is in the DETACHED or FAILED state, the library should indicate an error with code 90001.
+            // The snapshot is only stored once this has passed; a channel state change that would make
+            // it fail increments poolReadVersion.
+            try coreSDK.nosync_validateChannelStateForAccessAPI(operationDescription: operationDescription)
+
+            let objectsPool = delegate.nosync_objectsPool
+            let size = try mutableState.nosync_size(coreSDK: coreSDK, objectsPool: objectsPool)
+            let entries = try mutableState.nosync_entries(coreSDK: coreSDK, objectsPool: objectsPool)
+            let newReadSnapshot = ReadSnapshot(
+                versions: versions,
+                size: size,
+                entries: entries,
             )
+            readSnapshot.store(newReadSnapshot)
+            return newReadSnapshot
         }
     }
 
@@ -122,46 +227,12 @@ internal final class InternalDefaultLiveMap: Sendable {
             try coreSDK.nosync_validateChannelStateForWriteAPI(operationDescription: "LiveMap.set")
         }
 
-        // RTLM20e7: resolve the MAP_SET value's ObjectData and any preceding *_CREATE messages.
-        let mapSetValue: ProtocolTypes.ObjectData
-        let createMessages: [ProtocolTypes.OutboundObjectMessage]
-        switch value {
-        case let .primitive(primitive):
-            // RTLM20e7b–f: a primitive maps 1:1 onto its ObjectData; no creates are needed.
-            mapSetValue = InternalLiveMapValue(primitive).nosync_toObjectData
-            createMessages = []
-        case let .liveCounter(blueprint):
-            // RTLM20e7g1: evaluate the LiveCounter into its COUNTER_CREATE.
-            let evaluated = try await ObjectCreationHelpers.evaluate(liveCounter: blueprint, coreSDK: coreSDK, internalQueue: mutableStateMutex.dispatchQueue)
-            // RTLM20e7g2: reference the created object by its objectId.
-            mapSetValue = .init(objectId: evaluated.objectId)
-            createMessages = evaluated.messages
-        case let .liveMap(blueprint):
-            // RTLM20e7g1: evaluate the LiveMap into its (depth-first) MAP_CREATE messages.
-            let evaluated = try await ObjectCreationHelpers.evaluate(liveMap: blueprint, coreSDK: coreSDK, internalQueue: mutableStateMutex.dispatchQueue)
-            // RTLM20e7g2: reference the created object by the final message's objectId.
-            mapSetValue = .init(objectId: evaluated.objectId)
-            createMessages = evaluated.messages
-        }
+        let (mapSetValue, createMessages) = try await Self.evaluateMapSetValue(value, coreSDK: coreSDK, internalQueue: mutableStateMutex.dispatchQueue)
 
         try await withCheckedContinuation { (continuation: CheckedContinuation<Result<Void, ARTErrorInfo>, _>) in
             do throws(ARTErrorInfo) {
                 try mutableStateMutex.withSync { mutableState throws(ARTErrorInfo) in
-                    // RTLM20e: the MAP_SET ObjectMessage
-                    let mapSetMessage = ProtocolTypes.OutboundObjectMessage(
-                        operation: .init(
-                            // RTLM20e2
-                            action: .known(.mapSet),
-                            // RTLM20e3
-                            objectId: mutableState.liveObjectMutableState.objectID,
-                            mapSet: .init(
-                                // RTLM20e6
-                                key: key,
-                                // RTLM20e7
-                                value: mapSetValue,
-                            ),
-                        ),
-                    )
+                    let mapSetMessage = Self.mapSetMessage(objectID: mutableState.liveObjectMutableState.objectID, key: key, value: mapSetValue)
 
                     // RTLM20h: publish the *_CREATE messages (RTLM20h1) — empty for a primitive
                     // (RTLM20h2) — followed by the MAP_SET, as one atomic array.
@@ -182,18 +253,7 @@ internal final class InternalDefaultLiveMap: Sendable {
                     // RTO26
                     try coreSDK.nosync_validateChannelStateForWriteAPI(operationDescription: "LiveMap.remove")
 
-                    let objectMessage = ProtocolTypes.OutboundObjectMessage(
-                        operation: .init(
-                            // RTLM21e2
-                            action: .known(.mapRemove),
-                            // RTLM21e3
-                            objectId: mutableState.liveObjectMutableState.objectID,
-                            mapRemove: .init(
-                                // RTLM21e5
-                                key: key,
-                            ),
-                        ),
-                    )
+                    let objectMessage = Self.mapRemoveMessage(objectID: mutableState.liveObjectMutableState.objectID, key: key)
 
                     // RTLM21g
                     realtimeObjects.nosync_publishAndApply(objectMessages: [objectMessage], coreSDK: coreSDK) { result in
@@ -206,6 +266,68 @@ internal final class InternalDefaultLiveMap: Sendable {
         }.get()
     }
 
+    // MARK: - Building operations
+
+    // These are shared by `set`/`remove` and ``InternalDefaultRealtimeObjects/publishBatch(_:coreSDK:)``.
+
+    /// RTLM20e7: resolves a `MAP_SET` value to its `ObjectData` and to the `*_CREATE` messages, if any,
+    /// that must precede the `MAP_SET` in the same publish.
+    internal static func evaluateMapSetValue(
+        _ value: LiveMapValue,
+        coreSDK: CoreSDK,
+        internalQueue: DispatchQueue,
+    ) async throws(ARTErrorInfo) -> (value: ProtocolTypes.ObjectData, createMessages: [ProtocolTypes.OutboundObjectMessage]) {
+        switch value {
+        case let .primitive(primitive):
+            // RTLM20e7b–f: a primitive maps 1:1 onto its ObjectData; no creates are needed.
+            return (InternalLiveMapValue(primitive).nosync_toObjectData, [])
+        case let .liveCounter(blueprint):
+            // RTLM20e7g1: evaluate the LiveCounter into its COUNTER_CREATE.
+            let evaluated = try await ObjectCreationHelpers.evaluate(liveCounter: blueprint, coreSDK: coreSDK, internalQueue: internalQueue)
+            // RTLM20e7g2: reference the created object by its objectId.
+            return (.init(objectId: evaluated.objectId), evaluated.messages)
+        case let .liveMap(blueprint):
+            // RTLM20e7g1: evaluate the LiveMap into its (depth-first) MAP_CREATE messages.
+            let evaluated = try await ObjectCreationHelpers.evaluate(liveMap: blueprint, coreSDK: coreSDK, internalQueue: internalQueue)
+            // RTLM20e7g2: reference the created object by the final message's objectId.
+            return (.init(objectId: evaluated.objectId), evaluated.messages)
+        }
+    }
+
+    /// RTLM20e: the `MAP_SET` ObjectMessage.
+    internal static func mapSetMessage(objectID: String, key: String, value: ProtocolTypes.ObjectData) -> ProtocolTypes.OutboundObjectMessage {
+        .init(
+            operation: .init(
+                // RTLM20e2
+                action: .known(.mapSet),
+                // RTLM20e3
+                objectId: objectID,
+                mapSet: .init(
+                    // RTLM20e6
+                    key: key,
+                    // RTLM20e7
+                    value: value,
+                ),
+            ),
+        )
+    }
+
+    /// RTLM21e: the `MAP_REMOVE` ObjectMessage.
+    internal static func mapRemoveMessage(objectID: String, key: String) -> ProtocolTypes.OutboundObjectMessage {
+        .init(
+            operation: .init(
+                // RTLM21e2
+                action: .known(.mapRemove),
+                // RTLM21e3
+                objectId: objectID,
+                mapRemove: .init(
+                    // RTLM21e5
+                    key: key,
+                ),
+            ),
+        )
+    }
+
     @discardableResult
     internal func subscribe(listener: @escaping LiveObjectUpdateCallback<DefaultLiveMapUpdate>, coreSDK: CoreSDK) throws(ARTErrorInfo) -> any SubscribeResponse {
         try mutableStateMutex.withSync { mutableState throws(ARTErrorInfo) in
@@ -261,6 +383,13 @@ internal final class InternalDefaultLiveMap: Sendable {
         }
     }
 
+    /// Emits the update that this map held back while an ``ObjectsUpdateCoalescer`` was in use, if any.
+    internal func nosync_emitCoalescedUpdate() {
+        mutableStateMutex.withoutSync { mutableState in
+            mutableState.liveObjectMutableState.emitCoalescedUpdate(on: userCallbackQueue)
+        }
+    }
+
     // MARK: - Data manipulation
 
     /// Replaces the internal data of this map with the provided ObjectState, per RTLM6.
@@ -360,9 +489,24 @@ internal final class InternalDefaultLiveMap: Sendable {
     }
 
     /// Releases entries that were tombstoned more than `gracePeriod` ago, per RTLM19.
-    internal func nosync_releaseTombstonedEntries(gracePeriod: TimeInterval, clock: SimpleClock) {
+    ///
+    /// - Parameter deadline: If given, stops releasing entries once this has passed.
+    /// - Returns: `false` if it stopped because `deadline` passed, leaving entries to release.
+    @discardableResult
+    internal func nosync_releaseTombstonedEntries(gracePeriod: TimeInterval, clock: SimpleClock, deadline: DispatchTime? = nil) -> Bool {
+        mutableStateMutex.withoutSync { mutableState in
+            mutableState.releaseTombstonedEntries(gracePeriod: gracePeriod, logger: logger, clock: clock, deadline: deadline)
+        }
+    }
+
+    /// Sets the queue on which this map schedules its tombstone and those of its entries for garbage
+    /// collection, and schedules any that it already has.
+    internal func nosync_setGarbageCollectionQueue(_ garbageCollectionQueue: ObjectsGarbageCollectionQueue) {
         mutableStateMutex.withoutSync { mutableState in
-            mutableState.releaseTombstonedEntries(gracePeriod: gracePeriod, logger: logger, clock: clock)
+            mutableState.liveObjectMutableState.garbageCollectionQueue = garbageCollectionQueue
+            if let earliestTombstonedAt = mutableState.tombstonedEntries.earliestTombstonedAt {
+                mutableState.liveObjectMutableState.scheduleGarbageCollection(tombstonedAt: earliestTombstonedAt)
+            }
         }
     }
 
@@ -391,6 +535,13 @@ internal final class InternalDefaultLiveMap: Sendable {
         }
     }
 
+    /// Changes whenever `parentReferences` changes; see ``ObjectPathIndex``.
+    internal var nosync_parentReferencesVersion: Int {
+        mutableStateMutex.withoutSync { mutableState in
+            mutableState.liveObjectMutableState.parentReferencesVersion
+        }
+    }
+
     /// Records that the map identified by `parentObjectID` references this object at `key`, per RTLO4g.
     internal func nosync_addParentReference(parentObjectID: String, key: String) {
         mutableStateMutex.withoutSync { mutableState in
@@ -424,6 +575,33 @@ internal final class InternalDefaultLiveMap: Sendable {
         }
     }
 
+    /// This map's data, in the form in which an `OBJECT_SYNC` would convey it, for an
+    /// ``ObjectsPoolSnapshot``. The create operation isn't retained, so `createOp` is `nil`; its
+    /// initial value is part of `map.entries`.
+    internal var nosync_objectState: ProtocolTypes.ObjectState {
+        mutableStateMutex.withoutSync { mutableState in
+            .init(
+                objectId: objectID,
+                siteTimeserials: mutableState.liveObjectMutableState.siteTimeserials.dictionary,
+                tombstone: mutableState.liveObjectMutableState.isTombstone,
+                createOp: nil,
+                map: .init(
+                    semantics: mutableState.semantics ?? .known(.lww),
+                    entries: mutableState.data.mapValues { entry in
+                        .init(
+                            tombstone: entry.tombstone,
+                            timeserial: entry.timeserial,
+                            data: entry.data,
+                            serialTimestamp: entry.tombstonedAt,
+                        )
+                    },
+                    clearTimeserial: mutableState.clearTimeserial,
+                ),
+                counter: nil,
+            )
+        }
+    }
+
     /// Returns whether a map entry should be considered tombstoned, per RTLM14. Used by the
     /// RTO5c10 rebuild; a pure function of its arguments, so it does not need the internal queue.
     internal static func nosync_isEntryTombstoned(_ entry: InternalObjectsMapEntry, objectsPool: ObjectsPool) -> Bool {
@@ -437,7 +615,11 @@ internal final class InternalDefaultLiveMap: Sendable {
         internal var liveObjectMutableState: LiveObjectMutableState<DefaultLiveMapUpdate>
 
         /// The internal data that this map holds, per RTLM3.
-        internal var data: [String: InternalObjectsMapEntry]
+        internal var data: [String: InternalObjectsMapEntry] {
+            didSet {
+                readVersion?.nosync_increment()
+            }
+        }
 
         /// The "private `semantics` field" of RTO5c1b1b.
         internal var semantics: WireEnum<ProtocolTypes.ObjectsMapSemantics>?
@@ -445,6 +627,13 @@ internal final class InternalDefaultLiveMap: Sendable {
         /// RTLM25
         internal var clearTimeserial: String?
 
+        /// The keys of the tombstoned entries in `data`, in the order in which they were tombstoned, so that
+        /// `releaseTombstonedEntries` visits only those whose grace period has elapsed.
+        internal var tombstonedEntries = TombstoneQueue<String>()
+
+        /// Incremented whenever `data` changes; see ``ReadVersion``.
+        internal var readVersion: ReadVersion?
+
         /// Replaces the internal data of this map with the provided ObjectState, per RTLM6.
         ///
         /// - Parameters:
@@ -460,7 +649,7 @@ internal final class InternalDefaultLiveMap: Sendable {
             userCallbackQueue: DispatchQueue,
         ) -> LiveObjectUpdate<DefaultLiveMapUpdate> {
             // RTLM6a: Replace the private siteTimeserials with the value from ObjectState.siteTimeserials
-            liveObjectMutableState.siteTimeserials = state.siteTimeserials
+            liveObjectMutableState.siteTimeserials = .init(state.siteTimeserials)
 
             // RTLM6e, RTLM6e1: No-op if we're already tombstone
             if liveObjectMutableState.isTombstone {
@@ -525,6 +714,7 @@ internal final class InternalDefaultLiveMap: Sendable {
 
                 return .init(objectsMapEntry: entry, tombstonedAt: tombstonedAt)
             } ?? [:]
+            rescheduleTombstonedEntries()
 
             // RTLM6d: If ObjectState.createOp is present, merge the initial value into the LiveMap as described in RTLM23
             // Discard the LiveMapUpdate object returned by the merge operation
@@ -635,7 +825,7 @@ internal final class InternalDefaultLiveMap: Sendable {
 
             // RTLM15c
             if source == .channel {
-                liveObjectMutableState.siteTimeserials[applicableOperation.objectMessageSiteCode] = applicableOperation.objectMessageSerial
+                liveObjectMutableState.siteTimeserials[applicableOperation.objectMessageSiteCode] = applicableOperation.objectMessageTimeserial
             }
 
             // RTLM15e
@@ -656,7 +846,7 @@ internal final class InternalDefaultLiveMap: Sendable {
                     clock: clock,
                 )
                 // RTLM15d1a, RTLM15d1b: emit the enriched update (carrying the source message)
-                return nosync_emitAndTearDown(update, sourceObjectMessage: objectMessage, userCallbackQueue: userCallbackQueue)
+                return nosync_emitAndTearDown(update, sourceObjectMessage: objectMessage, userCallbackQueue: userCallbackQueue, updateCoalescer: objectsPool.updateCoalescer)
             case .known(.mapSet):
                 guard let mapSet = operation.mapSet else {
                     logger.log("Could not apply MAP_SET since operation.mapSet is missing", level: .warn)
@@ -679,7 +869,7 @@ internal final class InternalDefaultLiveMap: Sendable {
                     clock: clock,
                 )
                 // RTLM15d6a, RTLM15d6b
-                return nosync_emitAndTearDown(update, sourceObjectMessage: objectMessage, userCallbackQueue: userCallbackQueue)
+                return nosync_emitAndTearDown(update, sourceObjectMessage: objectMessage, userCallbackQueue: userCallbackQueue, updateCoalescer: objectsPool.updateCoalescer)
             case .known(.mapRemove):
                 guard let mapRemove = operation.mapRemove else {
                     return nil
@@ -695,7 +885,7 @@ internal final class InternalDefaultLiveMap: Sendable {
                     clock: clock,
                 )
                 // RTLM15d7a, RTLM15d7b
-                return nosync_emitAndTearDown(update, sourceObjectMessage: objectMessage, userCallbackQueue: userCallbackQueue)
+                return nosync_emitAndTearDown(update, sourceObjectMessage: objectMessage, userCallbackQueue: userCallbackQueue, updateCoalescer: objectsPool.updateCoalescer)
             case .known(.objectDelete):
                 // RTLO4e10: the root object must never be tombstoned — an OBJECT_DELETE targeting
                 // `root` is a faulty message. Log and return a noop update without performing any
@@ -722,7 +912,7 @@ internal final class InternalDefaultLiveMap: Sendable {
                 // RTLO4e5/RTLM22b: diff considers only NON-tombstoned entries, so already-tombstoned
                 // entries (not visible to subscribers) must not be reported as newly `removed`.
                 let update: LiveObjectUpdate<DefaultLiveMapUpdate> = .update(.init(update: dataBeforeApplyingOperation.filter { !$0.value.tombstone }.mapValues { _ in .removed }, tombstone: true))
-                return nosync_emitAndTearDown(update, sourceObjectMessage: objectMessage, userCallbackQueue: userCallbackQueue)
+                return nosync_emitAndTearDown(update, sourceObjectMessage: objectMessage, userCallbackQueue: userCallbackQueue, updateCoalescer: objectsPool.updateCoalescer)
             case .known(.mapClear):
                 // RTLM15d8
                 let update = applyMapClearOperation(
@@ -731,7 +921,7 @@ internal final class InternalDefaultLiveMap: Sendable {
                 )
                 // RTLM15d8a, RTLM15d8b. MAP_CLEAR clears the map's data but does not tombstone the
                 // object (tombstone stays false), so no teardown.
-                return nosync_emitAndTearDown(update, sourceObjectMessage: objectMessage, userCallbackQueue: userCallbackQueue)
+                return nosync_emitAndTearDown(update, sourceObjectMessage: objectMessage, userCallbackQueue: userCallbackQueue, updateCoalescer: objectsPool.updateCoalescer)
             default:
                 // RTLM15d4
                 logger.log("Operation \(operation) has unsupported action for LiveMap; discarding", level: .warn)
@@ -762,7 +952,7 @@ internal final class InternalDefaultLiveMap: Sendable {
                     return .noop
                 }
                 // RTLM7a3: drop the parent reference held via the entry being overwritten
-                if let oldRefId = existingEntry.data?.objectId {
+                if let oldRefId = existingEntry.objectID {
                     // RTLM7a3a, RTLM7a3b (with the self-reference guard)
                     nosync_removeParentReferenceGuardingSelfReference(onObjectWithID: oldRefId, key: key, objectsPool: objectsPool)
                 }
@@ -829,7 +1019,7 @@ internal final class InternalDefaultLiveMap: Sendable {
                     return .noop
                 }
                 // RTLM8a3: drop the parent reference held via the entry being removed
-                if let oldRefId = existingEntry.data?.objectId {
+                if let oldRefId = existingEntry.objectID {
                     // RTLM8a3a, RTLM8a3b (with the self-reference guard)
                     nosync_removeParentReferenceGuardingSelfReference(onObjectWithID: oldRefId, key: key, objectsPool: objectsPool)
                 }
@@ -850,6 +1040,9 @@ internal final class InternalDefaultLiveMap: Sendable {
                 // RTLM8b3: Set ObjectsMapEntry.tombstonedAt per RTLO6
                 data[key] = InternalObjectsMapEntry(tombstonedAt: tombstonedAt, timeserial: operationTimeserial, data: nil)
             }
+            if let tombstonedAt {
+                scheduleTombstonedEntry(key: key, tombstonedAt: tombstonedAt)
+            }
 
             return .update(DefaultLiveMapUpdate(update: [key: .removed]))
         }
@@ -952,7 +1145,7 @@ internal final class InternalDefaultLiveMap: Sendable {
 
             for key in keysToRemove {
                 // RTLM24e1c: drop the parent reference held via the cleared entry
-                if let refId = data[key]?.data?.objectId {
+                if let refId = data[key]?.objectID {
                     // RTLM24e1c1, RTLM24e1c2 (with the self-reference guard)
                     nosync_removeParentReferenceGuardingSelfReference(onObjectWithID: refId, key: key, objectsPool: objectsPool)
                 }
@@ -972,7 +1165,7 @@ internal final class InternalDefaultLiveMap: Sendable {
         /// (via the self-reference guard) rather than re-entering via the pool entry.
         internal mutating func nosync_dropHeldParentReferences(objectsPool: ObjectsPool) {
             for (key, entry) in data {
-                guard let refId = entry.data?.objectId else {
+                guard let refId = entry.objectID else {
                     continue
                 }
                 // RTLO4e9a, RTLO4e9b (with the self-reference guard)
@@ -1006,31 +1199,67 @@ internal final class InternalDefaultLiveMap: Sendable {
         internal mutating func resetDataToZeroValued() {
             // RTLM4
             data = [:]
+            tombstonedEntries.removeAll()
             clearTimeserial = nil
         }
 
         /// Releases entries that were tombstoned more than `gracePeriod` ago, per RTLM19.
+        ///
+        /// Only visits the entries whose grace period has elapsed, by way of `tombstonedEntries`.
+        ///
+        /// - Parameter deadline: If given, stops releasing entries once this has passed.
+        /// - Returns: `false` if it stopped because `deadline` passed, leaving entries to release.
+        @discardableResult
         internal mutating func releaseTombstonedEntries(
             gracePeriod: TimeInterval,
             logger: Logger,
             clock: SimpleClock,
-        ) {
-            let now = clock.now
+            deadline: DispatchTime? = nil,
+        ) -> Bool {
+            let releaseTombstonedAtOrBefore = clock.now.addingTimeInterval(-gracePeriod)
+            var isComplete = true
 
             // RTLM19a, RTLM19a1
-            data = data.filter { key, entry in
-                let shouldRelease = {
-                    guard let tombstonedAt = entry.tombstonedAt else {
-                        return false
-                    }
+            while let key = tombstonedEntries.popElement(tombstonedAtOrBefore: releaseTombstonedAtOrBefore) {
+                // The entry may have been removed, or set again, since it was tombstoned
+                guard let entry = data[key], let tombstonedAt = entry.tombstonedAt else {
+                    continue
+                }
+                guard tombstonedAt <= releaseTombstonedAtOrBefore else {
+                    // Tombstoned again since
+                    tombstonedEntries.schedule(key, tombstonedAt: tombstonedAt)
+                    continue
+                }
 
-                    return now.timeIntervalSince(tombstonedAt) >= gracePeriod
-                }()
+                logger.log("Releasing tombstoned entry \(entry) for key \(key)", level: .debug)
+                data.removeValue(forKey: key)
+
+                if let deadline, DispatchTime.now() >= deadline {
+                    isComplete = false
+                    break
+                }
+            }
+
+            if let earliestTombstonedAt = tombstonedEntries.earliestTombstonedAt {
+                liveObjectMutableState.scheduleGarbageCollection(tombstonedAt: earliestTombstonedAt)
+            }
+            return isComplete
+        }
 
-                if shouldRelease {
-                    logger.log("Releasing tombstoned entry \(entry) for key \(key)", level: .debug)
+        /// Queues the entry for `key`, tombstoned at `tombstonedAt`, for release by `releaseTombstonedEntries`.
+        private mutating func scheduleTombstonedEntry(key: String, tombstonedAt: Date) {
+            tombstonedEntries.schedule(key, tombstonedAt: tombstonedAt)
+            liveObjectMutableState.scheduleGarbageCollection(tombstonedAt: tombstonedAt)
+        }
+
+        /// Rebuilds `tombstonedEntries` from the tombstoned entries in `data`. Used when `data` is replaced
+        /// wholesale.
+        internal mutating func rescheduleTombstonedEntries() {
+            tombstonedEntries.removeAll()
+            for (key, entry) in data {
+                if let tombstonedAt = entry.tombstonedAt {
+                    scheduleTombstonedEntry(key: key, tombstonedAt: tombstonedAt)
                 }
-                return !shouldRelease
             }
         }
 
@@ -1094,7 +1323,7 @@ internal final class InternalDefaultLiveMap: Sendable {
             }
 
             // RTLM14c
-            if let objectId = entry.data?.objectId {
+            if let objectId = entry.objectID {
                 if let poolEntry = objectsPool.entries[objectId], poolEntry.nosync_isTombstone {
                     return true
                 }
@@ -1119,7 +1348,7 @@ internal final class InternalDefaultLiveMap: Sendable {
                 return true
             }
             // RTLM14c self-reference guard (see doc comment).
-            if let objectId = entry.data?.objectId, objectId == liveObjectMutableState.objectID {
+            if let objectId = entry.objectID, objectId == liveObjectMutableState.objectID {
                 return liveObjectMutableState.isTombstone
             }
             // RTLM14b/RTLM14c for every other reference — safe to consult the pool.
@@ -1164,30 +1393,48 @@ internal final class InternalDefaultLiveMap: Sendable {
                 return nil
             }
 
-            // Handle primitive values in the order specified by RTLM5d2b through RTLM5d2e
+            // Handle primitive values in the order specified by RTLM5d2b through RTLM5d2e. Unless the entry's value is
+            // `.other`, it holds at most one of them, so return that one without creating an `ObjectData`.
+            let data: ProtocolTypes.ObjectData
+            switch entry.value {
+            case let .boolean(boolean):
+                return .bool(boolean)
+            case let .bytes(bytes):
+                return .data(bytes)
+            case let .number(number):
+                return .number(number)
+            case let .string(string):
+                return .string(string)
+            case let .json(json):
+                data = .init(json: json)
+            case let .other(other):
+                data = other
+            case .absent, .empty, .objectID:
+                data = .init()
+            }
 
             // RTLM5d2b: If ObjectsMapEntry.data.boolean exists, return it
-            if let boolean = entry.data?.boolean {
+            if let boolean = data.boolean {
                 return .bool(boolean)
             }
 
             // RTLM5d2c: If ObjectsMapEntry.data.bytes exists, return it
-            if let bytes = entry.data?.bytes {
+            if let bytes = data.bytes {
                 return .data(bytes)
             }
 
             // RTLM5d2d: If ObjectsMapEntry.data.number exists, return it
-            if let number = entry.data?.number {
+            if let number = data.number {
                 return .number(number.doubleValue)
             }
 
             // RTLM5d2e: If ObjectsMapEntry.data.string exists, return it
-            if let string = entry.data?.string {
+            if let string = data.string {
                 return .string(string)
             }
 
             // TODO: Needs specification (see https://github.com/ably/ably-liveobjects-swift-plugin/issues/46)
-            if let json = entry.data?.json {
+            if let json = data.json {
                 switch json {
                 case let .array(array):
                     return .jsonArray(array)
@@ -1197,7 +1444,7 @@ internal final class InternalDefaultLiveMap: Sendable {
             }
 
             // RTLM5d2f: If ObjectsMapEntry.data.objectId exists, get the object stored at that objectId from the internal ObjectsPool
-            if let objectId = entry.data?.objectId {
+            if let objectId = entry.objectID {
                 // RTLM5d2f1: If an object with id objectId does not exist, return undefined/null
                 guard let poolEntry = objectsPool.entries[objectId] else {
                     return nil
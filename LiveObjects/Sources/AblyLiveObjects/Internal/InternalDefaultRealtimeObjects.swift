@@ -43,6 +43,8 @@ internal final class InternalDefaultRealtimeObjects: Sendable, InternalRealtimeO
 
     /// The RTO10a interval at which we will perform garbage collection.
     private let garbageCollectionInterval: TimeInterval
+    /// The longest that garbage collection occupies the internal queue before yielding it.
+    private let garbageCollectionSliceDuration: TimeInterval
     // The task that runs the periodic garbage collection described in RTO10.
     private nonisolated(unsafe) var garbageCollectionTask: Task<Void, Never>!
 
@@ -53,6 +55,10 @@ internal final class InternalDefaultRealtimeObjects: Sendable, InternalRealtimeO
         /// The default value comes from the suggestion in RTO10a.
         internal var interval: TimeInterval = 5 * 60
 
+        /// The longest that garbage collection occupies the internal queue at a time. When there is more to
+        /// collect, it continues in a later slice, so that other work on the queue can run in between.
+        internal var sliceDuration: TimeInterval = 0.005
+
         /// The initial RTO10b grace period for which we will retain tombstoned objects and map entries. This value may later get overridden by the `objectsGCGracePeriod` of a `CONNECTED` `ProtocolMessage` from Realtime.
         ///
         /// This default value comes from RTO10b3; can be overridden for testing.
@@ -79,6 +85,18 @@ internal final class InternalDefaultRealtimeObjects: Sendable, InternalRealtimeO
         }
     }
 
+    /// How the updates that applying the operations in `OBJECT` ProtocolMessages (RTO8b) produces are
+    /// delivered to instance (RTLO4b4c3a) and path (RTO24b) subscriptions.
+    ///
+    /// When coalescing, the pool holds an ``ObjectsUpdateCoalescer`` for the duration of a batch. A
+    /// sync, a `DETACHED`/`FAILED` channel state or a dispose ends the batch early, so that its
+    /// updates are never delivered after those that such an event causes.
+    private let updateCoalescing: LiveObjectsUpdateCoalescing
+
+    /// Where the objects are persisted after each sync, and warm-started from (see
+    /// ``nosync_warmStartFromSnapshot()``). `nil` if snapshots are not enabled.
+    private let snapshotStore: ObjectsSnapshotStore?
+
     // These drive the testsOnly_waitingForSyncEvents property that informs the test suite when `getRoot()` is waiting for the object sync sequence to complete per RTO23c.
     private let waitingForSyncEvents: AsyncStream<Void>
     private let waitingForSyncEventsContinuation: AsyncStream<Void>.Continuation
@@ -103,9 +121,13 @@ internal final class InternalDefaultRealtimeObjects: Sendable, InternalRealtimeO
         userCallbackQueue: DispatchQueue,
         clock: SimpleClock,
         channelName: String,
-        garbageCollectionOptions: GarbageCollectionOptions = .init()
+        garbageCollectionOptions: GarbageCollectionOptions = .init(),
+        updateCoalescing: LiveObjectsUpdateCoalescing = .disabled,
+        snapshotStore: ObjectsSnapshotStore? = nil
     ) {
         self.logger = logger
+        self.updateCoalescing = updateCoalescing
+        self.snapshotStore = snapshotStore
         self.userCallbackQueue = userCallbackQueue
         self.clock = clock
         (receivedObjectProtocolMessages, receivedObjectProtocolMessagesContinuation) = AsyncStream.makeStream()
@@ -130,6 +152,7 @@ internal final class InternalDefaultRealtimeObjects: Sendable, InternalRealtimeO
             ),
         )
         garbageCollectionInterval = garbageCollectionOptions.interval
+        garbageCollectionSliceDuration = garbageCollectionOptions.sliceDuration
 
         garbageCollectionTask = Task { [weak self, garbageCollectionInterval] in
             do {
@@ -242,6 +265,8 @@ internal final class InternalDefaultRealtimeObjects: Sendable, InternalRealtimeO
         register: PathObjectSubscriptionRegister,
         reason: ARTErrorInfo? = nil,
     ) {
+        // Deliver any coalesced updates before their path subscriptions are dropped.
+        mutableState.nosync_flushCoalescedUpdates(pathObjectSubscriptionRegister: register)
         // Fail any pending publishAndApply / get() sync waiters (RTO20e1 path).
         mutableState.nosync_drainPublishAndApplySyncWaiters(
             outcome: .channelStateFailed(state: .failed, reason: reason),
@@ -263,14 +288,14 @@ internal final class InternalDefaultRealtimeObjects: Sendable, InternalRealtimeO
     // MARK: - Internal methods that power RealtimeObjects conformance
 
     internal func getRoot(coreSDK: CoreSDK) async throws(ARTErrorInfo) -> InternalDefaultLiveMap {
-        let state = try mutableStateMutex.withSync { mutableState throws(ARTErrorInfo) in
+        let canReturnRoot = try mutableStateMutex.withSync { mutableState throws(ARTErrorInfo) in
             // RTO1b: If the channel is in the DETACHED or FAILED state, the library should indicate an error with code 90001
             try coreSDK.nosync_validateChannelStateForAccessAPI(operationDescription: "getRoot")
 
-            return mutableState.state
+            return mutableState.state.toObjectsSyncState == .synced || mutableState.nosync_canServeSnapshot(channelState: coreSDK.nosync_channelState)
         }
 
-        if state.toObjectsSyncState != .synced {
+        if !canReturnRoot {
             // RTO23c
             waitingForSyncEventsContinuation.yield()
             logger.log("getRoot started waiting for sync sequence to complete", level: .debug)
@@ -301,11 +326,12 @@ internal final class InternalDefaultRealtimeObjects: Sendable, InternalRealtimeO
     ///
     /// Unlike the internal `getRoot()` (the old RTO1 API, which registers its `.synced` listener in a
     /// separate queue hop), this keeps check-and-register atomic.
-    internal func ensureSynced() async throws(ARTErrorInfo) {
+    internal func ensureSynced(coreSDK: CoreSDK) async throws(ARTErrorInfo) {
         try await withCheckedContinuation { (continuation: CheckedContinuation<Result<Void, ARTErrorInfo>, Never>) in
             mutableStateMutex.withSync { mutableState in
-                // Atomic with the registration below (same queue block): if already synced, resume now.
-                if mutableState.state.toObjectsSyncState == .synced {
+                // Atomic with the registration below (same queue block): if already synced, or able to
+                // serve a warm-start snapshot, resume now.
+                if mutableState.state.toObjectsSyncState == .synced || mutableState.nosync_canServeSnapshot(channelState: coreSDK.nosync_channelState) {
                     continuation.resume(returning: .success(()))
                     return
                 }
@@ -498,15 +524,21 @@ internal final class InternalDefaultRealtimeObjects: Sendable, InternalRealtimeO
                 userCallbackQueue: userCallbackQueue,
                 pathObjectSubscriptionRegister: pathObjectSubscriptionRegister,
             )
+            nosync_saveSnapshotIfSynced(mutableState: mutableState)
         }
     }
 
     internal func nosync_onChannelStateChanged(toState state: _AblyPluginSupportPrivate.RealtimeChannelState, reason: ARTErrorInfo?) {
         mutableStateMutex.withoutSync { mutableState in
+            // Reading the objects depends on the channel state (RTO25), so the values that they
+            // last read are no longer current
+            mutableState.objectsPool.readVersion.nosync_increment()
+
             mutableState.nosync_onChannelStateChanged(
                 toState: state,
                 reason: reason,
                 logger: logger,
+                pathObjectSubscriptionRegister: pathObjectSubscriptionRegister,
             )
         }
     }
@@ -519,6 +551,13 @@ internal final class InternalDefaultRealtimeObjects: Sendable, InternalRealtimeO
     /// Implements the `OBJECT` handling of RTO8.
     internal func nosync_handleObjectProtocolMessage(objectMessages: [ProtocolTypes.InboundObjectMessage]) {
         mutableStateMutex.withoutSync { mutableState in
+            nosync_startCoalescingUpdates(mutableState: &mutableState)
+            defer {
+                if case .perProtocolMessage = updateCoalescing {
+                    mutableState.nosync_flushCoalescedUpdates(pathObjectSubscriptionRegister: pathObjectSubscriptionRegister)
+                }
+            }
+
             mutableState.nosync_handleObjectProtocolMessage(
                 objectMessages: objectMessages,
                 logger: logger,
@@ -531,6 +570,35 @@ internal final class InternalDefaultRealtimeObjects: Sendable, InternalRealtimeO
         }
     }
 
+    /// Starts a batch of coalesced updates per `updateCoalescing`, unless one is already in progress.
+    private func nosync_startCoalescingUpdates(mutableState: inout MutableState) {
+        guard mutableState.objectsPool.updateCoalescer == nil else {
+            return
+        }
+
+        switch updateCoalescing {
+        case .disabled:
+            return
+        case .perProtocolMessage:
+            mutableState.objectsPool.updateCoalescer = .init()
+        case let .window(interval):
+            let updateCoalescer = ObjectsUpdateCoalescer()
+            mutableState.objectsPool.updateCoalescer = updateCoalescer
+            internalQueue.asyncAfter(deadline: .now() + interval) { [weak self] in
+                guard let self else {
+                    return
+                }
+                mutableStateMutex.withoutSync { mutableState in
+                    // The batch may already have ended early, and another begun
+                    guard mutableState.objectsPool.updateCoalescer === updateCoalescer else {
+                        return
+                    }
+                    mutableState.nosync_flushCoalescedUpdates(pathObjectSubscriptionRegister: pathObjectSubscriptionRegister)
+                }
+            }
+        }
+    }
+
     // testsOnly_ residual: production-embedded instrumentation — cannot move to AblyLiveObjectsTesting; see Test/AblyLiveObjectsTesting/README.md
     internal var testsOnly_receivedObjectSyncProtocolMessages: AsyncStream<[ProtocolTypes.InboundObjectMessage]> {
         receivedObjectSyncProtocolMessages
@@ -549,9 +617,82 @@ internal final class InternalDefaultRealtimeObjects: Sendable, InternalRealtimeO
                 pathObjectSubscriptionRegister: pathObjectSubscriptionRegister,
                 receivedObjectSyncProtocolMessagesContinuation: receivedObjectSyncProtocolMessagesContinuation,
             )
+            nosync_saveSnapshotIfSynced(mutableState: mutableState)
+        }
+    }
+
+    // MARK: - Snapshots
+
+    /// Populates the objects pool from the snapshot that `snapshotStore` holds for this channel, if
+    /// there is a usable one, so that `getRoot()` and `get()` can return without waiting for the first
+    /// sync. The objects then serve reads until that sync completes, which replaces them per RTO5c.
+    ///
+    /// A snapshot is unusable if it can't be decoded, belongs to another channel, or is older than the
+    /// RTO10b grace period, since the objects it omits as tombstoned may since have been released by
+    /// Realtime. An unusable snapshot is removed.
+    ///
+    /// Only does anything in the `INITIALIZED` sync state, i.e. before the first attach, and if the
+    /// store has an owner (see ``ObjectsSnapshotStore/nosync_owner``).
+    internal func nosync_warmStartFromSnapshot() {
+        guard let snapshotStore, let owner = snapshotStore.nosync_owner else {
+            return
+        }
+
+        mutableStateMutex.withoutSync { mutableState in
+            guard case .initialized = mutableState.state else {
+                return
+            }
+
+            let channelName = mutableState.channelName
+            guard let data = snapshotStore.readSnapshot(channelName: channelName, owner: owner) else {
+                return
+            }
+
+            let snapshot: ObjectsPoolSnapshot
+            do {
+                snapshot = try ObjectsPoolSnapshot(encoded: data)
+            } catch {
+                logger.log("Discarding undecodable objects snapshot: \(error)", level: .warn)
+                snapshotStore.scheduleRemoveSnapshot(channelName: channelName, owner: owner)
+                return
+            }
+
+            let age = clock.now.timeIntervalSince(snapshot.createdAt)
+            guard snapshot.channelName == channelName, age <= mutableState.garbageCollectionGracePeriod.toTimeInterval else {
+                logger.log("Discarding objects snapshot for channel \(snapshot.channelName) created \(age)s ago", level: .debug)
+                snapshotStore.scheduleRemoveSnapshot(channelName: channelName, owner: owner)
+                return
+            }
+
+            logger.log("Warm-starting from objects snapshot of \(snapshot.objectStates.count) objects created \(age)s ago", level: .debug)
+            mutableState.objectsPool.nosync_applySyncObjectsPool(
+                snapshot.toSyncObjectsPool(logger: logger),
+                logger: logger,
+                internalQueue: mutableStateMutex.dispatchQueue,
+                userCallbackQueue: userCallbackQueue,
+                clock: clock,
+                pathObjectSubscriptionRegister: pathObjectSubscriptionRegister,
+            )
+            mutableState.isServingSnapshot = true
         }
     }
 
+    /// If the objects are synced and the store has an owner, persists a snapshot of them. The snapshot
+    /// is encoded on the internal queue, since that's where the objects live, but written on the
+    /// store's own queue.
+    private func nosync_saveSnapshotIfSynced(mutableState: MutableState) {
+        guard let snapshotStore, case .synced = mutableState.state, let owner = snapshotStore.nosync_owner else {
+            return
+        }
+
+        let snapshot = ObjectsPoolSnapshot(
+            nosync_objectsPool: mutableState.objectsPool,
+            channelName: mutableState.channelName,
+            createdAt: clock.now,
+        )
+        snapshotStore.scheduleWriteSnapshot(snapshot.encoded, channelName: mutableState.channelName, owner: owner)
+    }
+
     // MARK: - Sending `OBJECT` ProtocolMessage
 
     /// The Ably default maximum message size, in bytes, used as a fallback when the connection has not
@@ -576,6 +717,50 @@ internal final class InternalDefaultRealtimeObjects: Sendable, InternalRealtimeO
         }
     }
 
+    /// Publishes the operations of a ``LiveObjectsBatch`` as one array of ObjectMessages, so that they
+    /// share a single `OBJECT` ProtocolMessage, RTO15d size check and ACK, and are applied locally
+    /// in one step on the internal queue (RTO20). The operations' instances must belong to this
+    /// channel, which ``PublicDefaultRealtimeObject/batch(_:)`` checks.
+    ///
+    /// Each operation becomes the messages that the corresponding single-operation method would
+    /// publish (RTLM20e/RTLM20h1, RTLM21e, RTLC12e), in order. Every operation is validated, and every
+    /// `MAP_SET` value evaluated, before anything is published, so an invalid operation publishes none.
+    internal func publishBatch(_ operations: [LiveObjectsBatch.Operation], coreSDK: CoreSDK) async throws(ARTErrorInfo) {
+        try mutableStateMutex.withSync { _ throws(ARTErrorInfo) in
+            // RTO26
+            try coreSDK.nosync_validateChannelStateForWriteAPI(operationDescription: "RealtimeObject.batch")
+        }
+        for case let .counterIncrement(_, amount) in operations {
+            // RTLC12e1
+            try InternalDefaultLiveCounter.validateIncrementAmount(amount)
+        }
+
+        var objectMessages: [ProtocolTypes.OutboundObjectMessage] = []
+        objectMessages.reserveCapacity(operations.count)
+        for operation in operations {
+            switch operation {
+            case let .mapSet(map, key, value):
+                // RTLM20h1: a blueprint's *_CREATE messages precede its MAP_SET
+                let (mapSetValue, createMessages) = try await InternalDefaultLiveMap.evaluateMapSetValue(value, coreSDK: coreSDK, internalQueue: internalQueue)
+                objectMessages.append(contentsOf: createMessages)
+                objectMessages.append(InternalDefaultLiveMap.mapSetMessage(objectID: map.id, key: key, value: mapSetValue))
+            case let .mapRemove(map, key):
+                objectMessages.append(InternalDefaultLiveMap.mapRemoveMessage(objectID: map.id, key: key))
+            case let .counterIncrement(counter, amount):
+                objectMessages.append(InternalDefaultLiveCounter.counterIncMessage(objectID: counter.id, amount: amount))
+            }
+        }
+
+        try await withCheckedContinuation { (continuation: CheckedContinuation<Result<Void, ARTErrorInfo>, _>) in
+            mutableStateMutex.withSync { _ in
+                // swiftlint:disable:next trailing_closure
+                nosync_publishAndApply(objectMessages: objectMessages, coreSDK: coreSDK, callback: { result in
+                    continuation.resume(returning: result)
+                })
+            }
+        }.get()
+    }
+
     /// RTO20: Publishes ObjectMessages and applies them locally upon receiving the ACK from the server.
     ///
     /// Must be called from within `mutableStateMutex.withSync` (i.e. on the internal queue).
@@ -707,17 +892,60 @@ internal final class InternalDefaultRealtimeObjects: Sendable, InternalRealtimeO
     // MARK: - Garbage collection of deleted objects and map entries
 
     /// Performs garbage collection of tombstoned objects and map entries, per RTO10c.
+    ///
+    /// Performs the first slice of the work before returning; any remaining slices run later on the
+    /// internal queue. The completed-garbage-collection event is emitted after the last slice. Does
+    /// nothing if the slices of a previous call are still to run; the objects that they don't reach
+    /// are collected by the next call after they have.
     internal func performGarbageCollection() {
-        mutableStateMutex.withSync { mutableState in
-            mutableState.objectsPool.nosync_performGarbageCollection(
-                gracePeriod: mutableState.garbageCollectionGracePeriod.toTimeInterval,
-                clock: clock,
-                logger: logger,
-                eventsContinuation: completedGarbageCollectionEventsWithoutBufferingContinuation,
-            )
+        internalQueue.ably_syncNoDeadlock {
+            nosync_performGarbageCollection()
+        }
+    }
+
+    /// The part of ``performGarbageCollection()`` that runs on the internal queue.
+    internal func nosync_performGarbageCollection() {
+        let isComplete = mutableStateMutex.withoutSync { mutableState -> Bool in
+            guard !mutableState.isGarbageCollectionInProgress else {
+                logger.log("Skipping garbage collection, since the previous one is still in progress", level: .debug)
+                return true
+            }
+            let isComplete = nosync_performGarbageCollectionSlice(mutableState: &mutableState)
+            mutableState.isGarbageCollectionInProgress = !isComplete
+            return isComplete
+        }
+        if !isComplete {
+            scheduleGarbageCollectionSlice()
         }
     }
 
+    private func scheduleGarbageCollectionSlice() {
+        internalQueue.async { [weak self] in
+            guard let self else {
+                return
+            }
+            let isComplete = mutableStateMutex.withoutSync { mutableState in
+                let isComplete = nosync_performGarbageCollectionSlice(mutableState: &mutableState)
+                mutableState.isGarbageCollectionInProgress = !isComplete
+                return isComplete
+            }
+            if !isComplete {
+                scheduleGarbageCollectionSlice()
+            }
+        }
+    }
+
+    /// Returns `false` if there is more garbage to collect.
+    private func nosync_performGarbageCollectionSlice(mutableState: inout MutableState) -> Bool {
+        mutableState.objectsPool.nosync_performGarbageCollection(
+            gracePeriod: mutableState.garbageCollectionGracePeriod.toTimeInterval,
+            clock: clock,
+            logger: logger,
+            eventsContinuation: completedGarbageCollectionEventsWithoutBufferingContinuation,
+            deadline: .now() + garbageCollectionSliceDuration,
+        )
+    }
+
     // The completed-garbage-collection event stream. Production writes its continuation from
     // `performGarbageCollection` and `testsOnly_finishAllTestHelperStreams` finishes it; the stream
     // value is retained alongside its continuation (the two are produced together by `makeStream`).
@@ -788,12 +1016,29 @@ internal final class InternalDefaultRealtimeObjects: Sendable, InternalRealtimeO
         /// The RTO10b grace period for which we will retain tombstoned objects and map entries.
         internal var garbageCollectionGracePeriod: GarbageCollectionOptions.GracePeriod
 
+        /// Whether a garbage collection has slices still to run; see ``InternalDefaultRealtimeObjects/performGarbageCollection()``.
+        internal var isGarbageCollectionInProgress = false
+
         /// RTO7b: Serials of operations that have been applied locally upon ACK but whose echoed OBJECT message has not yet been received.
         internal var appliedOnAckSerials: Set<String> = [] // RTO7b1
 
         /// The `siteCode` from the latest `ConnectionDetails`, pushed via ``nosync_setSiteCode``.
         internal var siteCode: String?
 
+        /// Whether the objects pool holds the objects of a warm-start snapshot (see
+        /// ``InternalDefaultRealtimeObjects/nosync_warmStartFromSnapshot()``) and no sync has yet
+        /// completed or cleared them. The sync state is unaffected: it doesn't become `SYNCED` until a
+        /// sync does.
+        internal var isServingSnapshot = false
+
+        /// Whether `getRoot()` and `get()` can return the objects of a warm-start snapshot instead of
+        /// waiting for a sync. Only once the channel is `ATTACHED`, so that the objects read from disk
+        /// are only served once Realtime has let the client see the channel's objects, and while a sync
+        /// is about to replace them.
+        internal func nosync_canServeSnapshot(channelState: _AblyPluginSupportPrivate.RealtimeChannelState) -> Bool {
+            isServingSnapshot && channelState == .attached
+        }
+
         /// The outcome passed to a `nosync_publishAndApply` sync waiter closure.
         internal enum PublishAndApplySyncWaiterOutcome: Sendable {
             case synced
@@ -876,6 +1121,8 @@ internal final class InternalDefaultRealtimeObjects: Sendable, InternalRealtimeO
 
             onChannelAttachedHasObjects = hasObjects
 
+            nosync_flushCoalescedUpdates(pathObjectSubscriptionRegister: pathObjectSubscriptionRegister)
+
             // We will subsequently transition to .synced either by the completion of the RTO4a OBJECT_SYNC, or by the RTO4b no-HAS_OBJECTS case below
             switch state {
             case let .syncing(syncingData):
@@ -962,12 +1209,13 @@ internal final class InternalDefaultRealtimeObjects: Sendable, InternalRealtimeO
             let syncSequenceForSyncingState: SyncSequence?
 
             if let syncCursor {
-                let syncSequenceToContinue: SyncSequence? = if case let .syncing(syncingData) = state {
-                    syncingData.syncSequence
-                } else {
-                    nil
+                var updatedSyncSequence = SyncSequence(id: syncCursor.sequenceID, syncObjectsPool: .init())
+                if case let .syncing(syncingData) = state, syncingData.syncSequence != nil {
+                    // Move the sequence to continue out of the state (which is given the updated sequence below), so
+                    // that the accumulation mutates its pool in place instead of copying everything gathered so far.
+                    swap(&updatedSyncSequence, &syncingData.syncSequence!)
+                    syncingData.syncSequence = nil
                 }
-                var updatedSyncSequence = syncSequenceToContinue ?? .init(id: syncCursor.sequenceID, syncObjectsPool: .init())
                 // RTO5f
                 updatedSyncSequence.syncObjectsPool.accumulate(objectMessages, logger: logger)
                 syncSequenceForSyncingState = updatedSyncSequence
@@ -989,6 +1237,8 @@ internal final class InternalDefaultRealtimeObjects: Sendable, InternalRealtimeO
             }
 
             if let completedSyncObjectsPool {
+                nosync_flushCoalescedUpdates(pathObjectSubscriptionRegister: pathObjectSubscriptionRegister)
+
                 // RTO5c
                 objectsPool.nosync_applySyncObjectsPool(
                     completedSyncObjectsPool,
@@ -1136,12 +1386,20 @@ internal final class InternalDefaultRealtimeObjects: Sendable, InternalRealtimeO
                 // the `getFullPaths` DFS) and only for a non-`.noop` update (RTLO4b4c1). The
                 // instance-subscription fan-out already happened inside apply.
                 if let changedMapKeys = result.changedMapKeysForPathEvent {
-                    nosync_notifyPathSubscriptions(
-                        objectID: operation.objectId,
-                        changedMapKeys: changedMapKeys,
-                        objectMessage: objectMessage,
-                        pathObjectSubscriptionRegister: pathObjectSubscriptionRegister,
-                    )
+                    if let updateCoalescer = objectsPool.updateCoalescer {
+                        updateCoalescer.nosync_addPathEvent(
+                            objectID: operation.objectId,
+                            changedMapKeys: changedMapKeys,
+                            objectMessage: objectMessage,
+                        )
+                    } else {
+                        nosync_notifyPathSubscriptions(
+                            objectID: operation.objectId,
+                            changedMapKeys: changedMapKeys,
+                            objectMessage: objectMessage,
+                            pathObjectSubscriptionRegister: pathObjectSubscriptionRegister,
+                        )
+                    }
                 }
             }
         }
@@ -1167,6 +1425,12 @@ internal final class InternalDefaultRealtimeObjects: Sendable, InternalRealtimeO
             )
         }
 
+        /// Ends the current batch of coalesced updates, if any, delivering its updates; see
+        /// ``LiveObjectsUpdateCoalescing``.
+        internal mutating func nosync_flushCoalescedUpdates(pathObjectSubscriptionRegister: PathObjectSubscriptionRegister) {
+            objectsPool.nosync_flushCoalescedUpdates(channelName: channelName, register: pathObjectSubscriptionRegister)
+        }
+
         /// Drains all `nosync_publishAndApply` sync waiter closures, invoking each with the given outcome.
         ///
         /// Each waiter receives `&self` so it can apply synthetic messages and pass mutable state
@@ -1191,6 +1455,9 @@ internal final class InternalDefaultRealtimeObjects: Sendable, InternalRealtimeO
             // RTO4b3, RTO4b4, RTO5c9: Clear appliedOnAckSerials after sync
             appliedOnAckSerials.removeAll()
 
+            // The synced objects replace those of any warm-start snapshot
+            isServingSnapshot = false
+
             // RTO5c3, RTO5c4, RTO5c5, RTO5c8
             transition(to: .synced, userCallbackQueue: userCallbackQueue)
 
@@ -1216,6 +1483,7 @@ internal final class InternalDefaultRealtimeObjects: Sendable, InternalRealtimeO
             toState state: _AblyPluginSupportPrivate.RealtimeChannelState,
             reason: ARTErrorInfo?,
             logger: Logger,
+            pathObjectSubscriptionRegister: PathObjectSubscriptionRegister,
         ) {
             switch state {
             case .detached, .suspended, .failed:
@@ -1234,8 +1502,11 @@ internal final class InternalDefaultRealtimeObjects: Sendable, InternalRealtimeO
                 case .detached, .failed:
                     // RTO27a: the current state of the objects data can no longer be known.
                     logger.log("Channel entered \(state) state; clearing objects data per RTO27a", level: .debug)
+                    // Deliver the coalesced updates to the data that is about to be cleared.
+                    nosync_flushCoalescedUpdates(pathObjectSubscriptionRegister: pathObjectSubscriptionRegister)
                     // RTO27a1: clear every object's data to that of a new empty object of its type, emitting no events.
                     objectsPool.nosync_clearObjectsData()
+                    isServingSnapshot = false
                     // RTO27a2: clear the SyncObjectsPool.
                     nosync_clearSyncObjectsPool()
                 default:
@@ -48,14 +48,23 @@ internal extension InternalLiveObject {
     /// - Parameter sourceObjectMessage: the internal source ``ProtocolTypes/InboundObjectMessage``
     ///   this op-bearing update derives from; the public message is projected per PAOM3 only at
     ///   delivery. Only the op-apply path calls this (sync-originated updates emit via `nosync_emit`).
+    /// - Parameter updateCoalescer: if non-`nil`, the update (and any teardown) is held back until
+    ///   the coalescer is flushed, merged with this object's other updates until then.
     /// - Returns: the enriched update, so the apply return carries the enrichment too.
     mutating func nosync_emitAndTearDown(
         _ rawUpdate: LiveObjectUpdate<Update>,
         sourceObjectMessage: ProtocolTypes.InboundObjectMessage,
         userCallbackQueue: DispatchQueue,
+        updateCoalescer: ObjectsUpdateCoalescer? = nil,
     ) -> LiveObjectUpdate<Update> where Update: LiveObjectUpdatePayload {
         // RTLO4b4d: stamp the internal source message onto the update
         let enriched = rawUpdate.nosync_stampingObjectMessage(sourceObjectMessage)
+        if let updateCoalescer {
+            if liveObjectMutableState.coalesce(enriched) {
+                updateCoalescer.nosync_addCoalescedUpdate(objectID: liveObjectMutableState.objectID)
+            }
+            return enriched
+        }
         // RTLO4b4c3a: emit to instance listeners (noops are dropped in emit)
         liveObjectMutableState.emit(enriched, on: userCallbackQueue)
         // RTLO4b4c3c: tombstone teardown — deregister this object's subscriptions after emitting
@@ -1,23 +1,156 @@
 import Foundation
 
 /// The entries stored in a `LiveMap`'s data. Same as an `ObjectsMapEntry` but with an additional `tombstonedAt` property, per RTLM3a.
+///
+/// A map can hold millions of entries, so an entry stores its fields compactly: its data as a ``Value`` that keeps a
+/// single primitive inline instead of an `ObjectData` with a slot for each kind of value, and its `tombstonedAt` as a
+/// bare time interval. The `tombstonedAt` and `data` properties present them in their spec form.
 @available(macOS 11.0, iOS 14.0, tvOS 14.0, *)
 internal struct InternalObjectsMapEntry: Equatable {
-    internal var tombstonedAt: Date? // RTLM3a
+    /// The data of an entry.
+    ///
+    /// An `ObjectData` normally has exactly one of its properties set, so all but ``other(_:)`` hold that property's
+    /// value directly. Numbers are held as a `Double`, which is what ``LiveMapValue`` exposes, whenever that loses nothing.
+    internal enum Value: Equatable {
+        /// The entry has no `ObjectData`.
+        case absent
+        /// An `ObjectData` with none of its properties set.
+        case empty
+        case objectID(String)
+        case boolean(Bool)
+        case bytes(Data)
+        case number(Double)
+        case string(String)
+        case json(JSONObjectOrArray)
+        /// Any other `ObjectData`, for example one with more than one property set.
+        indirect case other(ProtocolTypes.ObjectData)
+    }
+
+    /// `tombstonedAt` as a `timeIntervalSinceReferenceDate`, or NaN if it's `nil`. Saves the padding of a `Date?`.
+    private var tombstonedAtInterval: TimeInterval
+    internal var timeserial: String? // OME2b
+    internal var value: Value // OME2c
+
+    internal init(tombstonedAt: Date? = nil, timeserial: String? = nil, data: ProtocolTypes.ObjectData? = nil) {
+        tombstonedAtInterval = tombstonedAt?.timeIntervalSinceReferenceDate ?? .nan
+        self.timeserial = timeserial
+        value = .init(data: data)
+    }
+
+    internal var tombstonedAt: Date? { // RTLM3a
+        get {
+            tombstonedAtInterval.isNaN ? nil : Date(timeIntervalSinceReferenceDate: tombstonedAtInterval)
+        }
+        set {
+            tombstonedAtInterval = newValue?.timeIntervalSinceReferenceDate ?? .nan
+        }
+    }
+
     internal var tombstone: Bool {
         // TODO: Confirm that we don't need to store this (https://github.com/ably/specification/pull/350/files#r2213895661)
-        tombstonedAt != nil
+        !tombstonedAtInterval.isNaN
     }
 
-    internal var timeserial: String? // OME2b
-    internal var data: ProtocolTypes.ObjectData? // OME2c
+    /// The entry's data in the form of an `ObjectData`. Prefer ``value`` or ``objectID`` on hot paths, since this
+    /// getter creates an `ObjectData`.
+    internal var data: ProtocolTypes.ObjectData? { // OME2c
+        get {
+            value.data
+        }
+        set {
+            value = .init(data: newValue)
+        }
+    }
+
+    /// The `objectId` of the entry's data, if it has one.
+    internal var objectID: String? {
+        switch value {
+        case let .objectID(objectID):
+            objectID
+        case let .other(data):
+            data.objectId
+        default:
+            nil
+        }
+    }
+
+    internal static func == (lhs: Self, rhs: Self) -> Bool {
+        // Compare tombstonedAt rather than the stored interval, since NaN != NaN
+        lhs.tombstonedAt == rhs.tombstonedAt && lhs.timeserial == rhs.timeserial && lhs.value == rhs.value
+    }
 }
 
 @available(macOS 11.0, iOS 14.0, tvOS 14.0, *)
 internal extension InternalObjectsMapEntry {
     init(objectsMapEntry: ProtocolTypes.ObjectsMapEntry, tombstonedAt: Date?) {
-        self.tombstonedAt = tombstonedAt
-        timeserial = objectsMapEntry.timeserial
-        data = objectsMapEntry.data
+        self.init(tombstonedAt: tombstonedAt, timeserial: objectsMapEntry.timeserial, data: objectsMapEntry.data)
+    }
+}
+
+@available(macOS 11.0, iOS 14.0, tvOS 14.0, *)
+internal extension InternalObjectsMapEntry.Value {
+    init(data: ProtocolTypes.ObjectData?) {
+        guard let data else {
+            self = .absent
+            return
+        }
+
+        switch (data.objectId, data.boolean, data.bytes, data.number, data.string, data.json) {
+        case (nil, nil, nil, nil, nil, nil):
+            self = .empty
+        case let (objectID?, nil, nil, nil, nil, nil):
+            self = .objectID(objectID)
+        case let (nil, boolean?, nil, nil, nil, nil):
+            self = .boolean(boolean)
+        case let (nil, nil, bytes?, nil, nil, nil):
+            self = .bytes(bytes)
+        case let (nil, nil, nil, number?, nil, nil):
+            if let double = Self.losslessDouble(number) {
+                self = .number(double)
+            } else {
+                self = .other(data)
+            }
+        case let (nil, nil, nil, nil, string?, nil):
+            self = .string(string)
+        case let (nil, nil, nil, nil, nil, json?):
+            self = .json(json)
+        default:
+            self = .other(data)
+        }
+    }
+
+    /// The `ObjectData` that this value holds.
+    var data: ProtocolTypes.ObjectData? {
+        switch self {
+        case .absent:
+            nil
+        case .empty:
+            .init()
+        case let .objectID(objectID):
+            .init(objectId: objectID)
+        case let .boolean(boolean):
+            .init(boolean: boolean)
+        case let .bytes(bytes):
+            .init(bytes: bytes)
+        case let .number(number):
+            .init(number: NSNumber(value: number))
+        case let .string(string):
+            .init(string: string)
+        case let .json(json):
+            .init(json: json)
+        case let .other(data):
+            data
+        }
+    }
+
+    /// Returns `number` as a `Double` if converting it back gives an equal `NSNumber`; that is, if it's not a boolean
+    /// and not an integer that a `Double` can't represent exactly.
+    private static func losslessDouble(_ number: NSNumber) -> Double? {
+        // A boolean NSNumber reports the `char` type; keep it as it is so that it stays a boolean
+        guard number.objCType.pointee != CChar(UInt8(ascii: "c")) else {
+            return nil
+        }
+        let double = number.doubleValue
+        return NSNumber(value: double) == number ? double : nil
     }
 }
@@ -59,6 +59,10 @@ internal protocol LiveObjectUpdatePayload: Sendable {
     var objectMessage: ProtocolTypes.InboundObjectMessage? { get set }
     /// Whether this update tombstones the object.
     var tombstone: Bool { get set }
+
+    /// Merges `later`, an update to the same object that was produced after this one, into this
+    /// update, so that the result describes both. Used by ``ObjectsUpdateCoalescer``.
+    mutating func merge(_ later: Self)
 }
 
 /// Represents an update to an internal live map (``InternalDefaultLiveMap``).
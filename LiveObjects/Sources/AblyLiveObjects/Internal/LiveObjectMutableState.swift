@@ -9,7 +9,7 @@ internal struct LiveObjectMutableState<Update: Sendable> {
     // RTLO3a
     internal var objectID: String
     // RTLO3b
-    internal var siteTimeserials: [String: String] = [:]
+    internal var siteTimeserials = SiteTimeserials()
     // RTLO3c
     internal var createOperationIsMerged = false
     // RTLO3d
@@ -19,13 +19,44 @@ internal struct LiveObjectMutableState<Update: Sendable> {
     }
 
     // RTLO3e
-    internal var tombstonedAt: Date?
+    internal var tombstonedAt: Date? {
+        didSet {
+            if let tombstonedAt {
+                scheduleGarbageCollection(tombstonedAt: tombstonedAt)
+            }
+            // The maps that reference this object read it as removed (RTLM14c)
+            poolReadVersion?.nosync_increment()
+        }
+    }
+
+    /// The ``ObjectsPool/readVersion`` of the pool that holds this object, or `nil` if it isn't in
+    /// one. Incremented when the object is tombstoned.
+    internal var poolReadVersion: ReadVersion?
+
+    /// The queue on which this object schedules its tombstone, and those of its map entries, for
+    /// RTO10 garbage collection. Set by the ``ObjectsPool`` that holds the object; until then, nothing
+    /// is scheduled.
+    internal var garbageCollectionQueue: ObjectsGarbageCollectionQueue? {
+        didSet {
+            if let tombstonedAt {
+                scheduleGarbageCollection(tombstonedAt: tombstonedAt)
+            }
+        }
+    }
 
     /// Reverse references: parent map `objectID` -> the set of keys at which that map references
     /// this object. Keyed by objectID per RTLO3f/RTLO3f1 (references between objects are stored as
     /// objectIds and resolved via the pool).
     /// Spec: RTLO3f, RTLO3f2 (initialised to an empty map).
-    internal var parentReferences: [String: Set<String>] = [:]
+    internal var parentReferences: [String: Set<String>] = [:] {
+        didSet {
+            parentReferencesVersion &+= 1
+        }
+    }
+
+    /// Changes whenever `parentReferences` is set, so that ``ObjectPathIndex`` can tell whether the
+    /// paths it indexed through this object are still valid.
+    internal private(set) var parentReferencesVersion = 0
 
     private enum EventName {
         case update
@@ -37,6 +68,10 @@ internal struct LiveObjectMutableState<Update: Sendable> {
     /// Internal lifecycle event subscription storage.
     private var lifecycleEventSubscriptionStorage = SubscriptionStorage<LiveObjectLifecycleEvent, Void>()
 
+    /// The merge of the updates held back by an ``ObjectsUpdateCoalescer`` since this object last
+    /// emitted; see ``coalesce(_:)``.
+    private var coalescedUpdate: Update?
+
     internal init(objectID: String) {
         self.objectID = objectID
     }
@@ -47,6 +82,14 @@ internal struct LiveObjectMutableState<Update: Sendable> {
     internal struct ApplicableOperation: Equatable {
         internal let objectMessageSerial: String
         internal let objectMessageSiteCode: String
+        /// `objectMessageSerial` in the form in which ``siteTimeserials`` stores it.
+        internal let objectMessageTimeserial: Timeserial
+
+        internal init(objectMessageSerial: String, objectMessageSiteCode: String) {
+            self.objectMessageSerial = objectMessageSerial
+            self.objectMessageSiteCode = objectMessageSiteCode
+            objectMessageTimeserial = .init(objectMessageSerial)
+        }
     }
 
     /// Indicates whether an operation described by an `ObjectMessage` should be applied or discarded, per RTLO4a.
@@ -62,22 +105,30 @@ internal struct LiveObjectMutableState<Update: Sendable> {
             return nil
         }
 
+        let applicableOperation = ApplicableOperation(objectMessageSerial: serial, objectMessageSiteCode: siteCode)
+
         // RTLO4a4: Get the siteSerial value stored for this LiveObject in the siteTimeserials map using the key ObjectMessage.siteCode
-        let siteSerial = siteTimeserials[siteCode]
+        let siteSerial = siteTimeserials[applicableOperation.objectMessageSiteCode]
 
         // RTLO4a5: If the siteSerial for this LiveObject is null or an empty string, return true
         guard let siteSerial, !siteSerial.isEmpty else {
-            return ApplicableOperation(objectMessageSerial: serial, objectMessageSiteCode: siteCode)
+            return applicableOperation
         }
 
         // RTLO4a6: If the siteSerial for this LiveObject is not an empty string, return true if ObjectMessage.serial is greater than siteSerial when compared lexicographically
-        if serial > siteSerial {
-            return ApplicableOperation(objectMessageSerial: serial, objectMessageSiteCode: siteCode)
+        if applicableOperation.objectMessageTimeserial > siteSerial {
+            return applicableOperation
         }
 
         return nil
     }
 
+    /// Schedules this object for garbage collection once the grace period for something tombstoned
+    /// at `tombstonedAt` has elapsed. Must be called on the internal queue.
+    internal func scheduleGarbageCollection(tombstonedAt: Date) {
+        garbageCollectionQueue?.nosync_schedule(objectID: objectID, tombstonedAt: tombstonedAt)
+    }
+
     // MARK: - Subscriptions
 
     internal typealias UpdateLiveObject = @Sendable (_ action: (inout Self) -> Void) -> Void
@@ -147,6 +198,38 @@ internal struct LiveObjectMutableState<Update: Sendable> {
         }
     }
 
+    /// Holds `update` back instead of emitting it, merging it into any update already held back.
+    ///
+    /// - Returns: `true` if no update was already held back, i.e. the object has only now become one
+    ///   to flush. A `.noop` holds nothing back (RTLO4b4c1) and returns `false`.
+    internal mutating func coalesce(_ update: LiveObjectUpdate<Update>) -> Bool where Update: LiveObjectUpdatePayload {
+        guard case let .update(update) = update else {
+            return false
+        }
+        guard var coalescedUpdate else {
+            self.coalescedUpdate = update
+            return true
+        }
+        coalescedUpdate.merge(update)
+        self.coalescedUpdate = coalescedUpdate
+        return false
+    }
+
+    /// Emits the update held back by ``coalesce(_:)``, if any, and — if it tombstones the object —
+    /// deregisters all of the object's subscriptions afterwards (RTLO4b4c3c teardown).
+    internal mutating func emitCoalescedUpdate(on queue: DispatchQueue) where Update: LiveObjectUpdatePayload {
+        guard let coalescedUpdate else {
+            return
+        }
+        self.coalescedUpdate = nil
+        // RTLO4b4c3a
+        subscriptionStorage.emit(coalescedUpdate, eventName: .update, on: queue)
+        // RTLO4b4c3c
+        if coalescedUpdate.tombstone {
+            unsubscribeAll()
+        }
+    }
+
     internal func emitLifecycleEvent(_ event: LiveObjectLifecycleEvent, on queue: DispatchQueue) {
         lifecycleEventSubscriptionStorage.emit(eventName: event, on: queue)
     }
@@ -51,7 +51,7 @@ internal enum ObjectDiffHelpers {
             let previousEntry = previousData[key]!
             let newEntry = newData[key]!
 
-            if previousEntry.data != newEntry.data {
+            if previousEntry.value != newEntry.value {
                 update[key] = .updated
             }
         }
@@ -0,0 +1,59 @@
+import Foundation
+
+/// Memoizes the RTLO4f full paths of the objects in an ``ObjectsPool``, so that the path
+/// subscription dispatch that follows every object update (RTO24b1) doesn't repeat the
+/// `parentReferences` DFS when the parent-reference graph hasn't changed — which, for counter
+/// increments and primitive map sets, is almost always.
+///
+/// Each indexed entry records the `parentReferencesVersion` of every object whose
+/// `parentReferences` the DFS read (or that it found missing from the pool). An entry is stale once
+/// any of those has changed, so checking it costs one version read per object on its paths and no
+/// allocation. Changes to the pool's membership also drop the whole index; see
+/// ``ObjectsPool/entries``.
+///
+/// ## Concurrency
+///
+/// Queue-confined, like the ``ObjectsPool`` that owns it: every method is `nosync_` and must be
+/// called on the objects engine's internal serial queue. There is no lock.
+@available(macOS 11.0, iOS 14.0, tvOS 14.0, *)
+internal final class ObjectPathIndex: @unchecked Sendable {
+    /// An object whose `parentReferences` were read while computing an entry.
+    internal struct Dependency {
+        internal let objectID: String
+        /// `nil` if the object wasn't in the pool.
+        internal let parentReferencesVersion: Int?
+    }
+
+    private struct IndexedPaths {
+        let paths: [[String]]
+        let dependencies: [Dependency]
+    }
+
+    private nonisolated(unsafe) var indexedPathsByObjectID: [String: IndexedPaths] = [:]
+
+    /// The number of objects with indexed paths, for tests.
+    internal var nosync_count: Int {
+        indexedPathsByObjectID.count
+    }
+
+    /// Returns the indexed paths for `objectID`, if every dependency is still at the version
+    /// recorded with them. `currentVersion` returns an object's current `parentReferencesVersion`.
+    internal func nosync_paths(forObjectID objectID: String, currentVersion: (String) -> Int?) -> [[String]]? {
+        guard let indexed = indexedPathsByObjectID[objectID] else {
+            return nil
+        }
+        for dependency in indexed.dependencies where currentVersion(dependency.objectID) != dependency.parentReferencesVersion {
+            indexedPathsByObjectID.removeValue(forKey: objectID)
+            return nil
+        }
+        return indexed.paths
+    }
+
+    internal func nosync_setPaths(_ paths: [[String]], dependencies: [Dependency], forObjectID objectID: String) {
+        indexedPathsByObjectID[objectID] = .init(paths: paths, dependencies: dependencies)
+    }
+
+    internal func nosync_removeAll() {
+        indexedPathsByObjectID.removeAll()
+    }
+}
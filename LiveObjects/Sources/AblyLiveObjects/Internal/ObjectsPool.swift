@@ -74,6 +74,16 @@ internal struct ObjectsPool {
             }
         }
 
+        /// Emits the update that the object held back while an ``ObjectsUpdateCoalescer`` was in use, if any.
+        internal func nosync_emitCoalescedUpdate() {
+            switch self {
+            case let .map(map):
+                map.nosync_emitCoalescedUpdate()
+            case let .counter(counter):
+                counter.nosync_emitCoalescedUpdate()
+            }
+        }
+
         /// A LiveObject plus an update that can be emitted on this LiveObject. Can be used to store pending events while applying the `SyncObjectsPool`.
         fileprivate enum DeferredUpdate {
             case map(InternalDefaultLiveMap, LiveObjectUpdate<DefaultLiveMapUpdate>)
@@ -170,6 +180,26 @@ internal struct ObjectsPool {
             }
         }
 
+        /// The object's data, in the form in which an `OBJECT_SYNC` would convey it.
+        internal var nosync_objectState: ProtocolTypes.ObjectState {
+            switch self {
+            case let .counter(counter):
+                counter.nosync_objectState
+            case let .map(map):
+                map.nosync_objectState
+            }
+        }
+
+        /// Sets the queue on which the object schedules its tombstones for garbage collection.
+        fileprivate func nosync_setGarbageCollectionQueue(_ garbageCollectionQueue: ObjectsGarbageCollectionQueue) {
+            switch self {
+            case let .counter(counter):
+                counter.nosync_setGarbageCollectionQueue(garbageCollectionQueue)
+            case let .map(map):
+                map.nosync_setGarbageCollectionQueue(garbageCollectionQueue)
+            }
+        }
+
         // MARK: - Parent-reference graph (RTLO3f)
 
         /// The object's RTLO3f `parentReferences`.
@@ -182,6 +212,16 @@ internal struct ObjectsPool {
             }
         }
 
+        /// Changes whenever the object's `parentReferences` change; see ``ObjectPathIndex``.
+        internal var nosync_parentReferencesVersion: Int {
+            switch self {
+            case let .counter(counter):
+                counter.nosync_parentReferencesVersion
+            case let .map(map):
+                map.nosync_parentReferencesVersion
+            }
+        }
+
         /// Records that the map identified by `parentObjectID` references this object at `key`, per RTLO4g.
         internal func nosync_addParentReference(parentObjectID: String, key: String) {
             switch self {
@@ -216,7 +256,35 @@ internal struct ObjectsPool {
     /// Keyed by `objectId`.
     ///
     /// Per RTO3b, always contains an entry for `ObjectsPool.rootKey`, and this entry is always of type `map`.
-    internal var entries: [String: Entry] // internal setter for AblyLiveObjectsTesting
+    internal var entries: [String: Entry] { // internal setter for AblyLiveObjectsTesting
+        didSet {
+            // An object joining or leaving the pool can add or remove paths through it
+            pathIndex.nosync_removeAll()
+            // ... and change the values of the maps that reference it
+            readVersion.nosync_increment()
+        }
+    }
+
+    /// Shared by the objects that the pool creates, so that they can tell whether the values they
+    /// last read are still current. A reference type, so that copies of the pool share it.
+    internal let readVersion = ReadVersion()
+
+    /// The memoized results of ``nosync_getFullPaths(forObjectID:)``. A reference type, so that it
+    /// can be updated from the non-`mutating` path lookup; copies of the pool share it.
+    private let pathIndex = ObjectPathIndex()
+
+    /// The objects that have something tombstoned, in the order in which it can be garbage collected
+    /// (RTO10c). The objects schedule themselves on it once it has been set on them.
+    private let garbageCollectionQueue = ObjectsGarbageCollectionQueue()
+
+    /// The objects that joined the pool off the internal queue (the root, created with the pool, and
+    /// those added by tests), on which `garbageCollectionQueue` is yet to be set. It is set on them at
+    /// the start of the next garbage collection.
+    private var objectIDsAwaitingGarbageCollectionQueue: [String] = []
+
+    /// While non-`nil`, the updates that objects produce when applying operations are gathered here
+    /// instead of being emitted, until ``nosync_flushCoalescedUpdates(channelName:register:)``.
+    internal var updateCoalescer: ObjectsUpdateCoalescer?
 
     /// The key under which the root object is stored.
     internal static let rootKey = "root"
@@ -255,8 +323,16 @@ internal struct ObjectsPool {
                 internalQueue: internalQueue,
                 userCallbackQueue: userCallbackQueue,
                 clock: clock,
+                poolReadVersion: readVersion,
             ),
         )
+        objectIDsAwaitingGarbageCollectionQueue = Array(entries.keys)
+    }
+
+    /// Arranges for an object that was added to `entries` off the internal queue to be garbage
+    /// collected. Not needed for objects created by the pool.
+    internal mutating func trackForGarbageCollection(objectID: String) { // internal for AblyLiveObjectsTesting
+        objectIDsAwaitingGarbageCollectionQueue.append(objectID)
     }
 
     // MARK: - Typed root
@@ -316,6 +392,7 @@ internal struct ObjectsPool {
                     internalQueue: internalQueue,
                     userCallbackQueue: userCallbackQueue,
                     clock: clock,
+                    poolReadVersion: readVersion,
                 ),
             )
         case "counter":
@@ -326,6 +403,7 @@ internal struct ObjectsPool {
                     internalQueue: internalQueue,
                     userCallbackQueue: userCallbackQueue,
                     clock: clock,
+                    poolReadVersion: readVersion,
                 ),
             )
         default:
@@ -333,6 +411,7 @@ internal struct ObjectsPool {
         }
 
         // Note that already know that the key is not "root" per the above check so there's no risk of breaking the RTO3b invariant that the root object is always a map
+        entry.nosync_setGarbageCollectionQueue(garbageCollectionQueue)
         entries[objectID] = entry
         return entry
     }
@@ -400,7 +479,7 @@ internal struct ObjectsPool {
         if !objectIdsToRemove.isEmpty {
             logger.log("Removing objects with IDs: \(objectIdsToRemove) as they were not in sync", level: .debug)
             for objectId in objectIdsToRemove {
-                entries.removeValue(forKey: objectId)
+                nosync_removeEntry(forObjectID: objectId)
             }
         }
 
@@ -429,6 +508,48 @@ internal struct ObjectsPool {
         logger.log("applySyncObjectsPool completed. Pool now contains \(entries.count) objects", level: .debug)
     }
 
+    /// Removes the object with ID `objectID` from the pool. While updates are being coalesced, the
+    /// object first emits the update that it is holding back (RTLO4b4c3a), along with the RTLO4b4c3c
+    /// teardown if that update tombstones it, since `nosync_flushCoalescedUpdates` only reaches the
+    /// objects that are still in the pool.
+    private mutating func nosync_removeEntry(forObjectID objectID: String) {
+        guard let entry = entries.removeValue(forKey: objectID) else {
+            return
+        }
+        if updateCoalescer != nil {
+            entry.nosync_emitCoalescedUpdate()
+        }
+    }
+
+    /// Stops gathering updates in `updateCoalescer` and has each object that it gathered updates for
+    /// emit them as one (RTLO4b4c3a) and then make one RTO24b path dispatch, in the order in which
+    /// the objects were first updated. An object that has since left the pool already emitted its
+    /// update when it was removed (see `nosync_removeEntry(forObjectID:)`).
+    internal mutating func nosync_flushCoalescedUpdates(channelName: String?, register: PathObjectSubscriptionRegister) {
+        guard let updateCoalescer else {
+            return
+        }
+        self.updateCoalescer = nil
+
+        for pendingObject in updateCoalescer.nosync_pendingObjects {
+            guard let entry = entries[pendingObject.objectID] else {
+                continue
+            }
+            if pendingObject.hasCoalescedUpdate {
+                entry.nosync_emitCoalescedUpdate()
+            }
+            if let changedMapKeys = pendingObject.changedMapKeysForPathEvent {
+                nosync_notifyPathSubscriptions(
+                    objectID: pendingObject.objectID,
+                    changedMapKeys: changedMapKeys,
+                    objectMessage: pendingObject.objectMessage,
+                    channelName: channelName,
+                    register: register,
+                )
+            }
+        }
+    }
+
     /// Rebuilds all parent references from the settled pool state, per RTO5c10. Necessary after a
     /// sync because objects may reference other objects that were not yet in the pool when their
     /// references were first applied.
@@ -446,7 +567,7 @@ internal struct ObjectsPool {
                 continue
             }
             for (key, mapEntry) in map.nosync_rawData {
-                guard let refId = mapEntry.data?.objectId else {
+                guard let refId = mapEntry.objectID else {
                     continue
                 }
                 if InternalDefaultLiveMap.nosync_isEntryTombstoned(mapEntry, objectsPool: self) {
@@ -461,44 +582,69 @@ internal struct ObjectsPool {
     /// per simple path in the parent-reference graph, cycle-safe, order unspecified. Returns `[[]]`
     /// when `objectID` is root itself, and `[]` for an orphan (or an object absent from the pool).
     ///
+    /// The result is memoized in the pool's ``ObjectPathIndex`` until the `parentReferences` of an
+    /// object on the paths change, so repeated updates to the same object don't repeat the DFS.
+    ///
     /// The DFS resolves each node's `parentReferences` through a brief, independent read
     /// (`Entry.nosync_parentReferences`); it deliberately never keeps a single object's queue-mutex
     /// open across the walk, so revisiting a node cannot cause an exclusive-access conflict.
     internal func nosync_getFullPaths(forObjectID objectID: String) -> [[String]] {
-        var paths: [[String]] = []
+        if let paths = pathIndex.nosync_paths(forObjectID: objectID, currentVersion: { entries[$0]?.nosync_parentReferencesVersion }) {
+            return paths
+        }
 
-        // Each stack element pairs the object being visited with the path built so far and the set
-        // of objectIDs already visited on this branch.
-        var stack: [(objectID: String, path: [String], visited: Set<String>)] = [
-            (objectID: objectID, path: [], visited: []),
-        ]
+        var paths: [[String]] = []
+        var dependencies: [ObjectPathIndex.Dependency] = []
+
+        // The branch being walked: the objectIDs from `objectID` up to the current node, and the keys
+        // between them (so `keysOnBranch.count == objectIDsOnBranch.count - 1`). Backtracking
+        // truncates them, rather than each stack element carrying its own copies.
+        var objectIDsOnBranch: [String] = []
+        var keysOnBranch: [String] = []
+        var visitedOnBranch = Set<String>()
+
+        // Each stack element is a node to visit, the key at which it references the node below it on
+        // the branch (`nil` for `objectID` itself), and its depth on the branch.
+        var stack: [(objectID: String, key: String?, depth: Int)] = [(objectID: objectID, key: nil, depth: 0)]
+
+        while let (currentID, key, depth) = stack.popLast() {
+            while objectIDsOnBranch.count > depth {
+                visitedOnBranch.remove(objectIDsOnBranch.removeLast())
+            }
+            keysOnBranch.removeLast(keysOnBranch.count - max(depth - 1, 0))
 
-        while let (currentID, currentPath, visited) = stack.popLast() {
             // RTLO4f2: simple paths only — skip a node already visited on this branch (cycles)
-            if visited.contains(currentID) {
+            if visitedOnBranch.contains(currentID) {
                 continue
             }
-            let newVisited = visited.union([currentID])
+            objectIDsOnBranch.append(currentID)
+            visitedOnBranch.insert(currentID)
+            if let key {
+                keysOnBranch.append(key)
+            }
 
             // RTLO4f2: the empty path is contributed only when the walk reaches root
             if currentID == Self.rootKey {
-                paths.append(currentPath)
+                paths.append(keysOnBranch.reversed())
                 continue
             }
 
             // A stale/absent object (left the pool) contributes no further path
-            guard let parentReferences = entries[currentID]?.nosync_parentReferences else {
+            guard let entry = entries[currentID] else {
+                dependencies.append(.init(objectID: currentID, parentReferencesVersion: nil))
                 continue
             }
+            dependencies.append(.init(objectID: currentID, parentReferencesVersion: entry.nosync_parentReferencesVersion))
 
-            for (parentID, keys) in parentReferences {
+            for (parentID, keys) in entry.nosync_parentReferences {
                 for key in keys {
-                    stack.append((objectID: parentID, path: [key] + currentPath, visited: newVisited))
+                    stack.append((objectID: parentID, key: key, depth: depth + 1))
                 }
             }
         }
 
         // RTLO4f3: each simple path appears exactly once; order is unspecified
+        pathIndex.nosync_setPaths(paths, dependencies: dependencies, forObjectID: objectID)
         return paths
     }
 
@@ -580,7 +726,9 @@ internal struct ObjectsPool {
                 internalQueue: internalQueue,
                 userCallbackQueue: userCallbackQueue,
                 clock: clock,
+                poolReadVersion: readVersion,
             )
+            counter.nosync_setGarbageCollectionQueue(garbageCollectionQueue)
             _ = counter.nosync_replaceData(
                 using: state,
                 objectMessageSerialTimestamp: objectMessage.serialTimestamp,
@@ -597,7 +745,9 @@ internal struct ObjectsPool {
                 internalQueue: internalQueue,
                 userCallbackQueue: userCallbackQueue,
                 clock: clock,
+                poolReadVersion: readVersion,
             )
+            map.nosync_setGarbageCollectionQueue(garbageCollectionQueue)
             _ = map.nosync_replaceData(
                 using: state,
                 objectMessageSerialTimestamp: objectMessage.serialTimestamp,
@@ -650,44 +800,63 @@ internal struct ObjectsPool {
     }
 
     /// Performs garbage collection of tombstoned objects and map entries, per RTO10c.
+    ///
+    /// Only visits the objects that have something to release, by way of `garbageCollectionQueue`.
+    ///
+    /// - Parameter deadline: If given, stops once this has passed, so that a large number of expired
+    ///   tombstones doesn't hold up the internal queue. Call again to continue.
+    /// - Returns: `false` if it stopped because `deadline` passed, leaving tombstones to release.
+    @discardableResult
     internal mutating func nosync_performGarbageCollection(
         gracePeriod: TimeInterval,
         clock: SimpleClock,
         logger: Logger,
         eventsContinuation: AsyncStream<Void>.Continuation,
-    ) {
+        deadline: DispatchTime? = nil,
+    ) -> Bool {
         logger.log("Performing garbage collection, grace period \(gracePeriod)s", level: .debug)
 
-        let now = clock.now
+        for objectID in objectIDsAwaitingGarbageCollectionQueue {
+            entries[objectID]?.nosync_setGarbageCollectionQueue(garbageCollectionQueue)
+        }
+        objectIDsAwaitingGarbageCollectionQueue.removeAll()
 
-        entries = entries.filter { key, entry in
-            if case let .map(map) = entry {
-                // RTO10c1a
-                map.nosync_releaseTombstonedEntries(gracePeriod: gracePeriod, clock: clock)
+        let releaseTombstonedAtOrBefore = clock.now.addingTimeInterval(-gracePeriod)
+
+        while let objectID = garbageCollectionQueue.nosync_popObjectID(tombstonedAtOrBefore: releaseTombstonedAtOrBefore) {
+            // The object may have left the pool since it was scheduled
+            guard let entry = entries[objectID] else {
+                continue
             }
 
-            // RTO10c1b
-            let shouldRelease = {
-                // RTO10c1b1: the object with ID `root` must never be removed from the ObjectsPool
-                // (RTO3b). It can never become tombstoned per RTLO4e10, so this exclusion is an
-                // additional safeguard for the RTO3b invariant.
-                guard key != Self.rootKey else {
-                    return false
-                }
+            // RTO10c1b1: the object with ID `root` must never be removed from the ObjectsPool
+            // (RTO3b). It can never become tombstoned per RTLO4e10, so this exclusion is an
+            // additional safeguard for the RTO3b invariant.
+            let tombstonedAt = objectID == Self.rootKey ? nil : entry.nosync_tombstonedAt
 
-                guard let tombstonedAt = entry.nosync_tombstonedAt else {
-                    return false
+            if let tombstonedAt, tombstonedAt <= releaseTombstonedAtOrBefore {
+                // RTO10c1b
+                logger.log("Releasing tombstoned entry \(entry) for key \(objectID)", level: .debug)
+                nosync_removeEntry(forObjectID: objectID)
+            } else {
+                if let tombstonedAt {
+                    // Tombstoned again since
+                    garbageCollectionQueue.nosync_schedule(objectID: objectID, tombstonedAt: tombstonedAt)
                 }
+                if case let .map(map) = entry {
+                    // RTO10c1a; reschedules the map for its remaining tombstoned entries
+                    guard map.nosync_releaseTombstonedEntries(gracePeriod: gracePeriod, clock: clock, deadline: deadline) else {
+                        return false
+                    }
+                }
+            }
 
-                return now.timeIntervalSince(tombstonedAt) >= gracePeriod
-            }()
-
-            if shouldRelease {
-                logger.log("Releasing tombstoned entry \(entry) for key \(key)", level: .debug)
+            if let deadline, DispatchTime.now() >= deadline {
+                return false
             }
-            return !shouldRelease
         }
 
         eventsContinuation.yield()
+        return true
     }
 }
@@ -0,0 +1,99 @@
+internal import _AblyPluginSupportPrivate
+import Ably
+import Foundation
+
+/// A copy of the objects in a channel's ``ObjectsPool``, persisted locally (see
+/// ``ObjectsSnapshotStore``) so that a later instance of the channel can warm-start from it instead
+/// of waiting for the `OBJECT_SYNC` that follows the next attach.
+///
+/// Each object is stored in the form in which an `OBJECT_SYNC` conveys it, including its
+/// `siteTimeserials`, so that warm-starting is the RTO5c application of a ``SyncObjectsPool`` and
+/// the sync that follows reconciles the objects in the usual way. Tombstoned objects are left out.
+///
+/// ## Format
+///
+/// A 4-byte magic number and a 1-byte format version, followed by the binary encoding of a
+/// ``WireValue`` (see `WireValue+Binary.swift`) whose objects are `WireObjectState`s, encoded with
+/// the MessagePack rules of OD4 so that bytes are stored as bytes. A snapshot with any other magic
+/// number or version isn't read.
+@available(macOS 11.0, iOS 14.0, tvOS 14.0, *)
+internal struct ObjectsPoolSnapshot: Equatable {
+    /// The name of the channel whose objects these are.
+    internal var channelName: String
+    /// When the snapshot was taken.
+    internal var createdAt: Date
+    internal var objectStates: [ProtocolTypes.ObjectState]
+
+    internal init(channelName: String, createdAt: Date, objectStates: [ProtocolTypes.ObjectState]) {
+        self.channelName = channelName
+        self.createdAt = createdAt
+        self.objectStates = objectStates
+    }
+
+    /// Takes a snapshot of the objects in `objectsPool`. Must be called on the internal queue.
+    internal init(nosync_objectsPool objectsPool: ObjectsPool, channelName: String, createdAt: Date) {
+        self.channelName = channelName
+        self.createdAt = createdAt
+        objectStates = objectsPool.entries.values.compactMap { entry in
+            entry.nosync_isTombstone ? nil : entry.nosync_objectState
+        }
+    }
+
+    /// The objects, in the form in which ``ObjectsPool/nosync_applySyncObjectsPool(_:logger:internalQueue:userCallbackQueue:clock:pathObjectSubscriptionRegister:)`` applies them.
+    internal func toSyncObjectsPool(logger: Logger) -> SyncObjectsPool {
+        var syncObjectsPool = SyncObjectsPool()
+        syncObjectsPool.accumulate(objectStates.map { .init(object: $0) }, logger: logger)
+        return syncObjectsPool
+    }
+
+    // MARK: - Encoding
+
+    internal enum DecodingError: Error {
+        case notASnapshot
+        case unsupportedFormatVersion(UInt8)
+    }
+
+    private static let magicNumber: [UInt8] = Array("ALOS".utf8)
+    internal static let formatVersion: UInt8 = 1
+
+    private enum WireKey: String {
+        case channelName
+        case createdAt
+        case objects
+    }
+
+    internal var encoded: Data {
+        let wireValue: WireValue = .object([
+            WireKey.channelName.rawValue: .string(channelName),
+            WireKey.createdAt.rawValue: .number(NSNumber(value: createdAt.timeIntervalSince1970 * 1000)),
+            WireKey.objects.rawValue: .array(objectStates.map { $0.toWire(format: .messagePack).toWireValue }),
+        ])
+
+        var data = Data(Self.magicNumber)
+        data.append(Self.formatVersion)
+        data.append(wireValue.binaryEncoded)
+        return data
+    }
+
+    internal init(encoded data: Data) throws(ARTErrorInfo) {
+        let headerLength = Self.magicNumber.count + 1
+        guard data.count >= headerLength, data.prefix(Self.magicNumber.count).elementsEqual(Self.magicNumber) else {
+            throw DecodingError.notASnapshot.toARTErrorInfo()
+        }
+        let version = data[data.startIndex + Self.magicNumber.count]
+        guard version == Self.formatVersion else {
+            throw DecodingError.unsupportedFormatVersion(version).toARTErrorInfo()
+        }
+
+        let wireValue = try WireValue(binaryEncoded: data.dropFirst(headerLength))
+        guard case let .object(wireObject) = wireValue else {
+            throw WireValueDecodingError.valueIsNotObject.toARTErrorInfo()
+        }
+
+        channelName = try wireObject.stringValueForKey(WireKey.channelName.rawValue)
+        createdAt = try wireObject.ablyProtocolDateValueForKey(WireKey.createdAt.rawValue)
+        objectStates = try wireObject.arrayValueForKey(WireKey.objects.rawValue).map { wireValue throws(ARTErrorInfo) in
+            try ProtocolTypes.ObjectState(wireObjectState: WireObjectState(wireValue: wireValue), format: .messagePack)
+        }
+    }
+}
@@ -0,0 +1,101 @@
+import CryptoKit
+import Foundation
+
+/// Stores each channel's ``ObjectsPoolSnapshot`` in a file in a directory chosen by the user (see
+/// ``Ably/ARTClientOptions/liveObjectsSnapshotDirectory``).
+///
+/// The files are kept in a subdirectory per ``Owner``, so that a client never reads the objects that
+/// another app or `clientId` was allowed to see. The store doesn't read or write snapshots while it
+/// has no owner: while the client doesn't know its app yet, or while the channel's messages are
+/// encrypted, since the snapshot would store them in the clear.
+///
+/// Reads are synchronous and memory-map the file, since warm-starting needs the snapshot before it
+/// can proceed. Writes happen on a serial queue of their own, so that they never hold up the internal
+/// queue, and replace the file atomically, so that a reader never sees a partly written snapshot.
+@available(macOS 11.0, iOS 14.0, tvOS 14.0, *)
+internal final class ObjectsSnapshotStore: Sendable {
+    /// Identifies whose objects a snapshot holds.
+    internal struct Owner: Sendable, Equatable {
+        internal var appID: String
+        internal var clientID: String?
+
+        /// The name of the subdirectory that holds the owner's snapshots: a SHA-256 hash of the app ID
+        /// and `clientId`, so that the directory doesn't reveal either.
+        internal var directoryName: String {
+            // A clientId can't contain a NUL, so this can't be confused with another app ID and clientId
+            let identity = "\(appID)\u{0}\(clientID ?? "")"
+            return SHA256.hash(data: Data(identity.utf8)).map { String(format: "%02x", $0) }.joined()
+        }
+    }
+
+    private let directoryURL: URL
+    private let logger: Logger
+    private let nosync_ownerProvider: @Sendable () -> Owner?
+    private let writeQueue = DispatchQueue(label: "io.ably.liveobjects.snapshots", qos: .utility)
+
+    /// - Parameter nosync_owner: Returns the owner of the snapshots that the store reads and writes, or
+    ///   `nil` if it mustn't read or write any at the moment. Called on the internal queue.
+    internal init(directoryURL: URL, logger: Logger, nosync_owner: @escaping @Sendable () -> Owner?) {
+        self.directoryURL = directoryURL
+        self.logger = logger
+        nosync_ownerProvider = nosync_owner
+    }
+
+    /// The owner of the snapshots that the store reads and writes at the moment, or `nil` if it mustn't
+    /// read or write any.
+    internal var nosync_owner: Owner? {
+        nosync_ownerProvider()
+    }
+
+    /// The file in which `owner`'s snapshot for the channel named `channelName` is stored. Channel
+    /// names can contain any character, so the name is percent-encoded.
+    internal func fileURL(forChannelName channelName: String, owner: Owner) -> URL {
+        let escapedChannelName = channelName.addingPercentEncoding(withAllowedCharacters: .alphanumerics) ?? channelName
+        return directoryURL
+            .appendingPathComponent(owner.directoryName, isDirectory: true)
+            .appendingPathComponent("\(escapedChannelName).objects-snapshot")
+    }
+
+    /// Returns the stored snapshot for the channel named `channelName`, or `nil` if there is none or
+    /// it can't be read.
+    internal func readSnapshot(channelName: String, owner: Owner) -> Data? {
+        let fileURL = fileURL(forChannelName: channelName, owner: owner)
+        guard FileManager.default.fileExists(atPath: fileURL.path) else {
+            return nil
+        }
+        do {
+            return try Data(contentsOf: fileURL, options: .alwaysMapped)
+        } catch {
+            logger.log("Failed to read objects snapshot at \(fileURL.path): \(error)", level: .warn)
+            return nil
+        }
+    }
+
+    /// Stores `snapshot` as `owner`'s snapshot for the channel named `channelName`, replacing any
+    /// existing one. The file can only be read while the device is unlocked.
+    internal func writeSnapshot(_ snapshot: Data, channelName: String, owner: Owner) throws {
+        let fileURL = fileURL(forChannelName: channelName, owner: owner)
+        try FileManager.default.createDirectory(at: fileURL.deletingLastPathComponent(), withIntermediateDirectories: true)
+        try snapshot.write(to: fileURL, options: [.atomic, .completeFileProtection])
+    }
+
+    /// Calls ``writeSnapshot(_:channelName:owner:)`` on the store's write queue, logging any failure.
+    internal func scheduleWriteSnapshot(_ snapshot: Data, channelName: String, owner: Owner) {
+        writeQueue.async { [self] in
+            do {
+                try writeSnapshot(snapshot, channelName: channelName, owner: owner)
+                logger.log("Wrote objects snapshot (\(snapshot.count) bytes) for channel \(channelName)", level: .debug)
+            } catch {
+                logger.log("Failed to write objects snapshot for channel \(channelName): \(error)", level: .warn)
+            }
+        }
+    }
+
+    /// Removes `owner`'s stored snapshot for the channel named `channelName`, if any. Scheduled on the
+    /// write queue, so that it takes effect after any pending write.
+    internal func scheduleRemoveSnapshot(channelName: String, owner: Owner) {
+        writeQueue.async { [self] in
+            try? FileManager.default.removeItem(at: fileURL(forChannelName: channelName, owner: owner))
+        }
+    }
+}
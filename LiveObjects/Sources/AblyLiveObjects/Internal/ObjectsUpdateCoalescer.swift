@@ -0,0 +1,71 @@
+internal import _AblyPluginSupportPrivate
+
+/// Gathers the updates that applying a batch of operations produces, so that each updated object
+/// emits a single merged update to its subscribers (RTLO4b4c3a) and makes a single RTO24b dispatch to
+/// path subscriptions, instead of doing so once per operation. See
+/// ``LiveObjectsUpdateCoalescing`` for when a batch starts and ends.
+///
+/// While an ``ObjectsPool`` holds a coalescer (``ObjectsPool/updateCoalescer``), an object that
+/// applies an operation merges the update into the one it holds back (see
+/// ``LiveObjectMutableState/coalesce(_:)``) instead of emitting it, and records itself here. The
+/// path-event keys are recorded here directly. Flushing the coalescer then has each recorded object
+/// emit, in the order in which they were first updated.
+///
+/// ## Concurrency
+///
+/// Queue-confined, like the ``ObjectsPool`` that holds it: every method is `nosync_` and must be
+/// called on the objects engine's internal serial queue. There is no lock.
+@available(macOS 11.0, iOS 14.0, tvOS 14.0, *)
+internal final class ObjectsUpdateCoalescer: @unchecked Sendable {
+    /// What an object's flush needs.
+    internal struct PendingObject {
+        internal let objectID: String
+        /// Whether the object holds back an update for its instance subscribers.
+        internal fileprivate(set) var hasCoalescedUpdate = false
+        /// The union of the changed map keys of the coalesced path events, in the order in which they
+        /// first changed; `nil` if there is no path event to dispatch.
+        internal fileprivate(set) var changedMapKeysForPathEvent: [String]?
+        /// The source message of the latest coalesced path event.
+        internal fileprivate(set) var objectMessage: ProtocolTypes.InboundObjectMessage?
+        fileprivate var changedMapKeySet: Set<String> = []
+    }
+
+    private nonisolated(unsafe) var pendingObjects: [PendingObject] = []
+    private nonisolated(unsafe) var pendingObjectIndexByObjectID: [String: Int] = [:]
+
+    /// The objects with something to flush, in the order in which they were first updated.
+    internal var nosync_pendingObjects: [PendingObject] {
+        pendingObjects
+    }
+
+    /// Records that the object identified by `objectID` holds back an update to emit on flush.
+    internal func nosync_addCoalescedUpdate(objectID: String) {
+        withPendingObject(objectID: objectID) { pendingObject in
+            pendingObject.hasCoalescedUpdate = true
+        }
+    }
+
+    /// Records an RTO24b path event for the object identified by `objectID`, merging it with any
+    /// already recorded for that object.
+    internal func nosync_addPathEvent(objectID: String, changedMapKeys: [String], objectMessage: ProtocolTypes.InboundObjectMessage) {
+        withPendingObject(objectID: objectID) { pendingObject in
+            var keys = pendingObject.changedMapKeysForPathEvent ?? []
+            for key in changedMapKeys where pendingObject.changedMapKeySet.insert(key).inserted {
+                keys.append(key)
+            }
+            pendingObject.changedMapKeysForPathEvent = keys
+            pendingObject.objectMessage = objectMessage
+        }
+    }
+
+    private func withPendingObject(objectID: String, _ body: (inout PendingObject) -> Void) {
+        if let index = pendingObjectIndexByObjectID[objectID] {
+            body(&pendingObjects[index])
+        } else {
+            var pendingObject = PendingObject(objectID: objectID)
+            body(&pendingObject)
+            pendingObjectIndexByObjectID[objectID] = pendingObjects.count
+            pendingObjects.append(pendingObject)
+        }
+    }
+}
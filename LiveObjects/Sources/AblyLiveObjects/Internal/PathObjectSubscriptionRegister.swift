@@ -11,7 +11,13 @@ import Foundation
 /// enforced by `dispatchPrecondition`. Subscriptions are registered from public callers via a hop
 /// onto that queue (see ``DefaultPathObject/subscribe(options:listener:)``); dispatch already runs on
 /// it (path notification happens inside the inbound-message apply path). There is **no lock**: the
-/// mutable `subscriptions` map is plain queue-confined state.
+/// subscription trie is plain queue-confined state.
+///
+/// ## Dispatch cost
+///
+/// Subscriptions are stored in a trie keyed by path segment, so a path event visits only the trie
+/// nodes along each candidate path and the subscriptions stored on them: O(depth + matches) per
+/// candidate, however many subscriptions are registered elsewhere in the tree.
 ///
 /// Listener callbacks are emitted on `userCallbackQueue`, never while holding any mutex — the
 /// off-lock dispatch convention that avoids re-entrancy when a callback calls back into the SDK
@@ -35,23 +41,36 @@ internal final class PathObjectSubscriptionRegister: @unchecked Sendable {
     /// effectively dead and the event is dropped.
     internal typealias PathObjectFactory = @Sendable (_ segments: [String]) -> (any PathObject)?
 
-    /// A single registration: the EventEmitter-`Listener` analogue plus its coverage state.
+    /// A single registration: the EventEmitter-`Listener` analogue plus its coverage state. Its
+    /// stored path (RTPO19f) is the path of the trie node that holds it.
     private struct PathSubscription {
-        /// The subscription's stored path, as segments (copied at subscribe time). RTPO19f.
-        internal let segments: [String]
         /// The RTPO19c1 depth window; `nil` means infinite depth.
         internal let depth: Int?
         internal let listener: PathObjectSubscriptionCallback
         internal let makePathObject: PathObjectFactory
     }
 
+    /// A trie node: the subscriptions whose stored path leads to this node, and the nodes one
+    /// segment deeper. Nodes that hold no subscriptions and have no children are pruned.
+    private final class TrieNode {
+        internal var subscriptions: [UUID: PathSubscription] = [:]
+        internal var children: [String: TrieNode] = [:]
+
+        internal var isEmpty: Bool {
+            subscriptions.isEmpty && children.isEmpty
+        }
+    }
+
     private let internalQueue: DispatchQueue
     private let userCallbackQueue: DispatchQueue
 
-    /// Queue-confined registrations, keyed by an identity token used for deregistration. Identity
-    /// keying (rather than value equality) ensures `nosync_unsubscribe` removes exactly the intended
-    /// registration.
-    private nonisolated(unsafe) var subscriptions: [UUID: PathSubscription] = [:]
+    /// Queue-confined registrations, in a trie keyed by path segment. Within a node they are keyed
+    /// by an identity token used for deregistration. Identity keying (rather than value equality)
+    /// ensures `nosync_unsubscribe` removes exactly the intended registration.
+    private nonisolated(unsafe) var root = TrieNode()
+
+    /// The stored path of each registration, to find its trie node on deregistration.
+    private nonisolated(unsafe) var segmentsBySubscriptionID: [UUID: [String]] = [:]
 
     internal init(internalQueue: DispatchQueue, userCallbackQueue: DispatchQueue) {
         self.internalQueue = internalQueue
@@ -83,7 +102,18 @@ internal final class PathObjectSubscriptionRegister: @unchecked Sendable {
     ) -> any Subscription {
         dispatchPrecondition(condition: .onQueue(internalQueue))
         let id = UUID()
-        subscriptions[id] = .init(segments: segments, depth: depth, listener: listener, makePathObject: makePathObject)
+        var node = root
+        for segment in segments {
+            if let child = node.children[segment] {
+                node = child
+            } else {
+                let child = TrieNode()
+                node.children[segment] = child
+                node = child
+            }
+        }
+        node.subscriptions[id] = .init(depth: depth, listener: listener, makePathObject: makePathObject)
+        segmentsBySubscriptionID[id] = segments
         let internalQueue = internalQueue
         return ClosureSubscription { [weak self] in
             // SUB2a/SUB2b: hop onto the internal queue to deregister; idempotent (a missing id is a
@@ -98,7 +128,22 @@ internal final class PathObjectSubscriptionRegister: @unchecked Sendable {
     /// returned `Subscription`'s unsubscribe contract); reverses the RTPO19f registration.
     internal func nosync_unsubscribe(id: UUID) {
         dispatchPrecondition(condition: .onQueue(internalQueue))
-        subscriptions.removeValue(forKey: id)
+        guard let segments = segmentsBySubscriptionID.removeValue(forKey: id) else {
+            return
+        }
+        var nodes = [root]
+        for segment in segments {
+            guard let child = nodes[nodes.count - 1].children[segment] else {
+                return
+            }
+            nodes.append(child)
+        }
+        nodes[nodes.count - 1].subscriptions.removeValue(forKey: id)
+
+        // Prune the nodes that no longer lead to any subscription, deepest first
+        for index in stride(from: segments.count, to: 0, by: -1) where nodes[index].isEmpty {
+            nodes[index - 1].children.removeValue(forKey: segments[index - 1])
+        }
     }
 
     /// Dispatches one path event: each subscription covering any candidate path is notified at most
@@ -110,19 +155,35 @@ internal final class PathObjectSubscriptionRegister: @unchecked Sendable {
     /// Spec: RTO24b2b, RTO24c1.
     internal func nosync_notifyPathEvent(candidatePaths: [[String]], message: ObjectMessage?) {
         dispatchPrecondition(condition: .onQueue(internalQueue))
-        for subscription in subscriptions.values {
-            // RTO24b2b: first (most-preferred) covered candidate, or skip this subscription.
-            guard let chosen = candidatePaths.first(where: { Self.covers(subscription, eventPath: $0) }) else {
-                continue
-            }
-            // The captured context may have been released; drop the event if so (dead subscription).
-            guard let object = subscription.makePathObject(chosen) else {
-                continue
-            }
-            let event = PathObjectSubscriptionEvent(object: object, message: message)
-            let listener = subscription.listener
-            userCallbackQueue.async {
-                listener(event)
+        // RTO24b2b: each subscription at its first (most-preferred) covered candidate, so
+        // candidates are visited in order and a subscription already notified is skipped.
+        var notifiedIDs = Set<UUID>()
+        for candidate in candidatePaths {
+            // The subscriptions on the nodes along the candidate are those whose stored path is a
+            // prefix of it (RTO24c1)
+            var node: TrieNode? = root
+            var prefixLength = 0
+            while let current = node {
+                for (id, subscription) in current.subscriptions where !notifiedIDs.contains(id) {
+                    guard Self.isWithinDepth(subscription, prefixLength: prefixLength, eventPath: candidate) else {
+                        continue
+                    }
+                    notifiedIDs.insert(id)
+                    // The captured context may have been released; drop the event if so (dead subscription).
+                    guard let object = subscription.makePathObject(candidate) else {
+                        continue
+                    }
+                    let event = PathObjectSubscriptionEvent(object: object, message: message)
+                    let listener = subscription.listener
+                    userCallbackQueue.async {
+                        listener(event)
+                    }
+                }
+                guard prefixLength < candidate.count else {
+                    break
+                }
+                node = current.children[candidate[prefixLength]]
+                prefixLength += 1
             }
         }
     }
@@ -130,23 +191,31 @@ internal final class PathObjectSubscriptionRegister: @unchecked Sendable {
     /// Drops all subscriptions. Called when the owning ``RealtimeObject`` is disposed.
     internal func nosync_dispose() {
         dispatchPrecondition(condition: .onQueue(internalQueue))
-        subscriptions.removeAll()
+        root = TrieNode()
+        segmentsBySubscriptionID.removeAll()
     }
 
-    /// A subscription covers `eventPath` iff its stored path is a prefix of it (exact match included)
-    /// and the relative depth is within the subscription's depth window. Spec: RTO24c1.
-    private static func covers(_ subscription: PathSubscription, eventPath: [String]) -> Bool {
-        let subPath = subscription.segments
-        if subPath.count > eventPath.count {
-            return false
-        }
-        for i in subPath.indices where eventPath[i] != subPath[i] {
-            return false
+    /// The number of registered subscriptions, and of trie nodes other than the root, for tests.
+    internal var nosync_counts: (subscriptions: Int, nodes: Int) {
+        dispatchPrecondition(condition: .onQueue(internalQueue))
+        var nodes = 0
+        var pending = Array(root.children.values)
+        while let node = pending.popLast() {
+            nodes += 1
+            pending.append(contentsOf: node.children.values)
         }
+        return (subscriptions: segmentsBySubscriptionID.count, nodes: nodes)
+    }
+
+    /// A subscription covers `eventPath` iff its stored path is a prefix of it (exact match included)
+    /// and the relative depth is within the subscription's depth window. This checks the depth
+    /// window of a subscription whose stored path, of length `prefixLength`, is known to be a prefix
+    /// of `eventPath`. Spec: RTO24c1.
+    private static func isWithinDepth(_ subscription: PathSubscription, prefixLength: Int, eventPath: [String]) -> Bool {
         guard let depth = subscription.depth else {
             return true // nil = infinite depth
         }
-        return eventPath.count - subPath.count + 1 <= depth
+        return eventPath.count - prefixLength + 1 <= depth
     }
 }
 
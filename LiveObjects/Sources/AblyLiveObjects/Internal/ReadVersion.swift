@@ -0,0 +1,26 @@
+/// A number that is incremented whenever something that a LiveObject read depends on changes, so
+/// that an object can tell off the internal queue whether the values it last read on the queue are
+/// still current.
+///
+/// Each object has one for its own data. The objects in an ``ObjectsPool`` also share the pool's,
+/// which is incremented when an object joins or leaves the pool, when an object in it is tombstoned
+/// and when the channel state changes. These are the only changes to other objects, or to the
+/// channel, that can change the result of reading an object.
+///
+/// ## Concurrency
+///
+/// Only incremented on an objects engine's internal queue; ``current`` can be read from any thread.
+@available(macOS 11.0, iOS 14.0, tvOS 14.0, *)
+internal final class ReadVersion: Sendable {
+    private let value = LockedValue<UInt64>(0)
+
+    internal init() {}
+
+    internal var current: UInt64 {
+        value.load()
+    }
+
+    internal func nosync_increment() {
+        value.update { $0 &+ 1 }
+    }
+}
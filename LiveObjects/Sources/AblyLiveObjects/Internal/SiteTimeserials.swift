@@ -0,0 +1,59 @@
+import Foundation
+
+/// An object's RTLO3b `siteTimeserials`: for each site, the serial of the latest operation from that
+/// site that has been applied to the object.
+///
+/// Stored as one small array of site codes and packed serials rather than a dictionary, since an
+/// object rarely has operations from more than a handful of sites. Site codes are short enough for
+/// Swift to store inline, so finding a site compares a couple of words per entry, with no hashing or
+/// shared state. Converted to and from the dictionary in which an `ObjectState` conveys it.
+@available(macOS 11.0, iOS 14.0, tvOS 14.0, *)
+internal struct SiteTimeserials: Equatable, Sendable {
+    private struct Entry {
+        var siteCode: String
+        var timeserial: Timeserial
+    }
+
+    private var entries: [Entry] = []
+
+    internal init() {}
+
+    internal init(_ dictionary: [String: String]) {
+        entries = dictionary.map { siteCode, serial in
+            Entry(siteCode: siteCode, timeserial: .init(serial))
+        }
+    }
+
+    /// The serials keyed by site code, in the form in which an `ObjectState` conveys them.
+    internal var dictionary: [String: String] {
+        Dictionary(uniqueKeysWithValues: entries.map { ($0.siteCode, $0.timeserial.string) })
+    }
+
+    internal var isEmpty: Bool {
+        entries.isEmpty
+    }
+
+    internal subscript(siteCode: String) -> Timeserial? {
+        get {
+            entries.first { $0.siteCode == siteCode }?.timeserial
+        }
+        set {
+            let index = entries.firstIndex { $0.siteCode == siteCode }
+            switch (index, newValue) {
+            case let (index?, newValue?):
+                entries[index].timeserial = newValue
+            case let (index?, nil):
+                entries.remove(at: index)
+            case let (nil, newValue?):
+                entries.append(.init(siteCode: siteCode, timeserial: newValue))
+            case (nil, nil):
+                break
+            }
+        }
+    }
+
+    /// Equal if they have the same serial for each site, regardless of the order in which the sites were added.
+    internal static func == (lhs: Self, rhs: Self) -> Bool {
+        lhs.entries.count == rhs.entries.count && lhs.entries.allSatisfy { rhs[$0.siteCode] == $0.timeserial }
+    }
+}
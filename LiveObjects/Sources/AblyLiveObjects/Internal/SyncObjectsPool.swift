@@ -3,15 +3,26 @@ import Foundation
 /// The RTO5f collection of objects gathered during an `OBJECT_SYNC` sequence, ready to be applied to the `ObjectsPool`.
 ///
 /// Every stored message is guaranteed to have a non-nil `.object` with either `.map` or `.counter` populated.
+///
+/// The server may split a large map across many `OBJECT_SYNC` messages (RTO5f2a2). So that accumulating such a map
+/// costs time linear in its number of entries, rather than copying everything gathered so far for every partial
+/// message, the entries of a map are gathered into a per-object builder, which is only joined with the map's message
+/// when the message is read.
 @available(macOS 11.0, iOS 14.0, tvOS 14.0, *)
 internal struct SyncObjectsPool: Collection {
     /// Keyed by `objectId`. Every value has a non-nil `.object` with either `.map` or `.counter` populated; the
-    /// `accumulate` method enforces this invariant.
+    /// `accumulate` method enforces this invariant. A message whose `objectId` is a key of `mapEntriesBuilders` has had
+    /// its `.map.entries` moved there.
     private var objectMessages: [String: ProtocolTypes.InboundObjectMessage]
 
+    /// Keyed by `objectId`. The entries merged so far from the partial messages of a map (RTO5f2a2), which are merged
+    /// into in place.
+    private var mapEntriesBuilders: [String: [String: ProtocolTypes.ObjectsMapEntry]]
+
     /// Creates an empty pool.
     internal init() {
         objectMessages = [:]
+        mapEntriesBuilders = [:]
     }
 
     /// Accumulates object messages into the pool per RTO5f.
@@ -38,32 +49,31 @@ internal struct SyncObjectsPool: Collection {
 
         let objectId = object.objectId
 
-        if let existing = objectMessages[objectId] {
+        if let existingObject = objectMessages[objectId]?.object {
             // RTO5f2: An entry already exists for this objectId (partial object state).
             if object.map != nil {
                 // RTO5f2a: Incoming message has a map.
                 if object.tombstone {
                     // RTO5f2a1: Incoming tombstone is true — replace the entire entry.
-                    objectMessages[objectId] = objectMessage
+                    store(objectMessage)
                 } else {
                     // RTO5f2a2: Merge map entries into the existing message.
-                    var merged = existing
                     if let incomingEntries = object.map?.entries {
-                        var mergedObject = merged.object!
-                        guard var mergedMap = mergedObject.map else {
+                        guard existingObject.map != nil else {
                             // Not a specified scenario — the server won't send a map and a non-map for the same
                             // objectId in practice. Guard defensively rather than force-unwrapping.
                             logger.log("Existing entry for objectId \(objectId) is not a map; replacing with incoming message", level: .error)
-                            objectMessages[objectId] = objectMessage
+                            store(objectMessage)
                             return
                         }
-                        var mergedEntries = mergedMap.entries ?? [:]
-                        mergedEntries.merge(incomingEntries) { _, new in new }
-                        mergedMap.entries = mergedEntries
-                        mergedObject.map = mergedMap
-                        merged.object = mergedObject
+                        if mapEntriesBuilders[objectId] == nil {
+                            // The first partial message for this map: move its entries into a builder.
+                            mapEntriesBuilders[objectId] = existingObject.map?.entries ?? [:]
+                            objectMessages[objectId]?.object?.map?.entries = nil
+                        }
+                        // Merged in place, since nothing else references the builder's storage.
+                        mapEntriesBuilders[objectId, default: [:]].merge(incomingEntries) { _, new in new }
                     }
-                    objectMessages[objectId] = merged
                 }
             } else {
                 // RTO5f2b: Incoming message has a counter — log error, skip.
@@ -71,8 +81,26 @@ internal struct SyncObjectsPool: Collection {
             }
         } else {
             // RTO5f1: No entry exists for this objectId — store the message.
-            objectMessages[objectId] = objectMessage
+            store(objectMessage)
+        }
+    }
+
+    /// Stores `objectMessage` as the message for its object, discarding any entries accumulated for it.
+    private mutating func store(_ objectMessage: ProtocolTypes.InboundObjectMessage) {
+        // Only called with a message that has an `.object`
+        let objectId = objectMessage.object!.objectId
+        objectMessages[objectId] = objectMessage
+        mapEntriesBuilders.removeValue(forKey: objectId)
+    }
+
+    /// Joins a stored message with the entries gathered in its map's builder, if it has one. Doesn't copy the entries.
+    private func finalized(_ objectMessage: ProtocolTypes.InboundObjectMessage) -> ProtocolTypes.InboundObjectMessage {
+        guard let objectId = objectMessage.object?.objectId, let entries = mapEntriesBuilders[objectId] else {
+            return objectMessage
         }
+        var finalized = objectMessage
+        finalized.object?.map?.entries = entries
+        return finalized
     }
 
     // MARK: - Collection conformance
@@ -83,5 +111,5 @@ internal struct SyncObjectsPool: Collection {
     internal var startIndex: Index { objectMessages.values.startIndex }
     internal var endIndex: Index { objectMessages.values.endIndex }
     internal func index(after i: Index) -> Index { objectMessages.values.index(after: i) }
-    internal subscript(position: Index) -> Element { objectMessages.values[position] }
+    internal subscript(position: Index) -> Element { finalized(objectMessages.values[position]) }
 }
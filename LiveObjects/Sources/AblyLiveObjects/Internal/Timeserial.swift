@@ -0,0 +1,73 @@
+/// A serial (for example an `ObjectMessage`'s `serial`, or a `siteTimeserials` value) in a form that
+/// can be compared lexicographically (RTLO4a6) without walking the string in most cases.
+///
+/// The serial's first 16 UTF-8 bytes are packed, big-endian and zero-padded, into two integers, so
+/// that comparing the integers compares those bytes, and only the bytes after them are kept as a
+/// string. Serials start with a zero-padded millisecond timestamp, so two serials usually differ
+/// within the packed bytes; only when they don't are the rest compared.
+///
+/// Comparison is by UTF-8 byte, which for the ASCII serials that Ably generates is the same as
+/// comparing the strings. Splitting the serial at a byte offset and padding it with zeros rely on it
+/// being ASCII without NUL characters, as Ably's always are.
+@available(macOS 11.0, iOS 14.0, tvOS 14.0, *)
+internal struct Timeserial: Sendable, Comparable, CustomStringConvertible {
+    private let head0: UInt64
+    private let head1: UInt64
+    /// The serial after its first 16 UTF-8 bytes.
+    private let tail: String
+
+    internal init(_ string: String) {
+        var head0: UInt64 = 0
+        var head1: UInt64 = 0
+        for (index, byte) in string.utf8.prefix(16).enumerated() {
+            if index < 8 {
+                head0 |= UInt64(byte) << (56 - 8 * index)
+            } else {
+                head1 |= UInt64(byte) << (56 - 8 * (index - 8))
+            }
+        }
+        self.head0 = head0
+        self.head1 = head1
+        tail = String(decoding: string.utf8.dropFirst(16), as: UTF8.self)
+    }
+
+    /// The serial, rebuilt from its packed bytes and its tail. Only needed when converting to the form
+    /// in which an `ObjectState` conveys it.
+    internal var string: String {
+        var bytes: [UInt8] = []
+        bytes.reserveCapacity(16 + tail.utf8.count)
+        for head in [head0, head1] {
+            for shift in stride(from: 56, through: 0, by: -8) {
+                let byte = UInt8(truncatingIfNeeded: head >> UInt64(shift))
+                guard byte != 0 else {
+                    return String(decoding: bytes, as: UTF8.self)
+                }
+                bytes.append(byte)
+            }
+        }
+        bytes.append(contentsOf: tail.utf8)
+        return String(decoding: bytes, as: UTF8.self)
+    }
+
+    internal var isEmpty: Bool {
+        head0 == 0
+    }
+
+    internal var description: String {
+        string
+    }
+
+    internal static func == (lhs: Self, rhs: Self) -> Bool {
+        lhs.head0 == rhs.head0 && lhs.head1 == rhs.head1 && lhs.tail.utf8.elementsEqual(rhs.tail.utf8)
+    }
+
+    internal static func < (lhs: Self, rhs: Self) -> Bool {
+        if lhs.head0 != rhs.head0 {
+            return lhs.head0 < rhs.head0
+        }
+        if lhs.head1 != rhs.head1 {
+            return lhs.head1 < rhs.head1
+        }
+        return lhs.tail.utf8.lexicographicallyPrecedes(rhs.tail.utf8)
+    }
+}
@@ -0,0 +1,144 @@
+import Foundation
+
+/// A min-heap of elements ordered by the time at which they were tombstoned, which lets the RTO10
+/// garbage collection find the tombstoned objects and map entries whose grace period has elapsed
+/// without visiting any of those whose grace period hasn't.
+///
+/// Each element is queued at most once, at the earliest time it has been scheduled at. Scheduling is
+/// a hint rather than a record of the element's state: whoever pops an element must check that it is
+/// still tombstoned and, if it was since tombstoned again (at a later time), schedule it again.
+@available(macOS 11.0, iOS 14.0, tvOS 14.0, *)
+internal struct TombstoneQueue<Element: Hashable> {
+    private struct Item {
+        let tombstonedAt: Date
+        let element: Element
+    }
+
+    /// A binary min-heap on `tombstonedAt`. May contain stale items, which are those that don't match
+    /// `scheduledTombstonedAt`; they are dropped as they reach the top.
+    private var heap: [Item] = []
+
+    /// The time at which each queued element is scheduled.
+    private var scheduledTombstonedAt: [Element: Date] = [:]
+
+    /// The number of queued elements.
+    internal var count: Int {
+        scheduledTombstonedAt.count
+    }
+
+    internal var isEmpty: Bool {
+        scheduledTombstonedAt.isEmpty
+    }
+
+    /// The earliest time at which a queued element is scheduled, or `nil` if the queue is empty.
+    internal var earliestTombstonedAt: Date? {
+        mutating get {
+            dropStaleItems()
+            return heap.first?.tombstonedAt
+        }
+    }
+
+    /// Queues `element` at `tombstonedAt`, unless it is already queued at or before that time.
+    internal mutating func schedule(_ element: Element, tombstonedAt: Date) {
+        if let scheduled = scheduledTombstonedAt[element], scheduled <= tombstonedAt {
+            return
+        }
+        scheduledTombstonedAt[element] = tombstonedAt
+        heap.append(.init(tombstonedAt: tombstonedAt, element: element))
+        siftUp(from: heap.count - 1)
+    }
+
+    /// Removes and returns the element scheduled earliest, if it is scheduled at or before `cutoff`.
+    internal mutating func popElement(tombstonedAtOrBefore cutoff: Date) -> Element? {
+        dropStaleItems()
+        guard let top = heap.first, top.tombstonedAt <= cutoff else {
+            return nil
+        }
+        removeTop()
+        scheduledTombstonedAt.removeValue(forKey: top.element)
+        return top.element
+    }
+
+    internal mutating func removeAll() {
+        heap.removeAll()
+        scheduledTombstonedAt.removeAll()
+    }
+
+    // MARK: - Heap
+
+    private mutating func dropStaleItems() {
+        while let top = heap.first, scheduledTombstonedAt[top.element] != top.tombstonedAt {
+            removeTop()
+        }
+    }
+
+    private mutating func removeTop() {
+        let last = heap.removeLast()
+        guard !heap.isEmpty else {
+            return
+        }
+        heap[0] = last
+        siftDown(from: 0)
+    }
+
+    private mutating func siftUp(from index: Int) {
+        var child = index
+        while child > 0 {
+            let parent = (child - 1) / 2
+            guard heap[child].tombstonedAt < heap[parent].tombstonedAt else {
+                return
+            }
+            heap.swapAt(child, parent)
+            child = parent
+        }
+    }
+
+    private mutating func siftDown(from index: Int) {
+        var parent = index
+        while true {
+            let left = 2 * parent + 1
+            let right = left + 1
+            var smallest = parent
+            if left < heap.count, heap[left].tombstonedAt < heap[smallest].tombstonedAt {
+                smallest = left
+            }
+            if right < heap.count, heap[right].tombstonedAt < heap[smallest].tombstonedAt {
+                smallest = right
+            }
+            guard smallest != parent else {
+                return
+            }
+            heap.swapAt(parent, smallest)
+            parent = smallest
+        }
+    }
+}
+
+/// The ``TombstoneQueue`` of the objects in an ``ObjectsPool`` that have a tombstone to garbage
+/// collect: either the object's own (RTO10c1b) or, for a map, one of its entries' (RTO10c1a). An
+/// object is scheduled at the earliest of those times.
+///
+/// A reference type so that the objects in the pool can schedule themselves on it when they, or their
+/// entries, are tombstoned; see ``LiveObjectMutableState/garbageCollectionQueue``.
+///
+/// ## Concurrency
+///
+/// Queue-confined, like the ``ObjectsPool`` that owns it: every method is `nosync_` and must be
+/// called on the objects engine's internal serial queue. There is no lock.
+@available(macOS 11.0, iOS 14.0, tvOS 14.0, *)
+internal final class ObjectsGarbageCollectionQueue: @unchecked Sendable {
+    private nonisolated(unsafe) var queue = TombstoneQueue<String>()
+
+    /// The number of queued objects, for tests.
+    internal var nosync_count: Int {
+        queue.count
+    }
+
+    internal func nosync_schedule(objectID: String, tombstonedAt: Date) {
+        queue.schedule(objectID, tombstonedAt: tombstonedAt)
+    }
+
+    internal func nosync_popObjectID(tombstonedAtOrBefore cutoff: Date) -> String? {
+        queue.popElement(tombstonedAtOrBefore: cutoff)
+    }
+}
@@ -27,6 +27,11 @@ internal final class DefaultLiveCounterInstance: LiveCounterInstance {
         id = node.objectID
     }
 
+    /// Whether the wrapped counter is one of `realtimeObjects`'s, that is, of its channel.
+    internal func belongs(to realtimeObjects: InternalDefaultRealtimeObjects) -> Bool {
+        self.realtimeObjects === realtimeObjects
+    }
+
     // MARK: - LiveCounterInstance
 
     internal var value: Double {
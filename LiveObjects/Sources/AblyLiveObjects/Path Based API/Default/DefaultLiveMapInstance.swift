@@ -27,6 +27,11 @@ internal final class DefaultLiveMapInstance: LiveMapInstance {
         id = node.objectID
     }
 
+    /// Whether the wrapped map is one of `realtimeObjects`'s, that is, of its channel.
+    internal func belongs(to realtimeObjects: InternalDefaultRealtimeObjects) -> Bool {
+        self.realtimeObjects === realtimeObjects
+    }
+
     // MARK: - LiveMapInstance
 
     internal func get(key: String) throws(ARTErrorInfo) -> Instance? {
@@ -0,0 +1,94 @@
+import Ably
+
+/// A group of operations on a channel's objects that ``RealtimeObject/batch(_:)`` publishes together.
+///
+/// The operations are sent in a single `OBJECT` ProtocolMessage and acknowledged together, so
+/// updating many keys costs one publish instead of one per key. Once acknowledged, they are applied to
+/// the local objects in a single step, so a read of the objects never sees some of them applied and
+/// others not. Subscribers are still called once for each operation, as they would be if the
+/// operations were published one at a time.
+///
+/// The operations are applied in the order in which they are added. Every instance that an operation
+/// is added for must belong to the channel of the ``RealtimeObject`` whose ``RealtimeObject/batch(_:)``
+/// created the batch.
+@available(macOS 11.0, iOS 14.0, tvOS 14.0, *)
+public struct LiveObjectsBatch: Sendable {
+    internal enum Operation: Sendable {
+        case mapSet(map: any LiveMapInstance, key: String, value: LiveMapValue)
+        case mapRemove(map: any LiveMapInstance, key: String)
+        case counterIncrement(counter: any LiveCounterInstance, amount: Double)
+    }
+
+    internal private(set) var operations: [Operation] = []
+
+    internal init() {}
+
+    /// Whether no operations have been added.
+    public var isEmpty: Bool {
+        operations.isEmpty
+    }
+
+    /// Adds an operation to set `key` to `value` on `map`, as ``LiveMapInstance/set(key:value:)`` would.
+    public mutating func set(key: String, value: LiveMapValue, on map: any LiveMapInstance) {
+        operations.append(.mapSet(map: map, key: key, value: value))
+    }
+
+    /// Adds an operation to set each key of `entries` to its value on `map`.
+    public mutating func set(_ entries: [String: LiveMapValue], on map: any LiveMapInstance) {
+        operations.append(contentsOf: entries.map { key, value in
+            .mapSet(map: map, key: key, value: value)
+        })
+    }
+
+    /// Adds an operation to remove `key` from `map`, as ``LiveMapInstance/remove(key:)`` would.
+    public mutating func remove(key: String, from map: any LiveMapInstance) {
+        operations.append(.mapRemove(map: map, key: key))
+    }
+
+    /// Adds an operation to increment `counter` by `amount`, as
+    /// ``LiveCounterInstance/increment(amount:)`` would.
+    public mutating func increment(_ counter: any LiveCounterInstance, by amount: Double = 1) {
+        operations.append(.counterIncrement(counter: counter, amount: amount))
+    }
+
+    /// Adds an operation to decrement `counter` by `amount`, as
+    /// ``LiveCounterInstance/decrement(amount:)`` would.
+    public mutating func decrement(_ counter: any LiveCounterInstance, by amount: Double = 1) {
+        increment(counter, by: -amount)
+    }
+}
+
+@available(macOS 11.0, iOS 14.0, tvOS 14.0, *)
+internal extension LiveObjectsBatch.Operation {
+    /// The `objectId` of the object that the operation is on.
+    var objectID: String {
+        switch self {
+        case let .mapSet(map, _, _), let .mapRemove(map, _):
+            map.id
+        case let .counterIncrement(counter, _):
+            counter.id
+        }
+    }
+
+    /// Whether the instance that the operation is on belongs to `realtimeObjects`, that is, to its channel.
+    func belongs(to realtimeObjects: InternalDefaultRealtimeObjects) -> Bool {
+        switch self {
+        case let .mapSet(map, _, _), let .mapRemove(map, _):
+            (map as? DefaultLiveMapInstance)?.belongs(to: realtimeObjects) ?? false
+        case let .counterIncrement(counter, _):
+            (counter as? DefaultLiveCounterInstance)?.belongs(to: realtimeObjects) ?? false
+        }
+    }
+
+    /// Performs the operation on its own, through the instance's single-operation method.
+    func perform() async throws(ARTErrorInfo) {
+        switch self {
+        case let .mapSet(map, key, value):
+            try await map.set(key: key, value: value)
+        case let .mapRemove(map, key):
+            try await map.remove(key: key)
+        case let .counterIncrement(counter, amount):
+            try await counter.increment(amount: amount)
+        }
+    }
+}
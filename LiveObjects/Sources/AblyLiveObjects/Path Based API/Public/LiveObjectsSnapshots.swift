@@ -0,0 +1,32 @@
+import Ably
+import Foundation
+
+@available(macOS 11.0, iOS 14.0, tvOS 14.0, *)
+public extension ARTClientOptions {
+    /// A directory in which LiveObjects keeps a snapshot of each channel's objects, or `nil` (the
+    /// default) to keep none.
+    ///
+    /// When set, the objects are written to the directory each time a channel completes a sync. A
+    /// channel that is created later with the same name, for example after the app relaunches, loads
+    /// them straight away, so that ``RealtimeObject/get()`` returns as soon as the channel has
+    /// attached, without waiting for it to sync. Until that sync completes the objects may be out of
+    /// date, and the channel doesn't emit ``ObjectsEvent/synced``; the sync then replaces them,
+    /// emitting updates for whatever has changed, and you can't publish operations until it has.
+    ///
+    /// Snapshots are kept separately for each app and `clientId`, and a client only loads those of its
+    /// own app and `clientId`. A client that doesn't yet know its app when the channel is created (for
+    /// example, one that hasn't yet obtained a token from its `authCallback`) loads none. On iOS, snapshots can't be read while the device is locked. Snapshots are
+    /// never written for a channel with cipher params, since they would store its objects unencrypted.
+    ///
+    /// A snapshot that is older than the objects garbage collection grace period is not used.
+    ///
+    /// Takes effect for the channels that are created after it is set.
+    var liveObjectsSnapshotDirectory: URL? {
+        get {
+            snapshotDirectory
+        }
+        set {
+            snapshotDirectory = newValue
+        }
+    }
+}
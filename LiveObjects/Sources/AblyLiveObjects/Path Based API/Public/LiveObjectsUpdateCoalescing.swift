@@ -0,0 +1,37 @@
+import Ably
+
+/// How LiveObjects delivers the updates caused by the operations that it receives on a channel, set
+/// through ``Ably/ARTClientOptions/liveObjectsUpdateCoalescing``.
+///
+/// When coalescing, the updates that an object receives within a batch are merged into one, so that
+/// each of its subscribers — and each path subscription that covers it — is called once per batch
+/// instead of once per operation. A merged map update reports the latest change to each key, a
+/// merged counter update the sum of the amounts, and the ``ObjectMessage`` is that of the latest
+/// operation in the batch.
+@available(macOS 11.0, iOS 14.0, tvOS 14.0, *)
+public enum LiveObjectsUpdateCoalescing: Sendable, Hashable {
+    /// Each operation's update is delivered as soon as it is applied. The default.
+    case disabled
+    /// The operations in one `OBJECT` ProtocolMessage form a batch.
+    case perProtocolMessage
+    /// The operations received within the given interval of the first form a batch, which trades
+    /// latency for fewer calls when operations arrive in bursts. Operations that this client
+    /// publishes, and which are applied within the interval, join the batch.
+    case window(TimeInterval)
+}
+
+@available(macOS 11.0, iOS 14.0, tvOS 14.0, *)
+public extension ARTClientOptions {
+    /// How LiveObjects delivers the updates caused by the operations that it receives on a channel.
+    /// Defaults to ``LiveObjectsUpdateCoalescing/disabled``.
+    ///
+    /// Takes effect for the channels that are created after it is set.
+    var liveObjectsUpdateCoalescing: LiveObjectsUpdateCoalescing {
+        get {
+            updateCoalescing
+        }
+        set {
+            updateCoalescing = newValue
+        }
+    }
+}
@@ -20,6 +20,17 @@ public protocol RealtimeObject: Sendable {
     /// objects are synchronized with the Ably service. Spec: `RTO23`.
     func get() async throws(ARTErrorInfo) -> any LiveMapPathObject
 
+    /// Publishes the operations that `build` adds to a ``LiveObjectsBatch`` in a single `OBJECT`
+    /// ProtocolMessage, returning once they have been acknowledged and applied locally.
+    ///
+    /// Fails without publishing anything if any operation is invalid, if any operation is on an
+    /// instance that belongs to a different channel, or if the operations together exceed the
+    /// connection's maximum message size. Does nothing if `build` adds no operations.
+    ///
+    /// The default implementation, for conforming types other than the SDK's own, performs the
+    /// operations one at a time, in order, through the instances' single-operation methods.
+    func batch(_ build: (inout LiveObjectsBatch) -> Void) async throws(ARTErrorInfo)
+
     /// Registers the provided listener for the specified event.
     ///
     /// To deregister the listener, call ``StatusSubscription/off()`` on the returned subscription.
@@ -32,3 +43,14 @@ public protocol RealtimeObject: Sendable {
     @discardableResult
     func on(event: ObjectsEvent, callback: @escaping @Sendable () -> Void) -> any StatusSubscription
 }
+
+@available(macOS 11.0, iOS 14.0, tvOS 14.0, *)
+public extension RealtimeObject {
+    func batch(_ build: (inout LiveObjectsBatch) -> Void) async throws(ARTErrorInfo) {
+        var batch = LiveObjectsBatch()
+        build(&batch)
+        for operation in batch.operations {
+            try await operation.perform()
+        }
+    }
+}
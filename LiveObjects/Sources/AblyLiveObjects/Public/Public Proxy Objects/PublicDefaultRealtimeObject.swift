@@ -32,7 +32,7 @@ internal final class PublicDefaultRealtimeObject: RealtimeObject {
         // RTL33c (reject FAILED). See ChannelConfigGuards.ensureActiveChannel.
         try await ChannelConfigGuards.ensureActiveChannel(coreSDK: coreSDK, internalQueue: proxied.internalQueue)
         // RTO23c — wait for the initial sync; RTO23c1: if the channel enters DETACHED/SUSPENDED/FAILED while waiting, get() fails with code 92008 (built in InternalDefaultRealtimeObjects.ensureSynced).
-        try await proxied.ensureSynced()
+        try await proxied.ensureSynced(coreSDK: coreSDK)
         // RTO23d / RTTS6d — return a LiveMapPathObject with an empty path (the channel root).
         return DefaultLiveMapPathObject(
             channelObject: proxied,
@@ -42,6 +42,21 @@ internal final class PublicDefaultRealtimeObject: RealtimeObject {
         )
     }
 
+    internal func batch(_ build: (inout LiveObjectsBatch) -> Void) async throws(ARTErrorInfo) {
+        var batch = LiveObjectsBatch()
+        build(&batch)
+        guard !batch.isEmpty else {
+            return
+        }
+        // An instance of another channel's objects can't be published on this channel
+        if let foreign = batch.operations.first(where: { !$0.belongs(to: proxied) }) {
+            throw LiveObjectsError.invalidInput(message: "RealtimeObject.batch: object \(foreign.objectID) does not belong to this channel").toARTErrorInfo()
+        }
+        // RTO26 — the same write-API preconditions as each of the batched operations on its own.
+        try ChannelConfigGuards.throwIfInvalidWriteApiConfiguration(coreSDK: coreSDK, internalQueue: proxied.internalQueue)
+        try await proxied.publishBatch(batch.operations, coreSDK: coreSDK)
+    }
+
     @discardableResult
     internal func on(event: ObjectsEvent, callback: @escaping @Sendable () -> Void) -> any StatusSubscription {
         // RTO18 — register on the internal engine's status-event emitter, which fires `.syncing` /
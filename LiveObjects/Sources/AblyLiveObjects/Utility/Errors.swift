@@ -221,6 +221,20 @@ extension WireValueDecodingError: ConvertibleToLiveObjectsError {
     }
 }
 
+@available(macOS 11.0, iOS 14.0, tvOS 14.0, *)
+extension WireValue.BinaryDecodingError: ConvertibleToLiveObjectsError {
+    internal func toLiveObjectsError() -> LiveObjectsError {
+        .other(self)
+    }
+}
+
+@available(macOS 11.0, iOS 14.0, tvOS 14.0, *)
+extension ObjectsPoolSnapshot.DecodingError: ConvertibleToLiveObjectsError {
+    internal func toLiveObjectsError() -> LiveObjectsError {
+        .other(self)
+    }
+}
+
 @available(macOS 11.0, iOS 14.0, tvOS 14.0, *)
 extension WireValue.ConversionError: ConvertibleToLiveObjectsError {
     internal func toLiveObjectsError() -> LiveObjectsError {
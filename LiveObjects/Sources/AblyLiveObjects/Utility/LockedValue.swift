@@ -0,0 +1,44 @@
+import Foundation
+
+/// Holds a value that can be read and replaced from any thread, without dispatching to a queue.
+///
+/// The lock is held only while the value is copied in or out, so a reader never waits for longer
+/// than another thread's load or store. (Swift's `Atomic` would avoid even that, but it isn't
+/// available at this library's minimum deployment targets.)
+@available(macOS 11.0, iOS 14.0, tvOS 14.0, *)
+internal final class LockedValue<T: Sendable>: @unchecked Sendable {
+    private let lock = NSLock()
+    private nonisolated(unsafe) var value: T
+
+    internal init(_ initialValue: T) {
+        value = initialValue
+    }
+
+    internal func load() -> T {
+        lock.lock()
+        defer { lock.unlock() }
+        return value
+    }
+
+    internal func store(_ newValue: T) {
+        lock.lock()
+        defer { lock.unlock() }
+        value = newValue
+    }
+
+    /// Replaces the value with the result of `transform`, holding the lock throughout.
+    internal func update(_ transform: (T) -> T) {
+        lock.lock()
+        defer { lock.unlock() }
+        value = transform(value)
+    }
+
+    /// Calls `body` with the value, holding the lock throughout. Unlike ``load()`` and
+    /// ``update(_:)``, doesn't copy the value, so `body` can look up or mutate part of a large value
+    /// in place.
+    internal func withLock<R>(_ body: (inout T) -> R) -> R {
+        lock.lock()
+        defer { lock.unlock() }
+        return body(&value)
+    }
+}
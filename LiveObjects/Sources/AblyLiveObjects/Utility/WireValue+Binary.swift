@@ -0,0 +1,218 @@
+import Ably
+import Foundation
+
+// A compact binary encoding of `WireValue`, used for the data that LiveObjects persists locally (see
+// `ObjectsPoolSnapshot`). It is not a wire format: nothing outside this SDK reads it.
+//
+// Each value is a one-byte tag followed by its payload. Lengths and integers are LEB128 varints, with
+// integers zigzag-encoded first; doubles are their 8-byte little-endian bit pattern. A number is
+// stored as an integer if it is integral and exactly representable as a `Double`, so a number decodes
+// to an `NSNumber` of the same value but not necessarily of the same underlying type.
+
+@available(macOS 11.0, iOS 14.0, tvOS 14.0, *)
+internal extension WireValue {
+    enum BinaryDecodingError: Error {
+        case unexpectedEnd
+        case unknownTag(UInt8)
+        case invalidUTF8String
+        case varintTooLong
+        case trailingBytes
+    }
+
+    private enum BinaryTag: UInt8 {
+        case null = 0
+        case `false` = 1
+        case `true` = 2
+        case integer = 3
+        case double = 4
+        case string = 5
+        case data = 6
+        case array = 7
+        case object = 8
+    }
+
+    /// The largest magnitude below which every integer is exactly representable as a `Double`.
+    private static let maxExactlyRepresentableInteger: Double = 9_007_199_254_740_992 // 2^53
+
+    var binaryEncoded: Data {
+        var data = Data()
+        appendBinaryEncoding(to: &data)
+        return data
+    }
+
+    init(binaryEncoded data: Data) throws(ARTErrorInfo) {
+        do {
+            self = try data.withUnsafeBytes { buffer in
+                var reader = BinaryReader(buffer: buffer)
+                let value = try reader.readValue()
+                guard reader.isAtEnd else {
+                    throw BinaryDecodingError.trailingBytes
+                }
+                return value
+            }
+        } catch let error as BinaryDecodingError {
+            throw error.toARTErrorInfo()
+        } catch {
+            preconditionFailure("Unexpected error \(error)")
+        }
+    }
+
+    private func appendBinaryEncoding(to data: inout Data) {
+        switch self {
+        case .null:
+            data.append(BinaryTag.null.rawValue)
+        case let .bool(bool):
+            data.append((bool ? BinaryTag.true : BinaryTag.false).rawValue)
+        case let .number(number):
+            let double = number.doubleValue
+            if double.rounded(.towardZero) == double, abs(double) < Self.maxExactlyRepresentableInteger {
+                data.append(BinaryTag.integer.rawValue)
+                let integer = Int64(double)
+                Self.appendVarint(UInt64(bitPattern: (integer << 1) ^ (integer >> 63)), to: &data)
+            } else {
+                data.append(BinaryTag.double.rawValue)
+                withUnsafeBytes(of: double.bitPattern.littleEndian) { data.append(contentsOf: $0) }
+            }
+        case let .string(string):
+            data.append(BinaryTag.string.rawValue)
+            Self.appendString(string, to: &data)
+        case let .data(bytes):
+            data.append(BinaryTag.data.rawValue)
+            Self.appendVarint(UInt64(bytes.count), to: &data)
+            data.append(bytes)
+        case let .array(array):
+            data.append(BinaryTag.array.rawValue)
+            Self.appendVarint(UInt64(array.count), to: &data)
+            for element in array {
+                element.appendBinaryEncoding(to: &data)
+            }
+        case let .object(object):
+            data.append(BinaryTag.object.rawValue)
+            Self.appendVarint(UInt64(object.count), to: &data)
+            for (key, value) in object {
+                Self.appendString(key, to: &data)
+                value.appendBinaryEncoding(to: &data)
+            }
+        }
+    }
+
+    private static func appendString(_ string: String, to data: inout Data) {
+        let utf8 = string.utf8
+        appendVarint(UInt64(utf8.count), to: &data)
+        data.append(contentsOf: utf8)
+    }
+
+    private static func appendVarint(_ value: UInt64, to data: inout Data) {
+        var remaining = value
+        while remaining >= 0x80 {
+            data.append(UInt8(truncatingIfNeeded: remaining) | 0x80)
+            remaining >>= 7
+        }
+        data.append(UInt8(remaining))
+    }
+
+    private struct BinaryReader {
+        let buffer: UnsafeRawBufferPointer
+        var offset = 0
+
+        var isAtEnd: Bool {
+            offset == buffer.count
+        }
+
+        mutating func readValue() throws(BinaryDecodingError) -> WireValue {
+            let tagByte = try readByte()
+            guard let tag = BinaryTag(rawValue: tagByte) else {
+                throw .unknownTag(tagByte)
+            }
+
+            switch tag {
+            case .null:
+                return .null
+            case .false:
+                return .bool(false)
+            case .true:
+                return .bool(true)
+            case .integer:
+                let zigzag = try readVarint()
+                let integer = Int64(bitPattern: zigzag >> 1) ^ -Int64(bitPattern: zigzag & 1)
+                return .number(NSNumber(value: integer))
+            case .double:
+                let bytes = try readBytes(count: 8)
+                var bitPattern: UInt64 = 0
+                withUnsafeMutableBytes(of: &bitPattern) { $0.copyMemory(from: bytes) }
+                return .number(NSNumber(value: Double(bitPattern: UInt64(littleEndian: bitPattern))))
+            case .string:
+                return try .string(readString())
+            case .data:
+                let count = try readCount()
+                return try .data(Data(readBytes(count: count)))
+            case .array:
+                let count = try readCount()
+                var array: [WireValue] = []
+                array.reserveCapacity(count)
+                for _ in 0 ..< count {
+                    try array.append(readValue())
+                }
+                return .array(array)
+            case .object:
+                let count = try readCount()
+                var object: [String: WireValue] = [:]
+                object.reserveCapacity(count)
+                for _ in 0 ..< count {
+                    let key = try readString()
+                    object[key] = try readValue()
+                }
+                return .object(object)
+            }
+        }
+
+        private mutating func readByte() throws(BinaryDecodingError) -> UInt8 {
+            guard offset < buffer.count else {
+                throw .unexpectedEnd
+            }
+            defer { offset += 1 }
+            return buffer[offset]
+        }
+
+        private mutating func readBytes(count: Int) throws(BinaryDecodingError) -> UnsafeRawBufferPointer {
+            guard count <= buffer.count - offset else {
+                throw .unexpectedEnd
+            }
+            defer { offset += count }
+            return UnsafeRawBufferPointer(rebasing: buffer[offset ..< offset + count])
+        }
+
+        private mutating func readVarint() throws(BinaryDecodingError) -> UInt64 {
+            var value: UInt64 = 0
+            var shift: UInt64 = 0
+            while true {
+                guard shift < 64 else {
+                    throw .varintTooLong
+                }
+                let byte = try readByte()
+                value |= UInt64(byte & 0x7F) << shift
+                if byte & 0x80 == 0 {
+                    return value
+                }
+                shift += 7
+            }
+        }
+
+        /// Reads a length, which can't exceed the number of bytes left, since each element takes at least one.
+        private mutating func readCount() throws(BinaryDecodingError) -> Int {
+            let count = try readVarint()
+            guard count <= UInt64(buffer.count - offset) else {
+                throw .unexpectedEnd
+            }
+            return Int(count)
+        }
+
+        private mutating func readString() throws(BinaryDecodingError) -> String {
+            let bytes = try readBytes(count: readCount())
+            guard let string = String(bytes: bytes, encoding: .utf8) else {
+                throw .invalidUTF8String
+            }
+            return string
+        }
+    }
+}
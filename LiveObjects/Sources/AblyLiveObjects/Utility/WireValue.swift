@@ -129,28 +129,39 @@ internal extension WireValue {
     /// Creates a `WireValue` from an `_AblyPluginSupportPrivate` deserialized wire object.
     ///
     /// Specifically, `pluginSupportData` can be a value that was passed to `LiveObjectsPlugin.decodeObjectMessage:…`.
+    ///
+    /// This is on the path of every inbound `ObjectMessage`, so it converts in a single pass instead of going via an `ExtendedJSONValue`, whose tree would be built only to be discarded. It must accept the same values as `ExtendedJSONValue(deserialized:…)`.
     init(pluginSupportData: Any) {
-        let extendedJSONValue = ExtendedJSONValue<NSNumber, ExtraValue>(deserialized: pluginSupportData, createNumberValue: { $0 }, createExtraValue: { deserializedExtraValue in
-            // We support binary data (used for MessagePack format) in addition to JSON values
-            if let data = deserializedExtraValue as? Data {
-                return .data(data)
+        switch pluginSupportData {
+        case let dictionary as [String: Any]:
+            self = .object(Self.objectFromPluginSupportData(dictionary))
+        case let array as [Any]:
+            self = .array(array.map { .init(pluginSupportData: $0) })
+        case let string as String:
+            self = .string(string)
+        case let number as NSNumber:
+            // Distinguish booleans from numbers of value 0 or 1, as in `ExtendedJSONValue(deserialized:…)`
+            if number === kCFBooleanTrue {
+                self = .bool(true)
+            } else if number === kCFBooleanFalse {
+                self = .bool(false)
+            } else {
+                self = .number(number)
             }
-
+        case is NSNull:
+            self = .null
+        // We support binary data (used for MessagePack format) in addition to JSON values
+        case let data as Data:
+            self = .data(data)
+        default:
             // ably-cocoa is not conforming to our assumptions; our assumptions are probably wrong. Either way, bring this loudly to our attention instead of trying to carry on
-            preconditionFailure("WireValue(pluginSupportData:) was given unsupported value \(deserializedExtraValue)")
-        })
-
-        self.init(extendedJSONValue: extendedJSONValue)
+            preconditionFailure("WireValue(pluginSupportData:) was given unsupported value \(pluginSupportData)")
+        }
     }
 
     /// Creates a `WireValue` from an `_AblyPluginSupportPrivate` deserialized wire object. Specifically, `pluginSupportData` can be a value that was passed to `LiveObjectsPlugin.decodeObjectMessage:…`.
     static func objectFromPluginSupportData(_ pluginSupportData: [String: Any]) -> [String: WireValue] {
-        let wireValue = WireValue(pluginSupportData: pluginSupportData)
-        guard case let .object(wireObject) = wireValue else {
-            preconditionFailure()
-        }
-
-        return wireObject
+        pluginSupportData.mapValues { .init(pluginSupportData: $0) }
     }
 
     /// Creates an `_AblyPluginSupportPrivate` deserialized wire object from a `WireValue`.
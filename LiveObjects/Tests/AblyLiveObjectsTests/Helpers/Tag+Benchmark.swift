@@ -0,0 +1,11 @@
+import Foundation
+import Testing
+
+extension Tag {
+    /// Tests that measure the performance of a large workload. Long-running, so only enabled when the
+    /// `ABLY_RUN_BENCHMARKS` environment variable is set.
+    @Tag static var benchmark: Self
+}
+
+/// Whether to run the tests tagged ``Tag/benchmark``.
+let isBenchmarkingEnabled = ProcessInfo.processInfo.environment["ABLY_RUN_BENCHMARKS"] != nil
@@ -102,6 +102,18 @@ struct DefaultInternalPluginTests {
             fatalError("not used")
         }
 
+        func nosync_isEncryptedChannel(_: any _AblyPluginSupportPrivate.RealtimeChannel) -> Bool {
+            fatalError("not used")
+        }
+
+        func nosync_appId(for _: any _AblyPluginSupportPrivate.RealtimeClient) -> String? {
+            fatalError("not used")
+        }
+
+        func nosync_clientId(for _: any _AblyPluginSupportPrivate.RealtimeClient) -> String? {
+            fatalError("not used")
+        }
+
         func nosync_connectionStateError(for _: any _AblyPluginSupportPrivate.RealtimeClient) -> (any _AblyPluginSupportPrivate.PublicErrorInfo)? {
             fatalError("not used")
         }
@@ -12,6 +12,8 @@ struct InternalDefaultRealtimeObjectsTests {
     static func createDefaultRealtimeObjects(
         clock: SimpleClock = MockSimpleClock(),
         internalQueue: DispatchQueue = TestFactories.createInternalQueue(),
+        garbageCollectionOptions: InternalDefaultRealtimeObjects.GarbageCollectionOptions = .init(),
+        updateCoalescing: LiveObjectsUpdateCoalescing = .disabled,
     ) -> InternalDefaultRealtimeObjects {
         let logger = TestLogger()
         return InternalDefaultRealtimeObjects(
@@ -20,6 +22,8 @@ struct InternalDefaultRealtimeObjectsTests {
             userCallbackQueue: .main,
             clock: clock,
             channelName: "test-channel",
+            garbageCollectionOptions: garbageCollectionOptions,
+            updateCoalescing: updateCoalescing,
         )
     }
 
@@ -1340,6 +1344,90 @@ struct InternalDefaultRealtimeObjectsTests {
                 #expect(counter.testsOnly_siteTimeserials["site1"] == "ts4")
             }
         }
+
+        struct UpdateCoalescingTests {
+            // With per-ProtocolMessage coalescing, the operations in one OBJECT ProtocolMessage that
+            // update the same object produce a single update, which reports each key's latest change
+            // and carries the latest operation's message.
+            @available(iOS 17.0.0, tvOS 17.0.0, *)
+            @Test
+            func coalescesTheUpdatesOfOneProtocolMessagePerObject() async throws {
+                let internalQueue = TestFactories.createInternalQueue()
+                let realtimeObjects = InternalDefaultRealtimeObjectsTests.createDefaultRealtimeObjects(
+                    internalQueue: internalQueue,
+                    updateCoalescing: .perProtocolMessage,
+                )
+                let coreSDK = MockCoreSDK(channelState: .attached, internalQueue: internalQueue)
+                internalQueue.ably_syncNoDeadlock {
+                    realtimeObjects.nosync_onChannelAttached(hasObjects: false)
+                }
+
+                let root = realtimeObjects.testsOnly_objectsPool.root
+                let rootSubscriber = Subscriber<DefaultLiveMapUpdate, SubscribeResponse>(callbackQueue: .main)
+                try root.subscribe(listener: rootSubscriber.createListener(), coreSDK: coreSDK)
+
+                internalQueue.ably_syncNoDeadlock {
+                    realtimeObjects.nosync_handleObjectProtocolMessage(objectMessages: [
+                        TestFactories.mapSetOperationMessage(objectId: "root", key: "a", value: "1", serial: "ts1"),
+                        TestFactories.mapSetOperationMessage(objectId: "root", key: "b", value: "2", serial: "ts2"),
+                        TestFactories.mapRemoveOperationMessage(objectId: "root", key: "a", serial: "ts3"),
+                    ])
+                }
+
+                let invocations = await rootSubscriber.getInvocations()
+                #expect(invocations.map(\.0.update) == [["a": .removed, "b": .updated]])
+                #expect(invocations.map(\.0.objectMessage?.serial) == ["ts3"])
+
+                // The next ProtocolMessage is a new batch
+                internalQueue.ably_syncNoDeadlock {
+                    realtimeObjects.nosync_handleObjectProtocolMessage(objectMessages: [
+                        TestFactories.mapSetOperationMessage(objectId: "root", key: "c", value: "3", serial: "ts4"),
+                    ])
+                }
+
+                #expect(await rootSubscriber.getInvocations().map(\.0.update) == [["a": .removed, "b": .updated], ["c": .updated]])
+            }
+
+            // An object that garbage collection releases while its update is held back by a coalescing
+            // window emits that update as it leaves the pool, and since it's a tombstone update its
+            // subscriptions are deregistered (RTLO4b4c3c), rather than the update never being emitted.
+            @available(iOS 17.0.0, tvOS 17.0.0, *)
+            @Test
+            func emitsTheHeldBackUpdateOfAnObjectReleasedDuringTheWindow() async throws {
+                let internalQueue = TestFactories.createInternalQueue()
+                let clock = MockSimpleClock()
+                var garbageCollectionOptions = InternalDefaultRealtimeObjects.GarbageCollectionOptions()
+                garbageCollectionOptions.gracePeriod = .fixed(60)
+                let realtimeObjects = InternalDefaultRealtimeObjectsTests.createDefaultRealtimeObjects(
+                    clock: clock,
+                    internalQueue: internalQueue,
+                    garbageCollectionOptions: garbageCollectionOptions,
+                    updateCoalescing: .window(60),
+                )
+                let coreSDK = MockCoreSDK(channelState: .attached, internalQueue: internalQueue)
+                internalQueue.ably_syncNoDeadlock {
+                    realtimeObjects.nosync_onChannelAttached(hasObjects: false)
+                }
+
+                let counter = try #require(realtimeObjects.testsOnly_createZeroValueLiveObject(forObjectID: "counter:1@1")?.counterValue)
+                let counterSubscriber = Subscriber<DefaultLiveCounterUpdate, SubscribeResponse>(callbackQueue: .main)
+                try counter.subscribe(listener: counterSubscriber.createListener(), coreSDK: coreSDK)
+
+                internalQueue.ably_syncNoDeadlock {
+                    // Tombstoned longer ago than the grace period, so the garbage collection below releases it
+                    realtimeObjects.nosync_handleObjectProtocolMessage(objectMessages: [
+                        TestFactories.objectDeleteOperationMessage(objectId: "counter:1@1", serial: "ts1", serialTimestamp: clock.now.addingTimeInterval(-120)),
+                    ])
+                    realtimeObjects.nosync_performGarbageCollection()
+                    // A further emission must not reach the (now-deregistered) subscriber
+                    counter.nosync_emit(.update(.init(amount: 99)))
+                }
+
+                #expect(realtimeObjects.testsOnly_objectsPool.entries["counter:1@1"] == nil)
+                let invocations = await counterSubscriber.getInvocations()
+                #expect(invocations.map(\.0.tombstone) == [true])
+            }
+        }
     }
 
     /// Tests for `InternalDefaultRealtimeObjects.createMap`, covering RTO11 specification points (these are largely a smoke test, the rest being tested in ObjectCreationHelpers tests)
@@ -2275,4 +2363,57 @@ struct InternalDefaultRealtimeObjectsTests {
             #expect(objects == nil)
         }
     }
+
+    /// Tests for `InternalDefaultRealtimeObjects.performGarbageCollection`.
+    struct GarbageCollectionTests {
+        // A garbage collection whose slices are still to run blocks a new one from starting; once they have run, the next garbage collection starts as normal
+        @Test
+        func doesNotStartWhileThePreviousGarbageCollectionHasSlicesStillToRun() throws {
+            let internalQueue = TestFactories.createInternalQueue()
+            let clock = MockSimpleClock()
+            var garbageCollectionOptions = InternalDefaultRealtimeObjects.GarbageCollectionOptions()
+            garbageCollectionOptions.gracePeriod = .fixed(60)
+            // Releases one object per slice
+            garbageCollectionOptions.sliceDuration = 0
+            let realtimeObjects = InternalDefaultRealtimeObjectsTests.createDefaultRealtimeObjects(
+                clock: clock,
+                internalQueue: internalQueue,
+                garbageCollectionOptions: garbageCollectionOptions,
+            )
+
+            let objectIDs = ["counter:expired1@1", "counter:expired2@1", "counter:expired3@1"]
+            for objectID in objectIDs {
+                let counter = try #require(realtimeObjects.testsOnly_createZeroValueLiveObject(forObjectID: objectID)?.counterValue)
+                counter.testsOnly_setTombstonedAt(clock.now.addingTimeInterval(-120))
+            }
+
+            let remainingObjectCount = {
+                objectIDs.count { realtimeObjects.nosync_objectsPool.entries[$0] != nil }
+            }
+
+            // Perform two garbage collections in a row, so that the first one's remaining slices can't run in between
+            let (remainingAfterFirst, remainingAfterSecond) = internalQueue.ably_syncNoDeadlock {
+                realtimeObjects.nosync_performGarbageCollection()
+                let remainingAfterFirst = remainingObjectCount()
+                realtimeObjects.nosync_performGarbageCollection()
+                return (remainingAfterFirst, remainingObjectCount())
+            }
+
+            #expect(remainingAfterFirst == 2)
+            // The second one did nothing, rather than releasing a second object
+            #expect(remainingAfterSecond == 2)
+
+            // Each check waits for its turn on the internal queue, letting the remaining slices run
+            while realtimeObjects.testsOnly_isGarbageCollectionInProgress {}
+
+            #expect(internalQueue.ably_syncNoDeadlock { remainingObjectCount() } == 0)
+
+            // The next garbage collection starts as normal
+            let counter = try #require(realtimeObjects.testsOnly_createZeroValueLiveObject(forObjectID: "counter:expired4@1")?.counterValue)
+            counter.testsOnly_setTombstonedAt(clock.now.addingTimeInterval(-120))
+            realtimeObjects.performGarbageCollection()
+
+            #expect(realtimeObjects.testsOnly_objectsPool.entries["counter:expired4@1"] == nil)
+        }
+    }
 }
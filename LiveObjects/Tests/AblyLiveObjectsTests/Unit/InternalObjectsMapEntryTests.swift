@@ -0,0 +1,106 @@
+@testable import AblyLiveObjects
+import Foundation
+import Testing
+
+struct InternalObjectsMapEntryTests {
+    @Test
+    func dataRoundTrips() {
+        let allData: [ProtocolTypes.ObjectData?] = [
+            nil,
+            ProtocolTypes.ObjectData(),
+            ProtocolTypes.ObjectData(objectId: "map:a@1"),
+            ProtocolTypes.ObjectData(boolean: false),
+            ProtocolTypes.ObjectData(bytes: Data([0, 1, 2])),
+            ProtocolTypes.ObjectData(number: NSNumber(value: 1.5)),
+            ProtocolTypes.ObjectData(number: NSNumber(value: 42)),
+            ProtocolTypes.ObjectData(string: "a string too long to be stored inline in a String"),
+            ProtocolTypes.ObjectData(json: .array([.string("a")])),
+            // Ones that don't fit a single-value case
+            ProtocolTypes.ObjectData(number: NSNumber(value: Int64.max)),
+            ProtocolTypes.ObjectData(number: NSNumber(value: true)),
+            ProtocolTypes.ObjectData(objectId: "map:a@1", string: "both"),
+        ]
+
+        for data in allData {
+            let entry = InternalObjectsMapEntry(data: data)
+
+            #expect(entry.data == data)
+            #expect(entry.objectID == data?.objectId)
+        }
+    }
+
+    @Test
+    func emptyDataIsDistinctFromNoData() {
+        #expect(InternalObjectsMapEntry(data: nil) != InternalObjectsMapEntry(data: .init()))
+    }
+
+    @Test
+    func tombstonedAtRoundTrips() {
+        var entry = InternalObjectsMapEntry(timeserial: "ts1", data: .init(string: "value"))
+        #expect(entry.tombstonedAt == nil)
+        #expect(!entry.tombstone)
+
+        let tombstonedAt = Date(timeIntervalSince1970: 1_700_000_000.25)
+        entry.tombstonedAt = tombstonedAt
+        #expect(entry.tombstonedAt == tombstonedAt)
+        #expect(entry.tombstone)
+        #expect(entry == InternalObjectsMapEntry(tombstonedAt: tombstonedAt, timeserial: "ts1", data: .init(string: "value")))
+
+        entry.tombstonedAt = nil
+        #expect(entry == InternalObjectsMapEntry(timeserial: "ts1", data: .init(string: "value")))
+    }
+
+    #if canImport(Darwin)
+        /// The layout of an entry before it stored its fields compactly.
+        private struct UncompactedEntry {
+            var tombstonedAt: Date?
+            var timeserial: String?
+            var data: ProtocolTypes.ObjectData?
+        }
+
+        /// The heap bytes in use by the process.
+        private static func heapBytesInUse() -> Int {
+            mstats().bytes_used
+        }
+
+        /// Returns the heap bytes per entry of a map that holds `entryCount` entries made by `makeEntry`.
+        private static func heapBytesPerEntry<Entry>(entryCount: Int, makeEntry: (Int) -> Entry) -> Int {
+            let before = heapBytesInUse()
+            var data: [String: Entry] = [:]
+            for index in 0 ..< entryCount {
+                data["key\(index)"] = makeEntry(index)
+            }
+            let bytes = heapBytesInUse() - before
+            withExtendedLifetime(data) {}
+            return bytes / entryCount
+        }
+
+        // Prints the memory that a map's entries take per entry, with the entries' fields stored as they used to be and
+        // as they are now. The entries hold a mix of the small values that large documents tend to consist of.
+        @Test(.tags(.benchmark), .enabled(if: isBenchmarkingEnabled))
+        func benchmarkBytesPerEntry() {
+            let entryCount = 1_000_000
+            let timeserial = "01726585978590-001@abcdefghij:001"
+            let makeData = { (index: Int) -> ProtocolTypes.ObjectData in
+                switch index % 3 {
+                case 0:
+                    .init(number: NSNumber(value: Double(index) + 0.5))
+                case 1:
+                    .init(boolean: index % 2 == 0)
+                default:
+                    .init(string: "v\(index % 1000)")
+                }
+            }
+
+            let uncompacted = Self.heapBytesPerEntry(entryCount: entryCount) { index in
+                UncompactedEntry(tombstonedAt: nil, timeserial: timeserial, data: makeData(index))
+            }
+            let compact = Self.heapBytesPerEntry(entryCount: entryCount) { index in
+                InternalObjectsMapEntry(tombstonedAt: nil, timeserial: timeserial, data: makeData(index))
+            }
+
+            print("Map entries take \(uncompacted) bytes each stored uncompacted (stride \(MemoryLayout<UncompactedEntry>.stride)), \(compact) bytes each stored compactly (stride \(MemoryLayout<InternalObjectsMapEntry>.stride))")
+            #expect(compact < uncompacted)
+        }
+    #endif
+}
@@ -0,0 +1,205 @@
+import _AblyPluginSupportPrivate
+import Ably
+@testable import AblyLiveObjects
+@testable import AblyLiveObjectsTesting
+import Foundation
+import Testing
+
+/// Tests that the reads which an object in a pool answers off the internal queue, from the values it
+/// last read on the queue, see every change that would change those values.
+struct ObjectReadSnapshotTests {
+    private static func makeRealtimeObjects(internalQueue: DispatchQueue) -> InternalDefaultRealtimeObjects {
+        InternalDefaultRealtimeObjects(
+            logger: TestLogger(),
+            internalQueue: internalQueue,
+            userCallbackQueue: .main,
+            clock: MockSimpleClock(),
+            channelName: "test-channel",
+        )
+    }
+
+    /// Creates a counter in `realtimeObjects`' pool and sets the root's `counter` key to reference it.
+    private static func addCounter(to realtimeObjects: InternalDefaultRealtimeObjects, internalQueue: DispatchQueue) -> InternalDefaultLiveCounter {
+        internalQueue.ably_syncNoDeadlock {
+            realtimeObjects.mutableStateMutex.withoutSync { mutableState in
+                guard case let .counter(counter) = mutableState.objectsPool.createZeroValueObject(
+                    forObjectID: "counter:a@1",
+                    logger: TestLogger(),
+                    internalQueue: internalQueue,
+                    userCallbackQueue: .main,
+                    clock: MockSimpleClock(),
+                ) else {
+                    preconditionFailure("Expected a counter")
+                }
+                mutableState.objectsPool.root.mutableStateMutex.withoutSync { rootState in
+                    rootState.data["counter"] = InternalObjectsMapEntry(
+                        objectsMapEntry: TestFactories.objectReferenceMapEntry(objectId: "counter:a@1").entry,
+                        tombstonedAt: nil,
+                    )
+                }
+                return counter
+            }
+        }
+    }
+
+    @Test
+    func counterValueReflectsChangesMadeSinceTheLastRead() throws {
+        let internalQueue = TestFactories.createInternalQueue()
+        let realtimeObjects = Self.makeRealtimeObjects(internalQueue: internalQueue)
+        let counter = Self.addCounter(to: realtimeObjects, internalQueue: internalQueue)
+        let coreSDK = MockCoreSDK(channelState: .attached, internalQueue: internalQueue)
+
+        #expect(try counter.value(coreSDK: coreSDK) == 0)
+
+        counter.mutableStateMutex.withSync { $0.data = 5 }
+
+        #expect(try counter.value(coreSDK: coreSDK) == 5)
+    }
+
+    @Test
+    func mapReadsReflectTheTombstoningOfAReferencedObject() throws {
+        let internalQueue = TestFactories.createInternalQueue()
+        let realtimeObjects = Self.makeRealtimeObjects(internalQueue: internalQueue)
+        let counter = Self.addCounter(to: realtimeObjects, internalQueue: internalQueue)
+        let root = internalQueue.ably_syncNoDeadlock { realtimeObjects.nosync_objectsPool.root }
+        let coreSDK = MockCoreSDK(channelState: .attached, internalQueue: internalQueue)
+
+        #expect(try root.size(coreSDK: coreSDK, delegate: realtimeObjects) == 1)
+        #expect(try root.get(key: "counter", coreSDK: coreSDK, delegate: realtimeObjects) == .liveCounter(counter))
+
+        // Tombstoning the counter changes none of the root's own state, but RTLM14c excludes the key that references it
+        counter.mutableStateMutex.withSync { $0.liveObjectMutableState.tombstonedAt = Date() }
+
+        #expect(try root.size(coreSDK: coreSDK, delegate: realtimeObjects) == 0)
+        #expect(try root.get(key: "counter", coreSDK: coreSDK, delegate: realtimeObjects) == nil)
+        #expect(try root.entries(coreSDK: coreSDK, delegate: realtimeObjects).isEmpty)
+    }
+
+    @Test
+    func mapGetReflectsWritesToTheKeyAndNotOthers() throws {
+        let internalQueue = TestFactories.createInternalQueue()
+        let realtimeObjects = Self.makeRealtimeObjects(internalQueue: internalQueue)
+        let root = internalQueue.ably_syncNoDeadlock { realtimeObjects.nosync_objectsPool.root }
+        let coreSDK = MockCoreSDK(channelState: .attached, internalQueue: internalQueue)
+
+        root.mutableStateMutex.withSync { $0.data["a"] = TestFactories.internalStringMapEntry(value: "a1").entry }
+        #expect(try root.get(key: "a", coreSDK: coreSDK, delegate: realtimeObjects) == .string("a1"))
+        #expect(try root.get(key: "b", coreSDK: coreSDK, delegate: realtimeObjects) == nil)
+
+        root.mutableStateMutex.withSync { $0.data["b"] = TestFactories.internalStringMapEntry(value: "b1").entry }
+        #expect(try root.get(key: "a", coreSDK: coreSDK, delegate: realtimeObjects) == .string("a1"))
+        #expect(try root.get(key: "b", coreSDK: coreSDK, delegate: realtimeObjects) == .string("b1"))
+
+        root.mutableStateMutex.withSync { $0.data["a"] = TestFactories.internalStringMapEntry(value: "a2").entry }
+        #expect(try root.get(key: "a", coreSDK: coreSDK, delegate: realtimeObjects) == .string("a2"))
+    }
+
+    @Test
+    func tombstoningAnObjectChangesTheReadVersionOfItsOwnPoolOnly() {
+        let internalQueue = TestFactories.createInternalQueue()
+        let realtimeObjects = Self.makeRealtimeObjects(internalQueue: internalQueue)
+        let otherRealtimeObjects = Self.makeRealtimeObjects(internalQueue: internalQueue)
+        let counter = Self.addCounter(to: realtimeObjects, internalQueue: internalQueue)
+        let (readVersion, otherReadVersion) = internalQueue.ably_syncNoDeadlock {
+            (realtimeObjects.nosync_objectsPool.readVersion, otherRealtimeObjects.nosync_objectsPool.readVersion)
+        }
+        let (versionBefore, otherVersionBefore) = (readVersion.current, otherReadVersion.current)
+
+        counter.mutableStateMutex.withSync { $0.liveObjectMutableState.tombstonedAt = Date() }
+
+        #expect(readVersion.current != versionBefore)
+        #expect(otherReadVersion.current == otherVersionBefore)
+    }
+
+    // @spec RTO25
+    @Test(arguments: [.detached, .failed] as [_AblyPluginSupportPrivate.RealtimeChannelState])
+    func readsThrowOnceTheChannelBecomesDetachedOrFailed(channelState: _AblyPluginSupportPrivate.RealtimeChannelState) throws {
+        let internalQueue = TestFactories.createInternalQueue()
+        let realtimeObjects = Self.makeRealtimeObjects(internalQueue: internalQueue)
+        let counter = Self.addCounter(to: realtimeObjects, internalQueue: internalQueue)
+        let root = internalQueue.ably_syncNoDeadlock { realtimeObjects.nosync_objectsPool.root }
+        let coreSDK = MockCoreSDK(channelState: .attached, internalQueue: internalQueue)
+
+        _ = try counter.value(coreSDK: coreSDK)
+        _ = try root.size(coreSDK: coreSDK, delegate: realtimeObjects)
+
+        internalQueue.ably_syncNoDeadlock {
+            coreSDK.nosync_setChannelState(channelState)
+            realtimeObjects.nosync_onChannelStateChanged(toState: channelState, reason: nil)
+        }
+
+        let counterError = try #require(throws: ARTErrorInfo.self) {
+            try counter.value(coreSDK: coreSDK)
+        }
+        #expect(counterError.code == 90001)
+        let mapError = try #require(throws: ARTErrorInfo.self) {
+            try root.size(coreSDK: coreSDK, delegate: realtimeObjects)
+        }
+        #expect(mapError.code == 90001)
+    }
+
+    // Reads of an unchanged object don't wait for the internal queue, so they keep their pace while it's busy applying
+    // operations to other objects.
+    @Test(.tags(.benchmark), .enabled(if: isBenchmarkingEnabled))
+    func benchmarkReadsUnderConcurrentWrites() async throws {
+        let internalQueue = TestFactories.createInternalQueue()
+        let realtimeObjects = Self.makeRealtimeObjects(internalQueue: internalQueue)
+        let counter = Self.addCounter(to: realtimeObjects, internalQueue: internalQueue)
+        let root = internalQueue.ably_syncNoDeadlock { realtimeObjects.nosync_objectsPool.root }
+        let coreSDK = MockCoreSDK(channelState: .attached, internalQueue: internalQueue)
+
+        let duration: TimeInterval = 2
+        let deadline = Date().addingTimeInterval(duration)
+
+        // The writer increments the counter in batches of 1000 on the internal queue, as the application of a large
+        // OBJECT message would
+        let writer = Task.detached {
+            var writeCount = 0
+            while Date() < deadline {
+                internalQueue.ably_syncNoDeadlock {
+                    for _ in 0 ..< 1000 {
+                        counter.mutableStateMutex.withoutSync { $0.data += 1 }
+                    }
+                }
+                writeCount += 1000
+            }
+            return writeCount
+        }
+
+        // The root's data doesn't change, so its reads don't wait for the writer
+        var readCount = 0
+        while Date() < deadline {
+            _ = try root.get(key: "counter", coreSDK: coreSDK, delegate: realtimeObjects)
+            readCount += 1
+        }
+        let writeCount = await writer.value
+
+        print("Performed \(Int(Double(readCount) / duration)) map reads/s during \(Int(Double(writeCount) / duration)) counter writes/s")
+    }
+
+    // A get that follows a write to a large map reads only that key, rather than all of the map's entries.
+    @Test(.tags(.benchmark), .enabled(if: isBenchmarkingEnabled))
+    func benchmarkGetsAfterWritesToALargeMap() throws {
+        let internalQueue = TestFactories.createInternalQueue()
+        let realtimeObjects = Self.makeRealtimeObjects(internalQueue: internalQueue)
+        let root = internalQueue.ably_syncNoDeadlock { realtimeObjects.nosync_objectsPool.root }
+        let coreSDK = MockCoreSDK(channelState: .attached, internalQueue: internalQueue)
+
+        let entryCount = 100_000
+        root.mutableStateMutex.withSync { mutableState in
+            for index in 0 ..< entryCount {
+                mutableState.data["key\(index)"] = TestFactories.internalStringMapEntry(value: "value\(index)").entry
+            }
+        }
+
+        let iterationCount = 10000
+        let start = Date()
+        for index in 0 ..< iterationCount {
+            root.mutableStateMutex.withSync { $0.data["key\(index)"] = TestFactories.internalStringMapEntry(value: "new\(index)").entry }
+            _ = try root.get(key: "key\(index)", coreSDK: coreSDK, delegate: realtimeObjects)
+        }
+        let elapsed = Date().timeIntervalSince(start)
+
+        print("Performed \(Int(Double(iterationCount) / elapsed)) write-then-get pairs/s on a map of \(entryCount) entries")
+    }
+}
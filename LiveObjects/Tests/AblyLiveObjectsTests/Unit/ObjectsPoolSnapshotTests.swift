@@ -0,0 +1,167 @@
+import _AblyPluginSupportPrivate
+import Ably
+@testable import AblyLiveObjects
+@testable import AblyLiveObjectsTesting
+import Foundation
+import Testing
+
+struct ObjectsPoolSnapshotTests {
+    private static let createdAt = Date(timeIntervalSince1970: 1_700_000_000)
+
+    private static let snapshot = ObjectsPoolSnapshot(
+        channelName: "test-channel",
+        createdAt: createdAt,
+        objectStates: [
+            TestFactories.rootObjectState(
+                siteTimeserials: ["site1": "ts2"],
+                entries: [
+                    "name": TestFactories.stringMapEntry(value: "Ada").entry,
+                    "counter": TestFactories.objectReferenceMapEntry(objectId: "counter:a@1").entry,
+                ],
+            ),
+            TestFactories.counterObjectState(objectId: "counter:a@1", count: 3),
+        ],
+    )
+
+    @Test
+    func roundTripsThroughItsEncoding() throws {
+        let decoded = try ObjectsPoolSnapshot(encoded: Self.snapshot.encoded)
+
+        #expect(decoded == Self.snapshot)
+    }
+
+    @Test
+    func roundTripsWireValuesThroughTheBinaryEncoding() throws {
+        let value: WireValue = .object([
+            "null": .null,
+            "bools": .array([.bool(true), .bool(false)]),
+            "numbers": .array([.number(0), .number(-1), .number(NSNumber(value: Int64.max >> 11)), .number(1.5), .number(-0.25)]),
+            "string": .string("héllo"),
+            "data": .data(Data([0, 1, 0xFF])),
+            "nested": .object(["empty": .array([])]),
+        ])
+
+        #expect(try WireValue(binaryEncoded: value.binaryEncoded) == value)
+    }
+
+    @Test
+    func rejectsAnotherFormatVersion() throws {
+        var data = Self.snapshot.encoded
+        data[4] = ObjectsPoolSnapshot.formatVersion + 1
+
+        #expect(throws: ARTErrorInfo.self) {
+            try ObjectsPoolSnapshot(encoded: data)
+        }
+    }
+
+    private static let owner = ObjectsSnapshotStore.Owner(appID: "app1", clientID: "client1")
+
+    /// Returns a realtime objects for `test-channel` that has warm-started from a store whose owner is
+    /// `storeOwner`, after `Self.snapshot` was written for `snapshotOwner`.
+    private static func warmStartedRealtimeObjects(
+        directoryURL: URL,
+        snapshotOwner: ObjectsSnapshotStore.Owner = owner,
+        storeOwner: ObjectsSnapshotStore.Owner? = owner,
+        internalQueue: DispatchQueue,
+    ) throws -> InternalDefaultRealtimeObjects {
+        let snapshotStore = ObjectsSnapshotStore(directoryURL: directoryURL, logger: TestLogger()) { storeOwner }
+        try snapshotStore.writeSnapshot(Self.snapshot.encoded, channelName: "test-channel", owner: snapshotOwner)
+
+        let realtimeObjects = InternalDefaultRealtimeObjects(
+            logger: TestLogger(),
+            internalQueue: internalQueue,
+            userCallbackQueue: .main,
+            clock: MockSimpleClock(currentTime: Self.createdAt.addingTimeInterval(60)),
+            channelName: "test-channel",
+            snapshotStore: snapshotStore,
+        )
+        internalQueue.ably_syncNoDeadlock {
+            realtimeObjects.nosync_warmStartFromSnapshot()
+        }
+        return realtimeObjects
+    }
+
+    private static func rootKeys(of realtimeObjects: InternalDefaultRealtimeObjects, internalQueue: DispatchQueue) -> Set<String> {
+        internalQueue.ably_syncNoDeadlock {
+            Set(realtimeObjects.nosync_objectsPool.root.testsOnly_data.keys)
+        }
+    }
+
+    @Test
+    func warmStartLetsGetRootReturnOnceAttachedBeforeTheFirstSync() async throws {
+        let directoryURL = FileManager.default.temporaryDirectory.appendingPathComponent(UUID().uuidString)
+        defer { try? FileManager.default.removeItem(at: directoryURL) }
+        let internalQueue = TestFactories.createInternalQueue()
+        let realtimeObjects = try Self.warmStartedRealtimeObjects(directoryURL: directoryURL, internalQueue: internalQueue)
+
+        // No sync has happened, yet getRoot returns the snapshot's objects
+        let coreSDK = MockCoreSDK(channelState: .attached, internalQueue: internalQueue)
+        let root = try await realtimeObjects.getRoot(coreSDK: coreSDK)
+
+        #expect(Set(root.testsOnly_data.keys) == ["name", "counter"])
+        let counter = internalQueue.ably_syncNoDeadlock {
+            realtimeObjects.nosync_objectsPool.entries["counter:a@1"]?.counterValue
+        }
+        #expect(counter?.testsOnly_data == 3)
+        // The objects are not reported as synced
+        #expect(realtimeObjects.testsOnly_syncState != .synced)
+    }
+
+    @Test
+    func warmStartDoesNotLetGetRootReturnBeforeTheChannelAttaches() async throws {
+        let directoryURL = FileManager.default.temporaryDirectory.appendingPathComponent(UUID().uuidString)
+        defer { try? FileManager.default.removeItem(at: directoryURL) }
+        let internalQueue = TestFactories.createInternalQueue()
+        let realtimeObjects = try Self.warmStartedRealtimeObjects(directoryURL: directoryURL, internalQueue: internalQueue)
+
+        let coreSDK = MockCoreSDK(channelState: .attaching, internalQueue: internalQueue)
+        async let getRootTask = realtimeObjects.getRoot(coreSDK: coreSDK)
+        _ = try #require(await realtimeObjects.testsOnly_waitingForSyncEvents.first { _ in true })
+
+        // The sync that completes on an ATTACHED without HAS_OBJECTS replaces the snapshot's objects
+        internalQueue.ably_syncNoDeadlock {
+            realtimeObjects.nosync_onChannelAttached(hasObjects: false)
+        }
+
+        let root = try await getRootTask
+        #expect(root.testsOnly_data.isEmpty)
+    }
+
+    @Test
+    func warmStartIgnoresTheSnapshotsOfAnotherOwner() throws {
+        let directoryURL = FileManager.default.temporaryDirectory.appendingPathComponent(UUID().uuidString)
+        defer { try? FileManager.default.removeItem(at: directoryURL) }
+        let internalQueue = TestFactories.createInternalQueue()
+
+        for storeOwner in [
+            ObjectsSnapshotStore.Owner(appID: "app1", clientID: "client2"),
+            ObjectsSnapshotStore.Owner(appID: "app1", clientID: nil),
+            ObjectsSnapshotStore.Owner(appID: "app2", clientID: "client1"),
+        ] {
+            let realtimeObjects = try Self.warmStartedRealtimeObjects(directoryURL: directoryURL, storeOwner: storeOwner, internalQueue: internalQueue)
+
+            #expect(Self.rootKeys(of: realtimeObjects, internalQueue: internalQueue).isEmpty)
+        }
+    }
+
+    @Test
+    func warmStartDoesNothingWithoutAnOwner() throws {
+        let directoryURL = FileManager.default.temporaryDirectory.appendingPathComponent(UUID().uuidString)
+        defer { try? FileManager.default.removeItem(at: directoryURL) }
+        let internalQueue = TestFactories.createInternalQueue()
+
+        let realtimeObjects = try Self.warmStartedRealtimeObjects(directoryURL: directoryURL, storeOwner: nil, internalQueue: internalQueue)
+
+        #expect(Self.rootKeys(of: realtimeObjects, internalQueue: internalQueue).isEmpty)
+    }
+
+    @Test
+    func ownersDirectoryNameDoesNotRevealTheOwner() {
+        let directoryName = Self.owner.directoryName
+
+        #expect(directoryName.count == 64)
+        #expect(!directoryName.contains("app1"))
+        #expect(!directoryName.contains("client1"))
+        #expect(directoryName != ObjectsSnapshotStore.Owner(appID: "app1", clientID: nil).directoryName)
+    }
+}
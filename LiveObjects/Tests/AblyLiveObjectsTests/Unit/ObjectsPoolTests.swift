@@ -390,5 +390,70 @@ struct ObjectsPoolTests {
             #expect(pool.entries[childID] == nil)
             #expect(pool.entries[ObjectsPool.rootKey] != nil)
         }
+
+        // @spec RTO10c1a
+        // @spec RTO10c1b
+        // Only the expired tombstones are released, and a deadline splits the work into slices.
+        @Test
+        func releasesOnlyExpiredTombstonesAcrossSlices() {
+            let logger = TestLogger()
+            let internalQueue = TestFactories.createInternalQueue()
+            let clock = MockSimpleClock()
+            let gracePeriod: TimeInterval = 60 * 60
+            let expired = clock.now.addingTimeInterval(-2 * gracePeriod)
+            var pool = ObjectsPool(logger: logger, internalQueue: internalQueue, userCallbackQueue: .main, clock: clock)
+
+            let map = InternalDefaultLiveMap(
+                testsOnly_data: [
+                    "expired": InternalObjectsMapEntry(tombstonedAt: expired, timeserial: "01", data: nil),
+                    "recent": InternalObjectsMapEntry(tombstonedAt: clock.now, timeserial: "01", data: nil),
+                    "alive": InternalObjectsMapEntry(tombstonedAt: nil, timeserial: "01", data: ProtocolTypes.ObjectData(string: "ok")),
+                ],
+                objectID: "map:m@1",
+                logger: logger,
+                internalQueue: internalQueue,
+                userCallbackQueue: .main,
+                clock: clock,
+            )
+            pool.testsOnly_setEntry(.map(map), forObjectID: "map:m@1")
+
+            let objectIDs = ["counter:expired1@1", "counter:expired2@1", "counter:recent@1"]
+            internalQueue.ably_syncNoDeadlock {
+                for objectID in objectIDs {
+                    _ = pool.createZeroValueObject(forObjectID: objectID, logger: logger, internalQueue: internalQueue, userCallbackQueue: .main, clock: clock)
+                }
+            }
+            pool.entries["counter:expired1@1"]?.counterValue?.testsOnly_setTombstonedAt(expired)
+            pool.entries["counter:expired2@1"]?.counterValue?.testsOnly_setTombstonedAt(expired)
+            pool.entries["counter:recent@1"]?.counterValue?.testsOnly_setTombstonedAt(clock.now)
+
+            var continuation: AsyncStream<Void>.Continuation!
+            _ = AsyncStream<Void> { continuation = $0 }
+
+            // A deadline that has already passed releases one object's tombstones per slice.
+            var slices = 0
+            var isComplete = false
+            while !isComplete {
+                slices += 1
+                isComplete = internalQueue.ably_syncNoDeadlock {
+                    pool.nosync_performGarbageCollection(gracePeriod: gracePeriod, clock: clock, logger: logger, eventsContinuation: continuation, deadline: .now())
+                }
+            }
+
+            #expect(slices == 4)
+            #expect(pool.entries["counter:expired1@1"] == nil)
+            #expect(pool.entries["counter:expired2@1"] == nil)
+            #expect(pool.entries["counter:recent@1"] != nil)
+            #expect(Set(map.testsOnly_data.keys) == ["recent", "alive"])
+
+            // Once the grace period of the remaining tombstones has elapsed, they are released too.
+            clock.advance(by: gracePeriod)
+            internalQueue.ably_syncNoDeadlock {
+                pool.nosync_performGarbageCollection(gracePeriod: gracePeriod, clock: clock, logger: logger, eventsContinuation: continuation)
+            }
+
+            #expect(pool.entries["counter:recent@1"] == nil)
+            #expect(Set(map.testsOnly_data.keys) == ["alive"])
+        }
     }
 }
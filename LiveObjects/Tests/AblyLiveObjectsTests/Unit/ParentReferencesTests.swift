@@ -156,6 +156,41 @@ struct ParentReferencesTests {
         #expect(mapLPaths.contains(["left"]))
     }
 
+    // RTLO4f: the paths are indexed, and recomputed once a parent reference on them changes or an
+    // object on them leaves the pool.
+    @Test
+    func getFullPathsIndexIsInvalidatedByParentReferenceAndMembershipChanges() {
+        let internalQueue = TestFactories.createInternalQueue()
+        var pool = ObjectsPool(logger: TestLogger(), internalQueue: internalQueue, userCallbackQueue: .main, clock: MockSimpleClock())
+
+        // root --profile--> map:profile --score--> counter:score
+        let profile = Self.makeMap(objectID: "map:profile@1000", internalQueue: internalQueue)
+        let score = Self.makeCounter(objectID: "counter:score@1000", internalQueue: internalQueue)
+        pool.testsOnly_setEntry(.map(profile), forObjectID: "map:profile@1000")
+        pool.testsOnly_setEntry(.counter(score), forObjectID: "counter:score@1000")
+        internalQueue.ably_syncNoDeadlock {
+            profile.nosync_addParentReference(parentObjectID: ObjectsPool.rootKey, key: "profile")
+            score.nosync_addParentReference(parentObjectID: "map:profile@1000", key: "score")
+        }
+
+        #expect(score.testsOnly_getFullPaths(objectsPool: pool) == [["profile", "score"]])
+        #expect(score.testsOnly_getFullPaths(objectsPool: pool) == [["profile", "score"]])
+
+        // A new parent reference further up the path is picked up.
+        internalQueue.ably_syncNoDeadlock {
+            profile.nosync_addParentReference(parentObjectID: ObjectsPool.rootKey, key: "me")
+        }
+        #expect(Set(score.testsOnly_getFullPaths(objectsPool: pool)) == [["profile", "score"], ["me", "score"]])
+
+        // An object on the path leaving the pool orphans the object.
+        pool.entries.removeValue(forKey: "map:profile@1000")
+        #expect(score.testsOnly_getFullPaths(objectsPool: pool).isEmpty)
+
+        // And rejoining it restores the paths.
+        pool.testsOnly_setEntry(.map(profile), forObjectID: "map:profile@1000")
+        #expect(Set(score.testsOnly_getFullPaths(objectsPool: pool)) == [["profile", "score"], ["me", "score"]])
+    }
+
     // RTO5c10, RTO5c10a, RTO5c10b: the rebuild resets every object's parentReferences and re-adds
     // them from every map's non-tombstoned object-valued entries.
     @Test
@@ -193,6 +193,54 @@ struct PathObjectSubscriptionTests {
         #expect(collector.events.isEmpty)
     }
 
+    // MARK: - Subscription trie
+
+    // @spec RTO24c1 - a subscription covers a candidate when its path is a prefix within its depth window
+    // @spec RTO24b2b - each subscription is notified once, at its most-preferred covered candidate
+    @Test
+    func registerDispatchesToCoveringSubscriptionsAndPrunesOnUnsubscribe() throws {
+        let fixture = Self.makeFixture()
+        let register = PathObjectSubscriptionRegister(internalQueue: fixture.internalQueue, userCallbackQueue: fixture.userCallbackQueue)
+        let makePathObject: PathObjectSubscriptionRegister.PathObjectFactory = { [fixture] segments in
+            DefaultLiveMapPathObject(channelObject: fixture.engine, coreSDK: fixture.coreSDK, internalQueue: fixture.internalQueue, segments: segments)
+        }
+        let onA = EventCollector()
+        let onAB = EventCollector()
+        let onABWithDepth1 = EventCollector()
+        let onC = EventCollector()
+
+        let subscriptions = fixture.internalQueue.ably_syncNoDeadlock {
+            [
+                register.nosync_subscribe(segments: ["a"], depth: nil, listener: { onA.record($0) }, makePathObject: makePathObject),
+                register.nosync_subscribe(segments: ["a", "b"], depth: nil, listener: { onAB.record($0) }, makePathObject: makePathObject),
+                register.nosync_subscribe(segments: ["a", "b"], depth: 1, listener: { onABWithDepth1.record($0) }, makePathObject: makePathObject),
+                register.nosync_subscribe(segments: ["c"], depth: nil, listener: { onC.record($0) }, makePathObject: makePathObject),
+            ]
+        }
+        let countsBefore = fixture.internalQueue.ably_syncNoDeadlock { register.nosync_counts }
+        #expect(countsBefore.subscriptions == 4)
+        #expect(countsBefore.nodes == 3)
+
+        fixture.internalQueue.ably_syncNoDeadlock {
+            register.nosync_notifyPathEvent(candidatePaths: [["a", "b", "k"], ["a", "b"]], message: nil)
+        }
+        fixture.userCallbackQueue.sync {}
+
+        // The first covered candidate wins; the depth-1 subscription only covers its own path.
+        #expect(onA.sortedPaths == ["a.b.k"])
+        #expect(onAB.sortedPaths == ["a.b.k"])
+        #expect(onABWithDepth1.sortedPaths == ["a.b"])
+        #expect(onC.events.isEmpty)
+
+        for subscription in subscriptions {
+            subscription.unsubscribe()
+        }
+        // The trie is pruned back to its root
+        let countsAfter = fixture.internalQueue.ably_syncNoDeadlock { register.nosync_counts }
+        #expect(countsAfter.subscriptions == 0)
+        #expect(countsAfter.nodes == 0)
+    }
+
     // MARK: - Depth validation (RTPO19c1a)
 
     // A positive depth (and no options) is accepted.
@@ -20,6 +20,15 @@ struct PublicRealtimeObjectTests {
         private var value = 0
         func increment() { lock.withLock { value += 1 } }
         var isEmpty: Bool { lock.withLock { value == 0 } }
+        var count: Int { lock.withLock { value } }
+    }
+
+    /// Records the messages of the latest publish.
+    private final class PublishedMessages: @unchecked Sendable {
+        private let lock = NSLock()
+        private var messages: [ProtocolTypes.OutboundObjectMessage]?
+        func set(_ value: [ProtocolTypes.OutboundObjectMessage]) { lock.withLock { messages = value } }
+        func get() -> [ProtocolTypes.OutboundObjectMessage]? { lock.withLock { messages } }
     }
 
     private static func makeProxied(internalQueue: DispatchQueue) -> InternalDefaultRealtimeObjects {
@@ -255,6 +264,175 @@ struct PublicRealtimeObjectTests {
         #expect(a !== b)
     }
 
+    // MARK: - batch(_:)
+
+    // The operations of a batch, across objects, are published as one array and applied on its ACK.
+    @Test
+    func batchPublishesItsOperationsTogether() async throws {
+        let (publicObject, proxied, coreSDK, internalQueue) = Self.makePublicObject()
+        internalQueue.ably_syncNoDeadlock {
+            proxied.nosync_setSiteCode("site1")
+            proxied.nosync_handleObjectSyncProtocolMessage(
+                objectMessages: [
+                    TestFactories.rootObjectMessage(entries: [
+                        "old": TestFactories.stringMapEntry(value: "stale").entry,
+                        "counter": TestFactories.objectReferenceMapEntry(objectId: "counter:a@1").entry,
+                    ]),
+                    TestFactories.counterObjectMessage(objectId: "counter:a@1", count: 1),
+                ],
+                protocolMessageChannelSerial: nil,
+            )
+        }
+        let publishCount = CallCounter()
+        let published = PublishedMessages()
+        coreSDK.setPublishHandler { messages in
+            publishCount.increment()
+            published.set(messages)
+            return PublishResult(serials: messages.indices.map { "ts9-\($0)" })
+        }
+
+        let root = try await publicObject.get()
+        guard case let .liveMap(map) = try root.instance(), case let .liveCounter(counter) = try root.get(key: "counter").instance() else {
+            Issue.record("Expected a map at the root and a counter at \"counter\"")
+            return
+        }
+
+        try await publicObject.batch { batch in
+            batch.set(key: "a", value: .primitive(.string("1")), on: map)
+            batch.set(key: "b", value: .primitive(.string("2")), on: map)
+            batch.remove(key: "old", from: map)
+            batch.increment(counter, by: 5)
+        }
+
+        #expect(publishCount.count == 1)
+        #expect(published.get()?.map(\.operation?.action) == [.known(.mapSet), .known(.mapSet), .known(.mapRemove), .known(.counterInc)])
+        #expect(try Set(map.keys()) == ["a", "b", "counter"])
+        #expect(try counter.value == 6)
+    }
+
+    // An invalid operation fails the whole batch before anything is published.
+    @Test
+    func batchWithAnInvalidOperationPublishesNothing() async throws {
+        let (publicObject, proxied, coreSDK, internalQueue) = Self.makePublicObject()
+        internalQueue.ably_syncNoDeadlock {
+            proxied.nosync_handleObjectSyncProtocolMessage(
+                objectMessages: [
+                    TestFactories.rootObjectMessage(entries: ["counter": TestFactories.objectReferenceMapEntry(objectId: "counter:a@1").entry]),
+                    TestFactories.counterObjectMessage(objectId: "counter:a@1", count: 1),
+                ],
+                protocolMessageChannelSerial: nil,
+            )
+        }
+        let publishCount = CallCounter()
+        coreSDK.setPublishHandler { messages in
+            publishCount.increment()
+            return PublishResult(serials: messages.map { _ in "ts9" })
+        }
+
+        let root = try await publicObject.get()
+        guard case let .liveMap(map) = try root.instance(), case let .liveCounter(counter) = try root.get(key: "counter").instance() else {
+            Issue.record("Expected a map at the root and a counter at \"counter\"")
+            return
+        }
+
+        await #expect(throws: ARTErrorInfo.self) {
+            try await publicObject.batch { batch in
+                batch.set(key: "a", value: .primitive(.string("1")), on: map)
+                batch.increment(counter, by: .infinity)
+            }
+        }
+        #expect(publishCount.isEmpty)
+    }
+
+    /// Syncs a root map that holds a counter at "counter", and returns the root map and counter instances.
+    private static func syncedMapAndCounter(
+        publicObject: PublicDefaultRealtimeObject,
+        proxied: InternalDefaultRealtimeObjects,
+        internalQueue: DispatchQueue,
+    ) async throws -> (map: any LiveMapInstance, counter: any LiveCounterInstance)? {
+        internalQueue.ably_syncNoDeadlock {
+            proxied.nosync_setSiteCode("site1")
+            proxied.nosync_handleObjectSyncProtocolMessage(
+                objectMessages: [
+                    TestFactories.rootObjectMessage(entries: ["counter": TestFactories.objectReferenceMapEntry(objectId: "counter:a@1").entry]),
+                    TestFactories.counterObjectMessage(objectId: "counter:a@1", count: 1),
+                ],
+                protocolMessageChannelSerial: nil,
+            )
+        }
+        let root = try await publicObject.get()
+        guard case let .liveMap(map) = try root.instance(), case let .liveCounter(counter) = try root.get(key: "counter").instance() else {
+            return nil
+        }
+        return (map, counter)
+    }
+
+    // An operation on an instance of another channel's objects fails the whole batch before anything is published.
+    @Test
+    func batchWithAnInstanceOfAnotherChannelPublishesNothing() async throws {
+        let (publicObject, proxied, coreSDK, internalQueue) = Self.makePublicObject()
+        let other = Self.makePublicObject()
+        let publishCount = CallCounter()
+        coreSDK.setPublishHandler { messages in
+            publishCount.increment()
+            return PublishResult(serials: messages.map { _ in "ts9" })
+        }
+
+        let instances = try await Self.syncedMapAndCounter(publicObject: publicObject, proxied: proxied, internalQueue: internalQueue)
+        let otherInstances = try await Self.syncedMapAndCounter(publicObject: other.publicObject, proxied: other.proxied, internalQueue: other.internalQueue)
+        guard let instances, let otherInstances else {
+            Issue.record("Expected a map at the root and a counter at \"counter\"")
+            return
+        }
+
+        await #expect { () async throws in
+            try await publicObject.batch { batch in
+                batch.set(key: "a", value: .primitive(.string("1")), on: instances.map)
+                batch.increment(otherInstances.counter)
+            }
+        } throws: { error in
+            (error as? ARTErrorInfo)?.code == 40003
+        }
+        #expect(publishCount.isEmpty)
+        #expect(try instances.map.keys() == ["counter"])
+    }
+
+    /// A `RealtimeObject` other than the SDK's own, which gets `batch(_:)` from the protocol's default implementation.
+    private struct OtherRealtimeObject: RealtimeObject {
+        func get() async throws(ARTErrorInfo) -> any LiveMapPathObject {
+            fatalError("not used")
+        }
+
+        func on(event _: ObjectsEvent, callback _: @escaping @Sendable () -> Void) -> any StatusSubscription {
+            fatalError("not used")
+        }
+    }
+
+    // The default implementation of batch(_:) performs each operation on its own, in order.
+    @Test
+    func defaultBatchPerformsTheOperationsOneAtATime() async throws {
+        let (publicObject, proxied, coreSDK, internalQueue) = Self.makePublicObject()
+        let publishCount = CallCounter()
+        coreSDK.setPublishHandler { messages in
+            publishCount.increment()
+            return PublishResult(serials: messages.indices.map { "ts9-\(publishCount.count)-\($0)" })
+        }
+
+        guard let instances = try await Self.syncedMapAndCounter(publicObject: publicObject, proxied: proxied, internalQueue: internalQueue) else {
+            Issue.record("Expected a map at the root and a counter at \"counter\"")
+            return
+        }
+
+        try await OtherRealtimeObject().batch { batch in
+            batch.set(key: "a", value: .primitive(.string("1")), on: instances.map)
+            batch.increment(instances.counter, by: 2)
+        }
+
+        #expect(publishCount.count == 2)
+        #expect(try Set(instances.map.keys()) == ["a", "counter"])
+        #expect(try instances.counter.value == 3)
+    }
+
     // MARK: - Trap-free surface smoke
 
     // Every public `RealtimeObject` entry point is callable without trapping.
@@ -116,6 +116,55 @@ struct SyncObjectsPoolTests {
         #expect(entry?.object?.map?.entries == expectedEntries)
     }
 
+    // @spec RTO5f2a1
+    @Test
+    func accumulateDiscardsMergedMapEntriesWhenTombstoneTrue() {
+        var pool = SyncObjectsPool()
+        let logger = TestLogger()
+
+        for i in 1 ... 2 {
+            let (key, entry) = TestFactories.stringMapEntry(key: "key\(i)", value: "value\(i)")
+            pool.accumulate([TestFactories.inboundObjectMessage(object: TestFactories.mapObjectState(objectId: "map:a@1", entries: [key: entry]))], logger: logger)
+        }
+        let tombstoneMessage = TestFactories.inboundObjectMessage(object: TestFactories.mapObjectState(objectId: "map:a@1", tombstone: true))
+        pool.accumulate([tombstoneMessage], logger: logger)
+
+        #expect(Array(pool) == [tombstoneMessage])
+
+        // Entries in later partial messages are merged into the tombstone message's (empty) entries
+        let (key3, entry3) = TestFactories.stringMapEntry(key: "key3", value: "value3")
+        pool.accumulate([TestFactories.inboundObjectMessage(object: TestFactories.mapObjectState(objectId: "map:a@1", entries: [key3: entry3]))], logger: logger)
+
+        #expect(Array(pool).first?.object?.map?.entries == [key3: entry3])
+    }
+
+    // RTO5f2a2: a large map split across many OBJECT_SYNC messages is accumulated in time linear in its number of
+    // entries.
+    @Test(.tags(.benchmark), .enabled(if: isBenchmarkingEnabled))
+    func benchmarkAccumulateMapSplitAcrossManyMessages() {
+        let messageCount = 1000
+        let entriesPerMessage = 1000
+        let messages = (0 ..< messageCount).map { messageIndex in
+            var entries: [String: ProtocolTypes.ObjectsMapEntry] = [:]
+            entries.reserveCapacity(entriesPerMessage)
+            for entryIndex in 0 ..< entriesPerMessage {
+                let (key, entry) = TestFactories.stringMapEntry(key: "key\(messageIndex)-\(entryIndex)")
+                entries[key] = entry
+            }
+            return TestFactories.inboundObjectMessage(object: TestFactories.mapObjectState(objectId: "map:a@1", entries: entries))
+        }
+
+        var pool = SyncObjectsPool()
+        let logger = TestLogger()
+        let start = Date()
+        for message in messages {
+            pool.accumulate([message], logger: logger)
+        }
+        print("Accumulated \(messageCount * entriesPerMessage) map entries from \(messageCount) messages in \(Date().timeIntervalSince(start))s")
+
+        #expect(Array(pool).first?.object?.map?.entries?.count == messageCount * entriesPerMessage)
+    }
+
     // Note this is a gap in the spec (because the server should never send two different object types for a given object ID), and arguably not one worth specifying, and there's no _correct_ behaviour here — our handling is arbitrary — but we have a test just because the code still needs to do _something_ and we want code coverage for that branch.
     @Test
     func accumulateReplacesExistingNonMapEntryWhenMergingMap() {
@@ -0,0 +1,79 @@
+@testable import AblyLiveObjects
+import Foundation
+import Testing
+
+struct TimeserialTests {
+    // @spec RTLO4a6
+    @Test(arguments: [
+        // Differ within the packed first 16 bytes
+        ("01726585978590-001@abcdefghij:001", "01726585978591-001@abcdefghij:001"),
+        // Differ only after the first 16 bytes
+        ("01726585978590-001@abcdefghij:001", "01726585978590-001@abcdefghij:002"),
+        ("01726585978590-001@abcdefghij:001", "01726585978590-002@abcdefghij:000"),
+        // One is a prefix of the other
+        ("serial", "serial1"),
+        ("01726585978590-0", "01726585978590-01"),
+        ("", "a"),
+        // Short serials of the kind used in tests
+        ("ts1", "ts2"),
+        ("ts10", "ts2"),
+    ])
+    func comparesLikeTheStrings(lower: String, higher: String) {
+        #expect(Timeserial(lower) < Timeserial(higher))
+        #expect(!(Timeserial(higher) < Timeserial(lower)))
+        #expect(Timeserial(lower) != Timeserial(higher))
+        #expect(Timeserial(higher) == Timeserial(higher))
+        #expect(Timeserial(lower).string == lower)
+        #expect(Timeserial(higher).string == higher)
+    }
+
+    @Test
+    func siteTimeserialsRoundTripThroughTheDictionary() {
+        let dictionary = ["site1": "ts1", "site2": "01726585978590-001@abcdefghij:001", "site3": ""]
+
+        #expect(SiteTimeserials(dictionary).dictionary == dictionary)
+    }
+
+    @Test
+    func siteTimeserialsAreEqualRegardlessOfOrder() {
+        var siteTimeserials = SiteTimeserials()
+        siteTimeserials["site2"] = Timeserial("ts2")
+        siteTimeserials["site1"] = Timeserial("ts1")
+
+        #expect(siteTimeserials == SiteTimeserials(["site1": "ts1", "site2": "ts2"]))
+        #expect(siteTimeserials != SiteTimeserials(["site1": "ts1", "site2": "ts3"]))
+    }
+
+    @Test
+    func settingNilRemovesASite() {
+        var siteTimeserials = SiteTimeserials(["site1": "ts1"])
+        siteTimeserials["site1"] = nil
+
+        #expect(siteTimeserials.isEmpty)
+    }
+
+    // Prints the rate at which objects on several threads at once, as with several channels' pools,
+    // check and record operations from a few sites. Nothing is shared between the threads.
+    @Test(.tags(.benchmark), .enabled(if: isBenchmarkingEnabled))
+    func benchmarkCanApplyOperationOnConcurrentObjects() {
+        let threadCount = 8
+        let operationCount = 200_000
+        let siteCodes = ["abcdefghij", "bcdefghijk", "cdefghijkl"]
+        let logger = TestLogger()
+
+        let start = Date()
+        DispatchQueue.concurrentPerform(iterations: threadCount) { thread in
+            var state = LiveObjectMutableState<Void>(objectID: "map:\(thread)@1")
+            for index in 0 ..< operationCount {
+                let siteCode = siteCodes[index % siteCodes.count]
+                let serial = "0\(1_726_585_978_590 + index)-000@\(siteCode):000"
+                if let applicableOperation = state.canApplyOperation(objectMessageSerial: serial, objectMessageSiteCode: siteCode, logger: logger) {
+                    state.siteTimeserials[applicableOperation.objectMessageSiteCode] = applicableOperation.objectMessageTimeserial
+                }
+            }
+        }
+        let elapsed = Date().timeIntervalSince(start)
+
+        print("Checked \(Int(Double(threadCount * operationCount) / elapsed)) operations/s on \(threadCount) threads")
+    }
+}
@@ -0,0 +1,44 @@
+@testable import AblyLiveObjects
+import Foundation
+import Testing
+
+struct TombstoneQueueTests {
+    private static let epoch = Date(timeIntervalSince1970: 1_700_000_000)
+
+    private static func date(_ seconds: TimeInterval) -> Date {
+        epoch.addingTimeInterval(seconds)
+    }
+
+    @Test
+    func popsElementsInTombstoneOrderUpToTheCutoff() {
+        var queue = TombstoneQueue<String>()
+        for (element, seconds) in [("c", 30.0), ("a", 10), ("e", 50), ("b", 20), ("d", 40)] {
+            queue.schedule(element, tombstonedAt: Self.date(seconds))
+        }
+
+        var popped: [String] = []
+        while let element = queue.popElement(tombstonedAtOrBefore: Self.date(35)) {
+            popped.append(element)
+        }
+
+        #expect(popped == ["a", "b", "c"])
+        #expect(queue.count == 2)
+        #expect(queue.earliestTombstonedAt == Self.date(40))
+    }
+
+    @Test
+    func keepsOnlyTheEarliestScheduleOfAnElement() {
+        var queue = TombstoneQueue<String>()
+        queue.schedule("a", tombstonedAt: Self.date(20))
+        // Later: ignored
+        queue.schedule("a", tombstonedAt: Self.date(30))
+        // Earlier: replaces the schedule at 20
+        queue.schedule("a", tombstonedAt: Self.date(10))
+
+        #expect(queue.count == 1)
+        #expect(queue.popElement(tombstonedAtOrBefore: Self.date(10)) == "a")
+        // The stale schedule at 20 is not popped
+        #expect(queue.popElement(tombstonedAtOrBefore: Self.date(100)) == nil)
+        #expect(queue.isEmpty)
+    }
+}
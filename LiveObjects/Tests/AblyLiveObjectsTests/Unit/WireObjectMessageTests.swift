@@ -1,4 +1,5 @@
 import _AblyPluginSupportPrivate
+import Ably.Private
 @testable import AblyLiveObjects
 import Foundation
 import Testing
@@ -97,6 +98,52 @@ enum WireObjectMessageTests {
             let msg = try InboundWireObjectMessage(wireObject: wire, decodingContext: ctx)
             #expect(msg.timestamp == parentValue)
         }
+
+        // Decodes an OBJECT_SYNC of about 50 MB of MessagePack, as deserialized by ably-cocoa, the way that
+        // `DefaultInternalPlugin.decodeObjectMessage` does.
+        @Test(.tags(.benchmark), .enabled(if: isBenchmarkingEnabled))
+        func benchmarkDecodeLargeMessagePackSync() throws {
+            let objectCount = 500
+            let entriesPerObject = 1000
+            let siteTimeserial = "01726585978590-001@abcdefghij:001"
+            let serializedMessages: [[String: Any]] = (0 ..< objectCount).map { objectIndex in
+                var entries: [String: Any] = [:]
+                entries.reserveCapacity(entriesPerObject)
+                for entryIndex in 0 ..< entriesPerObject {
+                    entries["key-\(entryIndex)"] = [
+                        "tombstone": false,
+                        "timeserial": siteTimeserial,
+                        "data": ["string": "value-\(objectIndex)-\(entryIndex)-\(String(repeating: "x", count: 24))"],
+                    ]
+                }
+                return [
+                    "object": [
+                        "objectId": "map:object-\(objectIndex)@1",
+                        "siteTimeserials": ["abcdefghij": siteTimeserial],
+                        "tombstone": false,
+                        "map": ["semantics": 0, "entries": entries],
+                    ],
+                ]
+            }
+
+            // Round-trip through MessagePack so that the input has the types that ably-cocoa produces
+            let msgPackData = try ARTMsgPackEncoder().encode(serializedMessages)
+            let deserializedMessages = try #require(ARTMsgPackEncoder().decode(msgPackData) as? [[String: Any]])
+
+            let decodingContext = FakeDecodingContext(parentID: nil, parentConnectionID: nil, parentTimestamp: nil, indexInParent: 0)
+            let start = Date()
+            let objectMessages = try deserializedMessages.map { serialized in
+                let wireObjectMessage = try InboundWireObjectMessage(
+                    wireObject: WireValue.objectFromPluginSupportData(serialized),
+                    decodingContext: decodingContext,
+                )
+                return try ProtocolTypes.InboundObjectMessage(wireObjectMessage: wireObjectMessage, format: .messagePack)
+            }
+            print("Decoded \(objectCount * entriesPerObject) map entries from \(msgPackData.count) bytes of MessagePack in \(Date().timeIntervalSince(start))s")
+
+            #expect(objectMessages.count == objectCount)
+            #expect(objectMessages.allSatisfy { $0.object?.map?.entries?.count == entriesPerObject })
+        }
     }
 
     struct OutboundWireObjectMessageEncodingTests {
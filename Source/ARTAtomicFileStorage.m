@@ -1,5 +1,8 @@
 #import "ARTAtomicFileStorage.h"
 #import "ARTInternalLog.h"
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdio.h>
 
 @implementation ARTAtomicFileStorage {
     ARTInternalLog *_logger;
@@ -16,6 +19,10 @@
     return self;
 }
 
+- (NSURL *)temporaryFileURL {
+    return [_fileURL URLByAppendingPathExtension:@"tmp"];
+}
+
 - (BOOL)fileExists {
     [_lock lock];
     BOOL exists = [[NSFileManager defaultManager] fileExistsAtPath:_fileURL.path];
@@ -73,7 +80,7 @@
             return NO;
         }
 
-        NSDataWritingOptions options = NSDataWritingAtomic;
+        NSDataWritingOptions options = 0;
         // `NSDataWritingFileProtectionNone` is only available on macOS 11+; on
         // iOS/tvOS it's always available (use of `*` below). Older macOS has no
         // data-protection concept, so skipping it there is fine.
@@ -87,9 +94,34 @@
           options |= NSDataWritingFileProtectionNone;
         }
 
+        // Write the new contents to a temporary file and only then rename it
+        // over the file, so that a crash at any point leaves either the old or
+        // the new contents in place, never a mix of the two.
+        NSURL *const temporaryURL = self.temporaryFileURL;
         NSError *writeError = nil;
-        BOOL ok = [data writeToURL:_fileURL options:options error:&writeError];
+        BOOL ok = [data writeToURL:temporaryURL options:options error:&writeError];
+        if (ok) {
+            // Make sure the new contents are on disk before the rename is, so
+            // that a power loss can't leave the renamed file empty.
+            const int fd = open(temporaryURL.fileSystemRepresentation, O_RDONLY);
+            if (fd < 0 || fsync(fd) != 0) {
+                ok = NO;
+                writeError = [NSError errorWithDomain:NSPOSIXErrorDomain code:errno userInfo:nil];
+            }
+            if (fd >= 0) {
+                close(fd);
+            }
+        }
+        if (ok && _beforeReplacingFile) {
+            writeError = _beforeReplacingFile(temporaryURL);
+            ok = writeError == nil;
+        }
+        if (ok && rename(temporaryURL.fileSystemRepresentation, _fileURL.fileSystemRepresentation) != 0) {
+            ok = NO;
+            writeError = [NSError errorWithDomain:NSPOSIXErrorDomain code:errno userInfo:nil];
+        }
         if (!ok) {
+            [[NSFileManager defaultManager] removeItemAtURL:temporaryURL error:nil];
             if (outError) *outError = writeError;
             ARTLogError(_logger, @"ARTAtomicFileStorage: failed to write %@: %@", _fileURL.lastPathComponent, writeError.localizedDescription);
             return NO;
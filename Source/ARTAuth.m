@@ -23,6 +23,8 @@
 #import "ARTInternalLog.h"
 #import "ARTLocalDeviceStorage.h"
 #import "ARTTimeProvider.h"
+#import "ARTSharedTokenCache.h"
+#import "ARTTokenRequestSigner.h"
 #import "ARTTestClientOptions.h"
 #import "ARTClientOptions+TestConfiguration.h"
 #import "ARTLocalDevice+Private.h"
@@ -87,6 +89,10 @@
     [_internal createTokenRequest:callback];
 }
 
+- (ARTTokenRequest *)createTokenRequestSynchronously:(ARTTokenParams *)tokenParams error:(NSError **)error {
+    return [_internal createTokenRequestSynchronously:tokenParams error:error];
+}
+
 @end
 
 NS_ASSUME_NONNULL_BEGIN
@@ -99,6 +105,9 @@ NS_ASSUME_NONNULL_BEGIN
 
 NS_ASSUME_NONNULL_END
 
+// The key under which an `ARTAuthInternal`'s queue holds itself as its queue-specific context.
+static const void *const ARTAuthInternalQueueKey = &ARTAuthInternalQueueKey;
+
 @implementation ARTAuthInternal {
     __weak ARTRestInternal *_rest; // weak because rest owns auth
     dispatch_queue_t _userQueue;
@@ -108,6 +117,11 @@ NS_ASSUME_NONNULL_END
     NSInteger _authorizationsCount;
     ARTEventEmitter<ARTEvent *, ARTErrorInfo *> *_cancelationEventEmitter;
     id<ARTTimeProvider> _timeProvider;
+    id<ARTSchedulerHandle> _tokenRenewalWork;
+    // The callbacks of the token renewal in progress, if there is one (see `_renewToken:`).
+    NSMutableArray<ARTTokenDetailsCallback> *_tokenRenewalCallbacks;
+    // For the key that token requests were last signed with
+    ARTTokenRequestSigner *_tokenRequestSigner;
 }
 
 - (instancetype)init:(ARTRestInternal *)rest withOptions:(ARTClientOptions *)options logger:(ARTInternalLog *)logger {
@@ -115,6 +129,8 @@ NS_ASSUME_NONNULL_END
         _rest = rest;
         _userQueue = rest.userQueue;
         _queue = rest.queue;
+        // Marks the queue so that `createTokenRequestSynchronously:error:` can tell when it's called on it
+        dispatch_queue_set_specific(_queue, ARTAuthInternalQueueKey, (__bridge void *)_queue, NULL);
         _tokenDetails = options.tokenDetails;
         _options = options;
         _logger = logger;
@@ -124,6 +140,7 @@ NS_ASSUME_NONNULL_END
         _tokenParams = options.defaultTokenParams ? : [[ARTTokenParams alloc] initWithOptions:self.options];
         _authorizationsCount = 0;
         [self validate:options];
+        [self scheduleTokenRenewal];
 
         [[NSNotificationCenter defaultCenter] addObserver:self
                                                  selector:@selector(didReceiveCurrentLocaleDidChangeNotification:)
@@ -147,6 +164,7 @@ NS_ASSUME_NONNULL_END
 
 - (void)dealloc {
     [self removeTimeOffsetObserver];
+    [_tokenRenewalWork cancel];
 }
 
 - (void)removeTimeOffsetObserver {
@@ -303,8 +321,12 @@ NS_ASSUME_NONNULL_END
 }
 
 - (BOOL)tokenRemainsValid {
-    if (self.tokenDetails && self.tokenDetails.token) {
-        if (self.tokenDetails.expires == nil) {
+    return [self tokenDetailsRemainValid:self.tokenDetails];
+}
+
+- (BOOL)tokenDetailsRemainValid:(ARTTokenDetails *)tokenDetails {
+    if (tokenDetails && tokenDetails.token) {
+        if (tokenDetails.expires == nil) {
             return YES;
         }
 
@@ -313,7 +335,7 @@ NS_ASSUME_NONNULL_END
         if (![self hasTimeOffset]) {
             return YES;
         }
-        if ([self.tokenDetails.expires timeIntervalSinceDate:[self currentDate]] > 0) {
+        if ([tokenDetails.expires timeIntervalSinceDate:[self currentDate]] > 0) {
             return YES;
         }
     }
@@ -580,7 +602,7 @@ art_dispatch_async(_queue, ^{
     ARTLogVerbose(self.logger, @"RS:%p ARTAuthInternal [authorize.%@, delegate=%@]: requesting new token", _rest, authorizeId, lastDelegate ? @"YES" : @"NO");
     NSObject<ARTCancellable> *task;
     self->_authorizationsCount += 1;
-    task = [self _requestToken:currentTokenParams withOptions:replacedOptions callback:^(ARTTokenDetails *tokenDetails, NSError *error) {
+    const ARTTokenDetailsCallback tokenCallback = ^(ARTTokenDetails *tokenDetails, NSError *error) {
         self->_authorizationsCount -= 1;
 
         void (^const successCallbackBlock)(void) = ^{
@@ -650,7 +672,24 @@ art_dispatch_async(_queue, ^{
         else {
             successCallbackBlock();
         }
-    }];
+    };
+
+    NSString *const sharedTokenCacheKey = self.options.sharesTokens ? [self sharedTokenCacheKeyForParams:currentTokenParams options:replacedOptions] : nil;
+    if (sharedTokenCacheKey) {
+        task = [[ARTSharedTokenCache sharedCache] tokenForKey:sharedTokenCacheKey
+                                                    replacing:self.tokenDetails.token
+                                                      isValid:^BOOL(ARTTokenDetails *cached) {
+            return [self tokenDetailsRemainValid:cached];
+        }
+                                                        queue:_queue
+                                                        fetch:^(ARTTokenDetailsCallback callback) {
+            [self _requestToken:currentTokenParams withOptions:replacedOptions callback:callback];
+        }
+                                                     callback:tokenCallback];
+    }
+    else {
+        task = [self _requestToken:currentTokenParams withOptions:replacedOptions callback:tokenCallback];
+    }
 
     [_cancelationEventEmitter once:^(ARTErrorInfo * _Nullable error) {
         hasBeenExplicitlyCanceled = YES;
@@ -660,6 +699,130 @@ art_dispatch_async(_queue, ^{
     return task;
 }
 
+// `items` sorted by name and then value, with every name and value percent-encoded so that the result is canonical and unambiguous.
+static NSString *ARTCanonicalQueryItems(NSArray<NSURLQueryItem *> *items) {
+    NSArray<NSURLQueryItem *> *const sorted = [items sortedArrayUsingComparator:^NSComparisonResult(NSURLQueryItem *item1, NSURLQueryItem *item2) {
+        const NSComparisonResult result = [item1.name compare:item2.name options:NSLiteralSearch];
+        return result != NSOrderedSame ? result : [(item1.value ?: @"") compare:(item2.value ?: @"") options:NSLiteralSearch];
+    }];
+    NSCharacterSet *const allowed = [NSCharacterSet alphanumericCharacterSet];
+    NSMutableArray<NSString *> *const pairs = [NSMutableArray arrayWithCapacity:sorted.count];
+    for (NSURLQueryItem *item in sorted) {
+        [pairs addObject:[NSString stringWithFormat:@"%@=%@",
+                          [item.name stringByAddingPercentEncodingWithAllowedCharacters:allowed],
+                          [(item.value ?: @"") stringByAddingPercentEncodingWithAllowedCharacters:allowed]]];
+    }
+    return [pairs componentsJoinedByString:@"&"];
+}
+
+- (NSString *)sharedTokenCacheKeyForParams:(ARTTokenParams *)params options:(ARTAuthOptions *)options {
+    NSString *credentials;
+    if (options.authCallback) {
+        // Blocks can't be compared, and the address of a freed one can be reused by another client's, so a callback's tokens are only shared under an identity that the app vouches for.
+        NSString *const identity = self.options.sharedTokenCacheIdentity;
+        if (!identity) {
+            return nil;
+        }
+        credentials = [NSString stringWithFormat:@"authCallback:%@", identity];
+    }
+    else if (options.authUrl) {
+        NSMutableArray<NSURLQueryItem *> *const headers = [NSMutableArray array];
+        [options.authHeaders enumerateKeysAndObjectsUsingBlock:^(NSString *name, NSString *value, BOOL *stop) {
+            [headers addObject:[NSURLQueryItem queryItemWithName:name value:value]];
+        }];
+        credentials = [NSString stringWithFormat:@"authUrl:%@ %@ headers:%@ params:%@", options.authMethod, options.authUrl.absoluteString, ARTCanonicalQueryItems(headers), ARTCanonicalQueryItems(options.authParams ?: @[])];
+    }
+    else {
+        credentials = [NSString stringWithFormat:@"key:%@", options.key];
+    }
+    return [NSString stringWithFormat:@"%@\n%@\nclientId:%@\nttl:%@\ncapability:%@", self.options.restHost, credentials, params.clientId ? params.clientId : self.options.clientId, params.ttl, params.capability];
+}
+
+- (void)invalidateSharedToken {
+    if (self.options.sharesTokens && self.tokenDetails.token) {
+        [[ARTSharedTokenCache sharedCache] invalidateToken:self.tokenDetails.token];
+    }
+}
+
+- (void)_renewToken:(ARTTokenDetailsCallback)callback {
+    if (_tokenRenewalCallbacks) {
+        ARTLogDebug(self.logger, @"RS:%p ARTAuthInternal: joining the token renewal in progress", _rest);
+        if (callback) {
+            [_tokenRenewalCallbacks addObject:callback];
+        }
+        return;
+    }
+
+    _tokenRenewalCallbacks = [NSMutableArray array];
+    if (callback) {
+        [_tokenRenewalCallbacks addObject:callback];
+    }
+    [self _authorize:_tokenParams options:self.options callback:^(ARTTokenDetails *tokenDetails, NSError *error) {
+        NSArray<ARTTokenDetailsCallback> *const callbacks = self->_tokenRenewalCallbacks;
+        self->_tokenRenewalCallbacks = nil;
+        if (error) {
+            ARTLogWarn(self.logger, @"RS:%p ARTAuthInternal: token renewal failed: %@", self->_rest, error);
+        }
+        for (ARTTokenDetailsCallback callback in callbacks) {
+            callback(tokenDetails, error);
+        }
+    }];
+}
+
+- (void)scheduleTokenRenewal {
+    [_tokenRenewalWork cancel];
+    _tokenRenewalWork = nil;
+    _tokenRenewalDeadline = nil;
+    _tokenRenewalDeferred = NO;
+
+    const double fraction = self.options.tokenRenewalFraction;
+    ARTTokenDetails *const tokenDetails = _tokenDetails;
+    if (fraction <= 0 || fraction >= 1 || !tokenDetails.issued || !tokenDetails.expires || ![self tokenIsRenewable]) {
+        return;
+    }
+    const NSTimeInterval ttl = [tokenDetails.expires timeIntervalSinceDate:tokenDetails.issued];
+    if (ttl <= 0) {
+        return;
+    }
+
+    NSTimeInterval delay = ttl * fraction;
+    // RSA4b1: The local clock is only trusted to tell how long ago the token was issued once it has been adjusted to the server's; otherwise the token is assumed to be new.
+    if ([self hasTimeOffset]) {
+        delay = MAX(0, delay - [[self currentDate] timeIntervalSinceDate:tokenDetails.issued]);
+    }
+
+    ARTLogDebug(self.logger, @"RS:%p ARTAuthInternal: renewing the token in %.1fs", _rest, delay);
+    _tokenRenewalDeadline = [[_timeProvider continuousClockNow] addingDuration:delay];
+    __weak ARTAuthInternal *weakSelf = self;
+    _tokenRenewalWork = [_timeProvider scheduleAfter:delay queue:_queue block:^{
+        [weakSelf renewTokenProactively];
+    }];
+}
+
+- (void)renewTokenProactively {
+    _tokenRenewalWork = nil;
+    if (self.authorizing_nosync) {
+        // Whichever token that authorization obtains schedules the next renewal.
+        return;
+    }
+    const id<ARTAuthDelegate> delegate = self.delegate;
+    if ([delegate respondsToSelector:@selector(authShouldRenewTokenProactively:)] && ![delegate authShouldRenewTokenProactively:self]) {
+        ARTLogDebug(self.logger, @"RS:%p ARTAuthInternal: deferring the proactive token renewal", _rest);
+        _tokenRenewalDeferred = YES;
+        return;
+    }
+    [self _renewToken:nil];
+}
+
+- (void)renewTokenIfRenewalWasDeferred {
+    if (!_tokenRenewalDeferred || _tokenRenewalWork) {
+        return;
+    }
+    _tokenRenewalDeferred = NO;
+    ARTLogDebug(self.logger, @"RS:%p ARTAuthInternal: renewing the token, which was due while it couldn't be", _rest);
+    [self renewTokenProactively];
+}
+
 - (void)cancelAuthorization:(nullable ARTErrorInfo *)error {
     ARTLogDebug(self.logger, @"RS:%p authorization cancelled with %@", self->_rest, error);
     [_cancelationEventEmitter emit:nil with:error];
@@ -710,7 +873,7 @@ art_dispatch_async(_queue, ^{
 
     if ([self hasTimeOffsetWithValue] && !replacedOptions.queryTime) {
         currentTokenParams.timestamp = [self currentDate];
-        callback([currentTokenParams sign:replacedOptions.key], nil);
+        callback([self signTokenParams:currentTokenParams key:replacedOptions.key], nil);
         return nil;
     }
     else {
@@ -723,16 +886,68 @@ art_dispatch_async(_queue, ^{
                     NSDate *serverTime = [self handleServerTime:time];
                     self->_timeOffset = @([serverTime timeIntervalSinceNow]);
                     currentTokenParams.timestamp = serverTime;
-                    callback([currentTokenParams sign:replacedOptions.key], nil);
+                    callback([self signTokenParams:currentTokenParams key:replacedOptions.key], nil);
                 }
             }];
         } else {
-            callback([currentTokenParams sign:replacedOptions.key], nil);
+            callback([self signTokenParams:currentTokenParams key:replacedOptions.key], nil);
             return nil;
         }
     }
 }
 
+- (ARTTokenRequestSigner *)tokenRequestSignerForKey:(NSString *)key {
+    if (![_tokenRequestSigner.key isEqualToString:key]) {
+        _tokenRequestSigner = [[ARTTokenRequestSigner alloc] initWithKey:key];
+    }
+    return _tokenRequestSigner;
+}
+
+- (ARTTokenRequest *)signTokenParams:(ARTTokenParams *)tokenParams key:(NSString *)key {
+    ARTTokenRequestSigner *const signer = [self tokenRequestSignerForKey:key];
+    // A malformed key fails the same way as it always has.
+    return signer ? [signer signTokenParams:tokenParams] : [tokenParams sign:key];
+}
+
+- (ARTTokenRequest *)createTokenRequestSynchronously:(ARTTokenParams *)tokenParams error:(NSError **)error {
+    __block ARTTokenRequestSigner *signer;
+    __block ARTTokenParams *currentTokenParams;
+    void (^const readState)(void) = ^{
+        if (self.options.key) {
+            signer = [self tokenRequestSignerForKey:self.options.key];
+        }
+        currentTokenParams = tokenParams ? [tokenParams copy] : [self->_tokenParams copy];
+        // The local clock, adjusted to the server's if the offset between them is known
+        currentTokenParams.timestamp = [self currentDate];
+    };
+    // Called from a block running on the internal queue, for example by an authCallback invoked with `internalDispatchQueue` as the user queue, `dispatch_sync` would deadlock.
+    if (dispatch_get_specific(ARTAuthInternalQueueKey) == (__bridge void *)_queue) {
+        readState();
+    } else {
+        art_dispatch_sync(_queue, readState);
+    }
+
+    if (!signer) {
+        if (error) {
+            *error = [ARTErrorInfo createWithCode:ARTErrorInvalidCredentials message:@"no valid key provided for signing token requests"];
+        }
+        return nil;
+    }
+
+    if (currentTokenParams.capability) {
+        NSError *errorCapability = nil;
+        [NSJSONSerialization JSONObjectWithData:[currentTokenParams.capability dataUsingEncoding:NSUTF8StringEncoding] options:0 error:&errorCapability];
+        if (errorCapability) {
+            if (error) {
+                *error = [ARTErrorInfo createWithCode:ARTErrorInvalidRequestBody message:[NSString stringWithFormat:@"Capability: %@", errorCapability.localizedDescription]];
+            }
+            return nil;
+        }
+    }
+
+    return [signer signTokenParams:currentTokenParams];
+}
+
 // For mocking when testing.
 - (NSDate *)handleServerTime:(NSDate *)time {
     return time;
@@ -797,6 +1012,7 @@ art_dispatch_sync(_queue, ^{
 
 - (void)setTokenDetails:(ARTTokenDetails *)tokenDetails {
     _tokenDetails = tokenDetails;
+    [self scheduleTokenRenewal];
     #if TARGET_OS_IOS
     [self setLocalDeviceClientId_nosync:tokenDetails.clientId];
     #endif
@@ -26,7 +26,10 @@
 }
 
 - (id)decodeWithEncoder:(ARTDataEncoder*)encoder error:(NSError **)error {
-    ARTDataEncoderOutput *decoded = [encoder decode:self.data encoding:self.encoding];
+    return [self decodeWithEncoderOutput:[encoder decode:self.data encoding:self.encoding] error:error];
+}
+
+- (id)decodeWithEncoderOutput:(ARTDataEncoderOutput *)decoded error:(NSError **)error {
     if (decoded.errorInfo && error) {
         *error = [NSError errorWithDomain:ARTAblyErrorDomain code:decoded.errorInfo.code userInfo:@{NSLocalizedDescriptionKey: @"decoding failed",
                                                                                NSLocalizedFailureReasonErrorKey: decoded.errorInfo.message}];
@@ -0,0 +1,58 @@
+#import "ARTBatchPresenceResult.h"
+
+@implementation ARTBatchPresenceSuccessResult
+
+- (instancetype)initWithChannel:(NSString *)channel presence:(NSArray<ARTPresenceMessage *> *)presence {
+    if (self = [super init]) {
+        _channel = channel;
+        _presence = presence;
+    }
+    return self;
+}
+
+- (NSString *)description {
+    return [NSString stringWithFormat:@"<%@: %p> { channel: %@, presence: %@ }", self.class, self, self.channel, self.presence];
+}
+
+@end
+
+@implementation ARTBatchPresenceFailureResult
+
+- (instancetype)initWithChannel:(NSString *)channel error:(ARTErrorInfo *)error {
+    if (self = [super init]) {
+        _channel = channel;
+        _error = error;
+    }
+    return self;
+}
+
+- (NSString *)description {
+    return [NSString stringWithFormat:@"<%@: %p> { channel: %@, error: %@ }", self.class, self, self.channel, self.error];
+}
+
+@end
+
+@implementation ARTBatchPresenceResult
+
+- (instancetype)initWithSuccesses:(NSArray<ARTBatchPresenceSuccessResult *> *)successes
+                         failures:(NSArray<ARTBatchPresenceFailureResult *> *)failures {
+    if (self = [super init]) {
+        _successes = successes;
+        _failures = failures;
+    }
+    return self;
+}
+
+- (NSUInteger)successCount {
+    return _successes.count;
+}
+
+- (NSUInteger)failureCount {
+    return _failures.count;
+}
+
+- (NSString *)description {
+    return [NSString stringWithFormat:@"<%@: %p> { successes: %@, failures: %@ }", self.class, self, self.successes, self.failures];
+}
+
+@end
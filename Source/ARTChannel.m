@@ -60,6 +60,7 @@
     [self recreateDataEncoderWith:options.cipher];
 }
 
+// The new encoder starts without any delta bases, since those of the old one were decrypted with the previous cipher params.
 - (void)recreateDataEncoderWith:(ARTCipherParams*)cipher {
     NSError *error = nil;
     _dataEncoder = [[ARTDataEncoder alloc] initWithCipherParams:cipher logger:self.logger error:&error];
@@ -54,6 +54,12 @@ NSString *ARTDefaultEnvironment = nil;
     _fallbackRetryTimeout = 600.0; // Seconds, TO3l10
     _httpMaxRetryDuration = 15.0; //Seconds
     _httpMaxRetryCount = 3;
+    _httpHedgingDelay = 0; // Disabled
+    _maxConcurrentHTTPRequests = 0; // Unlimited
+    _sharesHTTPSession = false;
+    _sharesTokens = false;
+    _localDeviceStorageWriteBehindInterval = 0; // Write-through
+    _tokenRenewalFraction = 0; // Disabled
     _fallbackHosts = nil;
     _fallbackHostsUseDefault = false;
     _dispatchQueue = dispatch_get_main_queue();
@@ -134,8 +140,15 @@ NSString *ARTDefaultEnvironment = nil;
     options.channelRetryTimeout = self.channelRetryTimeout;
     options.httpMaxRetryCount = self.httpMaxRetryCount;
     options.httpMaxRetryDuration = self.httpMaxRetryDuration;
+    options.httpHedgingDelay = self.httpHedgingDelay;
     options.httpOpenTimeout = self.httpOpenTimeout;
     options.fallbackRetryTimeout = self.fallbackRetryTimeout;
+    options.maxConcurrentHTTPRequests = self.maxConcurrentHTTPRequests;
+    options.sharesHTTPSession = self.sharesHTTPSession;
+    options.sharesTokens = self.sharesTokens;
+    options.sharedTokenCacheIdentity = self.sharedTokenCacheIdentity;
+    options.localDeviceStorageWriteBehindInterval = self.localDeviceStorageWriteBehindInterval;
+    options.tokenRenewalFraction = self.tokenRenewalFraction;
     options->_fallbackHosts = self.fallbackHosts; //ignore setter
 
 #pragma clang diagnostic push
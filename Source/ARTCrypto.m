@@ -4,6 +4,7 @@
 #import <CommonCrypto/CommonCrypto.h>
 
 #define ART_CBC_BLOCK_LENGTH (16)
+#define ART_RANDOM_POOL_LENGTH (1024)
 
 @interface ARTCipherParams ()
 
@@ -110,7 +111,40 @@
 
 @end
 
-@implementation ARTCbcCipher
+/**
+ Random bytes (for IVs) generated ART_RANDOM_POOL_LENGTH at a time, to avoid a call to `SecRandomCopyBytes` per message. `offset` is the start of the unused bytes. Not thread-safe.
+ */
+typedef struct {
+    uint8_t bytes[ART_RANDOM_POOL_LENGTH];
+    size_t offset;
+} ARTRandomPool;
+
+static void ARTRandomPoolInit(ARTRandomPool *pool) {
+    pool->offset = sizeof(pool->bytes);
+}
+
+static BOOL ARTRandomPoolRead(ARTRandomPool *pool, void *output, size_t length) {
+    if (pool->offset + length > sizeof(pool->bytes)) {
+        if (SecRandomCopyBytes(kSecRandomDefault, sizeof(pool->bytes), pool->bytes) != 0) {
+            return NO;
+        }
+        pool->offset = 0;
+    }
+    memcpy(output, pool->bytes + pool->offset, length);
+    // Don't keep a copy of the bytes once they have been handed out.
+    memset(pool->bytes + pool->offset, 0, length);
+    pool->offset += length;
+    return YES;
+}
+
+@implementation ARTCbcCipher {
+    // Created lazily and then reset with a fresh IV for each message, so that the key schedule is only expanded once per cipher. A channel's cipher is used both when publishing and when decoding received messages, which may happen on different queues, so `_encryptor` is guarded by `self` and `_decryptor` by `_decryptorLock`.
+    CCCryptorRef _encryptor;
+    CCCryptorRef _decryptor;
+    NSLock *_decryptorLock;
+    // Guarded by `self`.
+    ARTRandomPool _ivPool;
+}
 
 - (id)initWithCipherParams:(ARTCipherParams *)cipherParams logger:(ARTInternalLog *)logger {
     self = [super init];
@@ -119,6 +153,9 @@
         _iv = cipherParams.iv;
         _blockLength = ART_CBC_BLOCK_LENGTH;
         _logger = logger;
+        ARTRandomPoolInit(&_ivPool);
+        _decryptorLock = [[NSLock alloc] init];
+        _decryptorLock.name = @"io.ably.ARTCbcCipher.decryptor";
 
         if (![cipherParams ccAlgorithm:&_algorithm error:nil]) {
             return nil;
@@ -127,6 +164,15 @@
     return self;
 }
 
+- (void)dealloc {
+    if (_encryptor) {
+        CCCryptorRelease(_encryptor);
+    }
+    if (_decryptor) {
+        CCCryptorRelease(_decryptor);
+    }
+}
+
 -(size_t) keyLength {
     return [self.keySpec length] *8;
 }
@@ -135,8 +181,33 @@
     return [[self alloc] initWithCipherParams:cipherParams logger:logger];
 }
 
+// Only AES contexts are reused; CCCryptorReset is not meaningful for the other (legacy) algorithms, which keep using one-shot CCCrypt.
+- (BOOL)reusesCryptor {
+    return self.algorithm == kCCAlgorithmAES;
+}
+
+// Must be called while holding the lock that guards `cryptor`. Creates the cryptor for `operation` if needed and resets it to start a new message with `iv`.
+- (CCCryptorStatus)cryptor:(CCCryptorRef *)cryptor forOperation:(CCOperation)operation options:(CCOptions)options iv:(const void *)iv {
+    if (*cryptor == NULL) {
+        return CCCryptorCreate(operation, self.algorithm, options, [self.keySpec bytes], [self.keySpec length], iv, cryptor);
+    }
+    return CCCryptorReset(*cryptor, iv);
+}
+
+// Must be called while holding the lock that guards `cryptor`. Runs a whole message through `cryptor`, which has just been reset.
+- (CCCryptorStatus)runCryptor:(CCCryptorRef)cryptor dataIn:(const void *)dataIn dataInLength:(size_t)dataInLength dataOut:(void *)dataOut dataOutAvailable:(size_t)dataOutAvailable dataOutMoved:(size_t *)dataOutMoved {
+    size_t updateBytesWritten = 0;
+    CCCryptorStatus status = CCCryptorUpdate(cryptor, dataIn, dataInLength, dataOut, dataOutAvailable, &updateBytesWritten);
+    if (status) {
+        return status;
+    }
+    size_t finalBytesWritten = 0;
+    status = CCCryptorFinal(cryptor, ((char *)dataOut) + updateBytesWritten, dataOutAvailable - updateBytesWritten, &finalBytesWritten);
+    *dataOutMoved = updateBytesWritten + finalBytesWritten;
+    return status;
+}
+
 - (ARTStatus *)encrypt:(NSData *)plaintext output:(NSData *__autoreleasing *)output {
-    NSData *iv = self.iv != nil ? self.iv : [ARTCrypto generateSecureRandomData:self.blockLength];
     NSData *ciphertext = nil;
 
     // The maximum cipher text is plaintext length + block length. We are also prepending this with the IV so need 2 block lengths in addition to the plaintext length.
@@ -148,25 +219,40 @@
         return [ARTStatus state:ARTStateError];
     }
 
-    // Copy the iv first
-    memcpy(buf, [iv bytes], self.blockLength);
-
     void *ciphertextBuf = ((char *)buf) + self.blockLength;
     size_t ciphertextBufLen = outputBufLen - self.blockLength;
 
-    const void *key = [self.keySpec bytes];
-    size_t keyLen = [self.keySpec length];
-
-    const void *ivBytes = [iv bytes];
     const void *dataIn = [plaintext bytes];
     size_t dataInLen = [plaintext length];
 
     size_t bytesWritten = 0;
-    CCCryptorStatus status = CCCrypt(kCCEncrypt, self.algorithm, kCCOptionPKCS7Padding, key, keyLen, ivBytes, dataIn, dataInLen, ciphertextBuf, ciphertextBufLen, &bytesWritten);
+    CCCryptorStatus status;
+
+    @synchronized (self) {
+        // The IV goes first, and is read back from there
+        if (self.iv != nil) {
+            memcpy(buf, [self.iv bytes], self.blockLength);
+        }
+        else if (!ARTRandomPoolRead(&_ivPool, buf, self.blockLength)) {
+            ARTLogError(self.logger, @"ARTCrypto error encrypting. Failed to generate an IV");
+            free(buf);
+            return [ARTStatus state:ARTStateError];
+        }
+
+        if ([self reusesCryptor]) {
+            status = [self cryptor:&_encryptor forOperation:kCCEncrypt options:kCCOptionPKCS7Padding iv:buf];
+            if (status == kCCSuccess) {
+                status = [self runCryptor:_encryptor dataIn:dataIn dataInLength:dataInLen dataOut:ciphertextBuf dataOutAvailable:ciphertextBufLen dataOutMoved:&bytesWritten];
+            }
+        }
+        else {
+            status = CCCrypt(kCCEncrypt, self.algorithm, kCCOptionPKCS7Padding, [self.keySpec bytes], [self.keySpec length], buf, dataIn, dataInLen, ciphertextBuf, ciphertextBufLen, &bytesWritten);
+        }
+    }
 
     if (status) {
         ARTLogError(self.logger, @"ARTCrypto error encrypting. Status is %d", status);
-        free(ciphertextBuf);
+        free(buf);
         return [ARTStatus state: ARTStateError];
     }
 
@@ -182,67 +268,92 @@
     return [ARTStatus state:ARTStateOk];
 }
 
+- (size_t)maxDecryptedLengthForCiphertextLength:(size_t)length {
+    // The iv takes up the first block, and the output will never be more than the rest of the input + block length
+    return length < self.blockLength ? 0 : length;
+}
+
 - (ARTStatus *)decrypt:(NSData *)ciphertext output:(NSData *__autoreleasing *)output {
     // The first *blockLength* bytes are the iv
     if ([ciphertext length] < self.blockLength) {
-        return [ARTStatus state: ARTStateInvalidArgs];;
+        return [ARTStatus state:ARTStateInvalidArgs info:[ARTErrorInfo createWithCode:ARTErrorInvalidMessageDataOrEncoding message:@"decrypt failed: ciphertext is shorter than the IV"]];
     }
 
-    NSData *ivData = [ciphertext subdataWithRange:NSMakeRange(0, self.blockLength)];
-    NSData *actualCiphertext = [ciphertext subdataWithRange:NSMakeRange(self.blockLength, [ciphertext length] - self.blockLength)];
-
-    CCOptions options = 0;
-    const void *key = [self.keySpec bytes];
-    size_t keyLength = [self.keySpec length];
-
-    const void *iv = [ivData bytes];
-    const void *dataIn = [actualCiphertext bytes];
-    size_t dataInLength = [actualCiphertext length];
-
-    // The output will never be more than the input + block length
-    size_t outputLength = dataInLength + self.blockLength;
+    size_t outputLength = [self maxDecryptedLengthForCiphertextLength:[ciphertext length]];
     void *buf = malloc(outputLength);
-    size_t bytesWritten = 0;
 
     if (!buf) {
         ARTLogError(self.logger, @"ARTCrypto error decrypting.");
         return [ARTStatus state:ARTStateError];
     }
 
+    size_t unpaddedLength = 0;
+    ARTStatus *status = [self decrypt:ciphertext intoBuffer:buf capacity:outputLength length:&unpaddedLength];
+    if (status.state != ARTStateOk) {
+        free(buf);
+        return status;
+    }
+
+    NSData *plaintext = [NSData dataWithBytesNoCopy:buf length:unpaddedLength freeWhenDone:YES];
+    if (!plaintext) {
+        ARTLogError(self.logger, @"ARTCrypto error decrypting. plain text is nil");
+        free(buf);
+    }
+
+    *output = plaintext;
+
+    return [ARTStatus state:ARTStateOk];
+}
+
+- (ARTStatus *)decrypt:(NSData *)ciphertext intoBuffer:(void *)buf capacity:(size_t)capacity length:(size_t *)length {
+    // The first *blockLength* bytes are the iv
+    if ([ciphertext length] < self.blockLength || capacity < [self maxDecryptedLengthForCiphertextLength:[ciphertext length]]) {
+        return [ARTStatus state:ARTStateInvalidArgs info:[ARTErrorInfo createWithCode:ARTErrorInvalidMessageDataOrEncoding message:@"decrypt failed: ciphertext is shorter than the IV"]];
+    }
+
+    // Read the iv and the actual ciphertext straight out of the input, without copying them
+    const void *iv = [ciphertext bytes];
+    const void *dataIn = ((const char *)[ciphertext bytes]) + self.blockLength;
+    size_t dataInLength = [ciphertext length] - self.blockLength;
+    size_t bytesWritten = 0;
+
     // Decrypt without padding because CCCrypt does not return an error code
     // if the decrypted value is not padded correctly
-    CCCryptorStatus status = CCCrypt(kCCDecrypt, self.algorithm, options, key, keyLength, iv, dataIn, dataInLength, buf, outputLength, &bytesWritten);
+    CCOptions options = 0;
+    CCCryptorStatus status;
+
+    // When another thread is using the reusable context (e.g. when a batch of messages is decrypted concurrently), don't wait for it.
+    if ([self reusesCryptor] && [_decryptorLock tryLock]) {
+        status = [self cryptor:&_decryptor forOperation:kCCDecrypt options:options iv:iv];
+        if (status == kCCSuccess) {
+            status = [self runCryptor:_decryptor dataIn:dataIn dataInLength:dataInLength dataOut:buf dataOutAvailable:capacity dataOutMoved:&bytesWritten];
+        }
+        [_decryptorLock unlock];
+    }
+    else {
+        status = CCCrypt(kCCDecrypt, self.algorithm, options, [self.keySpec bytes], [self.keySpec length], iv, dataIn, dataInLength, buf, capacity, &bytesWritten);
+    }
 
     if (status) {
         ARTLogError(self.logger, @"ARTCrypto error decrypting. Status is %d", status);
-        free(buf);
-        return [ARTStatus state:ARTStateError];
+        return [ARTStatus state:ARTStateError info:[ARTErrorInfo createWithCode:ARTErrorInvalidMessageDataOrEncoding message:[NSString stringWithFormat:@"decrypt failed: CommonCrypto status %d", status]]];
     }
 
     // Check that the decrypted value is padded correctly and determine the unpadded length
     const char *cbuf = (char *)buf;
-    int paddingLength = cbuf[bytesWritten - 1];
+    int paddingLength = bytesWritten > 0 ? cbuf[bytesWritten - 1] : 0;
 
-    if (0 == paddingLength || paddingLength > bytesWritten) {            free(buf);
-        return [ARTStatus state:ARTStateCryptoBadPadding];
+    if (0 == paddingLength || paddingLength > bytesWritten) {
+        return [ARTStatus state:ARTStateCryptoBadPadding info:[ARTErrorInfo createWithCode:ARTErrorInvalidMessageDataOrEncoding message:@"decrypt failed: bad padding"]];
     }
 
     for (size_t i=(bytesWritten - 1); i>(bytesWritten - paddingLength); --i) {
         if (paddingLength != cbuf[i-1]) {
-            free(buf);
-            return [ARTStatus state:ARTStateCryptoBadPadding];
+            return [ARTStatus state:ARTStateCryptoBadPadding info:[ARTErrorInfo createWithCode:ARTErrorInvalidMessageDataOrEncoding message:@"decrypt failed: bad padding"]];
         }
     }
 
-    size_t unpaddedLength = bytesWritten - paddingLength;
-
-    NSData *plaintext = [NSData dataWithBytesNoCopy:buf length:unpaddedLength freeWhenDone:YES];
-    if (!plaintext) {
-        ARTLogError(self.logger, @"ARTCrypto error decrypting. plain text is nil");
-        free(buf);
-    }
-
-    *output = plaintext;
+    *length = bytesWritten - paddingLength;
 
     return [ARTStatus state:ARTStateOk];
 }
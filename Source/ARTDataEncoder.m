@@ -1,7 +1,15 @@
 #import "ARTCrypto+Private.h"
 #import "ARTDataEncoder.h"
+#import "ARTDeltaBaseCache.h"
 #import <AblyDeltaCodec/AblyDeltaCodec.h>
 
+// Below these, the cost of dispatching to other threads outweighs that of decrypting on the current one.
+static const NSUInteger ARTDataEncoderConcurrentDecryptionMinimumCount = 8;
+static const size_t ARTDataEncoderConcurrentDecryptionMinimumLength = 64 * 1024;
+
+// Enough for deltas interleaved across a handful of message names, without holding on to many payloads.
+static const NSUInteger ARTDataEncoderDeltaBaseCacheCapacity = 16;
+
 @implementation ARTDataEncoderOutput
 
 - (id)initWithData:(id)data encoding:(NSString *)encoding errorInfo:(ARTErrorInfo *)errorInfo {
@@ -18,6 +26,7 @@
 
 @implementation ARTDataEncoder {
     id<ARTChannelCipher> _cipher;
+    NSString *_cipherEncoding;
     ARTDeltaCodec *_deltaCodec;
     NSString *_baseId;
 }
@@ -36,21 +45,52 @@
                 }
                 return nil;
             }
+            _cipherEncoding = [ARTDataEncoder cipherEncodingForCipher:_cipher];
         }
 
         _deltaCodec = [[ARTDeltaCodec alloc] init];
+        _deltaBaseCache = [[ARTDeltaBaseCache alloc] initWithCapacity:ARTDataEncoderDeltaBaseCacheCapacity];
+    }
+    return self;
+}
+
+- (instancetype)initWithCipher:(id<ARTChannelCipher>)cipher cipherEncoding:(NSString *)cipherEncoding {
+    self = [super init];
+    if (self) {
+        _cipher = cipher;
+        _cipherEncoding = cipherEncoding;
+        _deltaCodec = [[ARTDeltaCodec alloc] init];
+        _deltaBaseCache = [[ARTDeltaBaseCache alloc] initWithCapacity:ARTDataEncoderDeltaBaseCacheCapacity];
     }
     return self;
 }
 
+- (ARTDataEncoder *)decoderWithoutDeltaBases {
+    return [[ARTDataEncoder alloc] initWithCipher:_cipher cipherEncoding:_cipherEncoding];
+}
+
+- (void)removeAllDeltaBases {
+    _deltaCodec = [[ARTDeltaCodec alloc] init];
+    _baseId = nil;
+    [_deltaBaseCache removeAllBases];
+}
+
 - (void)setDeltaCodecBase:(nullable id)data identifier:(NSString *)identifier {
     _baseId = identifier;
+    NSData *base = nil;
     if ([data isKindOfClass:[NSData class]]) {
-        [_deltaCodec setBase:data withId:identifier];
+        base = data;
     }
     else if ([data isKindOfClass:[NSString class]]) {
         // PC3a
-        [_deltaCodec setBase:[data dataUsingEncoding:NSUTF8StringEncoding] withId:identifier];
+        base = [data dataUsingEncoding:NSUTF8StringEncoding];
+    }
+    if (!base) {
+        return;
+    }
+    [_deltaCodec setBase:base withId:identifier];
+    if (identifier.length > 0) {
+        [_deltaBaseCache setBase:base forId:identifier];
     }
 }
 
@@ -134,6 +174,16 @@
 }
 
 - (ARTDataEncoderOutput *)decode:(id)data identifier:(NSString *)identifier encoding:(NSString *)encoding {
+    return [self decode:data identifier:identifier deltaBaseId:nil encoding:encoding ciphertext:nil plaintext:nil decryptStatus:nil];
+}
+
+- (ARTDataEncoderOutput *)decode:(id)data identifier:(NSString *)identifier deltaBaseId:(NSString *)deltaBaseId encoding:(NSString *)encoding {
+    return [self decode:data identifier:identifier deltaBaseId:deltaBaseId encoding:encoding ciphertext:nil plaintext:nil decryptStatus:nil];
+}
+
+// `deltaBaseId`, if given, is the id of the message that a vcdiff-encoded `data` is relative to.
+// If `decryptStatus` is given, the outermost two encodings must be the cipher encoding and "base64"; then `ciphertext` is the base64-decoded `data` and `decryptStatus` and `plaintext` the result of decrypting it.
+- (ARTDataEncoderOutput *)decode:(id)data identifier:(NSString *)identifier deltaBaseId:(NSString *)deltaBaseId encoding:(NSString *)encoding ciphertext:(NSData *)ciphertext plaintext:(NSData *)plaintext decryptStatus:(ARTStatus *)decryptStatus {
     if (!data || !encoding ) {
         [self setDeltaCodecBase:data identifier:identifier];
         return [[ARTDataEncoderOutput alloc] initWithData:data encoding:encoding errorInfo:nil];
@@ -153,15 +203,19 @@
         NSString *encoding = [encodings objectAtIndex:i-1];
 
         if ([encoding isEqualToString:@"base64"]) {
-            if ([data isKindOfClass:[NSData class]]) { // E. g. when decrypted.
-                data = [[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding];
-            }
-            if ([data isKindOfClass:[NSString class]]) {
-                // Note that this, in combination with the vcdiff decoding step below, gives us RTL19e1 (deriving the base payload in the case of a Base64-encoded delta message)
-                data = [[NSData alloc] initWithBase64EncodedString:(NSString *)data options:0];
+            if (decryptStatus && i == [encodings count]) { // Already decoded by decodeBatch:encodings:
+                data = ciphertext;
             } else {
-                errorInfo = [ARTErrorInfo createWithCode:ARTErrorInvalidMessageDataOrEncoding
-                                                 message:[NSString stringWithFormat:@"invalid data type for 'base64' decoding: '%@'", [data class]]];
+                if ([data isKindOfClass:[NSData class]]) { // E. g. when decrypted.
+                    data = [[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding];
+                }
+                if ([data isKindOfClass:[NSString class]]) {
+                    // Note that this, in combination with the vcdiff decoding step below, gives us RTL19e1 (deriving the base payload in the case of a Base64-encoded delta message)
+                    data = [[NSData alloc] initWithBase64EncodedString:(NSString *)data options:0];
+                } else {
+                    errorInfo = [ARTErrorInfo createWithCode:ARTErrorInvalidMessageDataOrEncoding
+                                                     message:[NSString stringWithFormat:@"invalid data type for 'base64' decoding: '%@'", [data class]]];
+                }
             }
 
             if (i == [encodings count] && ![encodings containsObject:@"vcdiff"]) {
@@ -191,13 +245,36 @@
                 errorInfo = [ARTErrorInfo createWithCode:ARTErrorInvalidMessageDataOrEncoding
                                                  message:[NSString stringWithFormat:@"invalid data type for 'json' decoding: '%@'", [data class]]];
             }
-        } else if (_cipher && [encoding isEqualToString:[self cipherEncoding]] && [data isKindOfClass:[NSData class]]) {
-            ARTStatus *status = [_cipher decrypt:data output:&data];
+        } else if (_cipher && [encoding isEqualToString:_cipherEncoding] && [data isKindOfClass:[NSData class]]) {
+            ARTStatus *status;
+            if (decryptStatus && i == [encodings count] - 1) {
+                status = decryptStatus;
+                if (status.state == ARTStateOk) {
+                    data = plaintext;
+                }
+            }
+            else {
+                status = [_cipher decrypt:data output:&data];
+            }
             if (status.state != ARTStateOk) {
                 errorInfo = status.errorInfo ? status.errorInfo : [ARTErrorInfo createWithCode:ARTErrorInvalidMessageDataOrEncoding message:@"decrypt failed"];
             }
+        } else if (_cipher && [encoding hasPrefix:@"cipher+"] && ![encoding isEqualToString:_cipherEncoding]) {
+            // Only the channel's own cipher is ever used to decrypt, so that a payload can't downgrade it to another algorithm, key length or mode.
+            errorInfo = [ARTErrorInfo createWithCode:ARTErrorInvalidMessageDataOrEncoding
+                                             message:[NSString stringWithFormat:@"encoding '%@' doesn't match the channel's cipher encoding '%@'", encoding, _cipherEncoding]];
         } else if ([encoding isEqualToString:@"vcdiff"] && _deltaCodec && [data isKindOfClass:[NSData class]]) {
             NSError *decodeError;
+            if (deltaBaseId.length > 0 && ![deltaBaseId isEqualToString:_baseId]) {
+                // Relative to an earlier message than the last one
+                NSData *const base = [_deltaBaseCache baseForId:deltaBaseId];
+                if (!base) {
+                    errorInfo = [ARTErrorInfo createWithCode:ARTErrorUnableToDecodeMessage message:[NSString stringWithFormat:@"no delta base for message '%@'", deltaBaseId]];
+                    break;
+                }
+                [_deltaCodec setBase:base withId:deltaBaseId];
+                _baseId = deltaBaseId;
+            }
             data = [_deltaCodec applyDelta:data deltaId:identifier baseId:_baseId error:&decodeError];
 
             if (decodeError) {
@@ -228,8 +305,134 @@
                                             errorInfo:errorInfo];
 }
 
+- (NSArray<ARTDataEncoderOutput *> *)decodeBatch:(NSArray *)data encodings:(NSArray *)encodings {
+    return [self decodeBatch:data encodings:encodings identifiers:nil deltaBaseIds:nil];
+}
+
+- (NSArray<ARTDataEncoderOutput *> *)decodeBatch:(NSArray *)data encodings:(NSArray *)encodings identifiers:(NSArray *)identifiers deltaBaseIds:(NSArray *)deltaBaseIds {
+    const NSUInteger count = data.count;
+    NSMutableArray<ARTDataEncoderOutput *> *outputs = [NSMutableArray arrayWithCapacity:count];
+
+    // First, base64-decode and decrypt every payload whose outermost encodings are the cipher's and "base64". Neither step depends on the other payloads or on the delta decoding state, so they can be done for the whole batch at once, into a single buffer.
+    NSString *const cipherEncoding = _cipherEncoding;
+    NSMutableArray *ciphertexts = [NSMutableArray arrayWithCapacity:count];
+    size_t *offsets = malloc((count + 1) * sizeof(size_t));
+    size_t arenaLength = 0;
+    BOOL hasCiphertexts = NO;
+    for (NSUInteger i = 0; i < count; i++) {
+        NSData *ciphertext = cipherEncoding ? [self base64DecodeCiphertext:data[i] encoding:encodings[i] cipherEncoding:cipherEncoding] : nil;
+        if (offsets) {
+            offsets[i] = arenaLength;
+        }
+        if (ciphertext) {
+            arenaLength += [_cipher maxDecryptedLengthForCiphertextLength:ciphertext.length];
+            hasCiphertexts = YES;
+        }
+        [ciphertexts addObject:ciphertext ? ciphertext : [NSNull null]];
+    }
+
+    // The statuses, rather than just their states, so that each payload's decoding error is the one that its decryption reported, as with `decode:encoding:`.
+    ARTStatus *__strong *statuses = hasCiphertexts ? (ARTStatus *__strong *)calloc(count, sizeof(ARTStatus *)) : NULL;
+    size_t *lengths = hasCiphertexts ? calloc(count, sizeof(size_t)) : NULL;
+    char *arena = hasCiphertexts ? malloc(arenaLength > 0 ? arenaLength : 1) : NULL;
+    NSData *arenaData = nil;
+    if (offsets && statuses && lengths && arena) {
+        offsets[count] = arenaLength;
+        id<ARTChannelCipher> const cipher = _cipher;
+        void (^const decrypt)(size_t) = ^(size_t i) {
+            @autoreleasepool {
+                NSData *const ciphertext = ciphertexts[i];
+                if ((id)ciphertext == [NSNull null]) {
+                    return;
+                }
+                statuses[i] = [cipher decrypt:ciphertext intoBuffer:arena + offsets[i] capacity:offsets[i + 1] - offsets[i] length:&lengths[i]];
+            }
+        };
+        if (count >= ARTDataEncoderConcurrentDecryptionMinimumCount && arenaLength >= ARTDataEncoderConcurrentDecryptionMinimumLength) {
+            dispatch_apply(count, dispatch_get_global_queue(qos_class_self(), 0), decrypt);
+        }
+        else {
+            for (size_t i = 0; i < count; i++) {
+                decrypt(i);
+            }
+        }
+        arenaData = [NSData dataWithBytesNoCopy:arena length:arenaLength freeWhenDone:YES];
+    }
+    else if (hasCiphertexts) {
+        // Couldn't allocate; just decode one by one below.
+        free(arena);
+        arena = NULL;
+    }
+
+    // Then the rest of the decoding, which has to happen in order because of delta decoding.
+    for (NSUInteger i = 0; i < count; i++) {
+        id payload = data[i] == [NSNull null] ? nil : data[i];
+        NSString *encoding = encodings[i] == [NSNull null] ? nil : encodings[i];
+        NSString *const identifier = identifiers && identifiers[i] != [NSNull null] ? identifiers[i] : @"";
+        NSString *const deltaBaseId = deltaBaseIds && deltaBaseIds[i] != [NSNull null] ? deltaBaseIds[i] : nil;
+        if (!payload) {
+            [outputs addObject:[[ARTDataEncoderOutput alloc] initWithData:nil encoding:encoding errorInfo:nil]];
+            continue;
+        }
+
+        NSData *const ciphertext = ciphertexts[i];
+        ARTDataEncoderOutput *output;
+        if (arenaData && (id)ciphertext != [NSNull null]) {
+            NSData *plaintext = nil;
+            if (statuses[i].state == ARTStateOk) {
+                // A view into the shared buffer, which it keeps alive.
+                plaintext = [[NSData alloc] initWithBytesNoCopy:arena + offsets[i] length:lengths[i] deallocator:^(void *bytes, NSUInteger length) {
+                    (void)arenaData;
+                }];
+            }
+            output = [self decode:payload identifier:identifier deltaBaseId:deltaBaseId encoding:encoding ciphertext:ciphertext plaintext:plaintext decryptStatus:statuses[i]];
+        }
+        else {
+            output = [self decode:payload identifier:identifier deltaBaseId:deltaBaseId encoding:encoding ciphertext:nil plaintext:nil decryptStatus:nil];
+        }
+        [outputs addObject:output];
+
+        if (output.errorInfo.code == ARTErrorUnableToDecodeMessage) {
+            // The delta decoding state is no longer usable for the payloads that follow.
+            break;
+        }
+    }
+
+    free(offsets);
+    if (statuses) {
+        for (NSUInteger i = 0; i < count; i++) {
+            statuses[i] = nil;
+        }
+        free(statuses);
+    }
+    free(lengths);
+
+    return outputs;
+}
+
+- (nullable NSData *)base64DecodeCiphertext:(id)data encoding:(id)encoding cipherEncoding:(NSString *)cipherEncoding {
+    if (![encoding isKindOfClass:[NSString class]]) {
+        return nil;
+    }
+    NSArray<NSString *> *const encodings = [encoding componentsSeparatedByString:@"/"];
+    if (encodings.count < 2 || ![encodings.lastObject isEqualToString:@"base64"] || ![encodings[encodings.count - 2] isEqualToString:cipherEncoding]) {
+        return nil;
+    }
+    if ([data isKindOfClass:[NSData class]]) {
+        data = [[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding];
+    }
+    if (![data isKindOfClass:[NSString class]]) {
+        return nil;
+    }
+    return [[NSData alloc] initWithBase64EncodedString:data options:0];
+}
+
 - (NSString *)cipherEncoding {
-    size_t keyLen = [_cipher keyLength];
+    return _cipherEncoding;
+}
+
++ (nullable NSString *)cipherEncodingForCipher:(id<ARTChannelCipher>)cipher {
+    size_t keyLen = [cipher keyLength];
     if (keyLen == 128) {
         return @"cipher+aes-128-cbc";
     } else if (keyLen == 256) {
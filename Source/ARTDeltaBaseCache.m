@@ -0,0 +1,86 @@
+#import "ARTDeltaBaseCache.h"
+
+@implementation ARTDeltaBaseCache {
+    NSMutableDictionary<NSString *, NSData *> *_bases;
+    // Ids of `_bases`, from least to most recently used.
+    NSMutableOrderedSet<NSString *> *_recency;
+    NSUInteger _hitCount;
+    NSUInteger _missCount;
+}
+
+- (instancetype)initWithCapacity:(NSUInteger)capacity {
+    if (self = [super init]) {
+        _capacity = capacity;
+        _bases = [NSMutableDictionary dictionaryWithCapacity:capacity];
+        _recency = [NSMutableOrderedSet orderedSetWithCapacity:capacity];
+    }
+    return self;
+}
+
+- (void)setBase:(NSData *)base forId:(NSString *)identifier {
+    if (_capacity == 0) {
+        return;
+    }
+    @synchronized (self) {
+        _bases[identifier] = base;
+        [_recency removeObject:identifier];
+        [_recency addObject:identifier];
+        while (_recency.count > _capacity) {
+            [_bases removeObjectForKey:_recency.firstObject];
+            [_recency removeObjectAtIndex:0];
+        }
+    }
+}
+
+- (NSData *)baseForId:(NSString *)identifier {
+    @synchronized (self) {
+        NSData *const base = _bases[identifier];
+        if (!base) {
+            _missCount++;
+            return nil;
+        }
+        _hitCount++;
+        [_recency removeObject:identifier];
+        [_recency addObject:identifier];
+        return base;
+    }
+}
+
+- (BOOL)containsBaseForId:(NSString *)identifier {
+    @synchronized (self) {
+        return _bases[identifier] != nil;
+    }
+}
+
+- (void)removeAllBases {
+    @synchronized (self) {
+        [_bases removeAllObjects];
+        [_recency removeAllObjects];
+    }
+}
+
+- (NSUInteger)count {
+    @synchronized (self) {
+        return _bases.count;
+    }
+}
+
+- (NSUInteger)hitCount {
+    @synchronized (self) {
+        return _hitCount;
+    }
+}
+
+- (NSUInteger)missCount {
+    @synchronized (self) {
+        return _missCount;
+    }
+}
+
+- (NSString *)description {
+    @synchronized (self) {
+        return [NSString stringWithFormat:@"<%@: %p> { count: %lu/%lu, hits: %lu, misses: %lu }", self.class, self, (unsigned long)_bases.count, (unsigned long)_capacity, (unsigned long)_hitCount, (unsigned long)_missCount];
+    }
+}
+
+@end
@@ -0,0 +1,268 @@
+#import "ARTDeltaEncoder.h"
+#import "ARTMessage.h"
+#import "ARTBaseMessage+Private.h"
+#import "ARTCrypto+Private.h"
+#import "ARTConstants.h"
+#import "ARTDataEncoder.h"
+
+// Matches shorter than this aren't worth a COPY instruction.
+#define ART_VCDIFF_BLOCK_LENGTH (16)
+#define ART_VCDIFF_HASH_MULTIPLIER (0x01000193u)
+
+// Default code table (RFC 3284, section 5.6) instructions that take an explicit size.
+#define ART_VCDIFF_ADD (1)
+#define ART_VCDIFF_COPY_SELF (19)
+
+static void ARTVcdiffAppendVarint(NSMutableData *output, uint64_t value) {
+    uint8_t bytes[10];
+    int i = sizeof(bytes);
+    bytes[--i] = value & 0x7f;
+    value >>= 7;
+    while (value > 0) {
+        bytes[--i] = 0x80 | (value & 0x7f);
+        value >>= 7;
+    }
+    [output appendBytes:bytes + i length:sizeof(bytes) - i];
+}
+
+static NSUInteger ARTVcdiffVarintLength(uint64_t value) {
+    NSUInteger length = 1;
+    while (value >= 0x80) {
+        value >>= 7;
+        length++;
+    }
+    return length;
+}
+
+static uint32_t ARTVcdiffHash(const uint8_t *bytes) {
+    uint32_t hash = 0;
+    for (int i = 0; i < ART_VCDIFF_BLOCK_LENGTH; i++) {
+        hash = hash * ART_VCDIFF_HASH_MULTIPLIER + bytes[i];
+    }
+    return hash;
+}
+
+@implementation ARTDeltaEncoder {
+    // The previous message's payload, as subscribers will use it as the base of the next delta (RTL19d, RTL19e), and that message's id.
+    NSData *_base;
+    NSString *_baseId;
+    NSUInteger _deltasSinceKeyframe;
+}
+
+- (instancetype)initWithKeyframeInterval:(NSUInteger)keyframeInterval {
+    if (self = [super init]) {
+        _keyframeInterval = keyframeInterval;
+    }
+    return self;
+}
+
+- (void)reset {
+    _base = nil;
+    _baseId = nil;
+    _deltasSinceKeyframe = 0;
+}
+
+- (NSArray<ARTMessage *> *)encodeMessages:(NSArray<ARTMessage *> *)messages {
+    NSMutableArray<ARTMessage *> *const encoded = [NSMutableArray arrayWithCapacity:messages.count];
+    for (ARTMessage *message in messages) {
+        [encoded addObject:[self encodeMessage:message]];
+    }
+    return encoded;
+}
+
+- (ARTMessage *)encodeMessage:(ARTMessage *)message {
+    if (message.isIdEmpty) {
+        message = [message copy];
+        NSData *const idData = [ARTCrypto generateSecureRandomData:ARTIdempotentLibraryGeneratedIdLength];
+        message.id = [NSString stringWithFormat:@"%@:0", [idData base64EncodedStringWithOptions:0]];
+    }
+
+    if (!message.data) {
+        // Subscribers don't decode a message without data, so their delta base stays the same; only the id that the next delta must refer to changes.
+        if (_base) {
+            _baseId = message.id;
+        }
+        return message;
+    }
+
+    NSData *const target = [ARTDeltaEncoder baseForData:message.data encoding:message.encoding];
+    if (!target) {
+        [self reset];
+        return message;
+    }
+
+    ARTMessage *deltaMessage = nil;
+    if (_base && _deltasSinceKeyframe + 1 < _keyframeInterval) {
+        deltaMessage = [self deltaMessageFor:message target:target];
+    }
+
+    _base = target;
+    _baseId = message.id;
+    if (deltaMessage) {
+        _deltasSinceKeyframe++;
+        return deltaMessage;
+    }
+    _deltasSinceKeyframe = 0;
+    return message;
+}
+
+- (nullable ARTMessage *)deltaMessageFor:(ARTMessage *)message target:(NSData *)target {
+    NSMutableDictionary *const extras = [NSMutableDictionary dictionary];
+    if (message.extras) {
+        NSDictionary *const existingExtras = [message.extras toJSON:nil];
+        if (!existingExtras || existingExtras[@"delta"]) {
+            return nil;
+        }
+        [extras addEntriesFromDictionary:existingExtras];
+    }
+
+    NSData *const delta = [ARTDeltaEncoder vcdiffFromSource:_base target:target];
+    NSString *const deltaString = [delta base64EncodedStringWithOptions:0];
+    const NSUInteger payloadLength = [message.data isKindOfClass:[NSString class]] ? [message.data lengthOfBytesUsingEncoding:NSUTF8StringEncoding] : [message.data length];
+    if (deltaString.length >= payloadLength) {
+        return nil;
+    }
+
+    // The encodings that the subscriber still has to apply once it has applied the delta.
+    NSString *encoding = message.encoding.length > 0 ? message.encoding : nil;
+    if ([[encoding artLastEncoding] isEqualToString:@"base64"]) {
+        encoding = [encoding artRemoveLastEncoding];
+    }
+    else if (!encoding && [message.data isKindOfClass:[NSString class]]) {
+        encoding = @"utf-8";
+    }
+
+    extras[@"delta"] = @{@"from": _baseId, @"format": @"vcdiff"};
+
+    ARTMessage *const deltaMessage = [message copy];
+    deltaMessage.data = deltaString;
+    deltaMessage.encoding = [NSString artAddEncoding:@"base64" toString:[NSString artAddEncoding:@"vcdiff" toString:encoding]];
+    deltaMessage.extras = extras;
+    return deltaMessage;
+}
+
+// RTL19d: what a subscriber will use as the delta base once it has received a message with this (non-delta) payload.
++ (nullable NSData *)baseForData:(id)data encoding:(NSString *)encoding {
+    if ([[encoding artLastEncoding] isEqualToString:@"base64"]) {
+        return [data isKindOfClass:[NSString class]] ? [[NSData alloc] initWithBase64EncodedString:data options:0] : nil;
+    }
+    if ([data isKindOfClass:[NSString class]]) {
+        return [data dataUsingEncoding:NSUTF8StringEncoding];
+    }
+    if ([data isKindOfClass:[NSData class]]) {
+        return data;
+    }
+    return nil;
+}
+
++ (NSData *)vcdiffFromSource:(NSData *)source target:(NSData *)target {
+    const uint8_t *const sourceBytes = source.bytes;
+    const uint8_t *const targetBytes = target.bytes;
+    const size_t sourceLength = source.length;
+    const size_t targetLength = target.length;
+
+    NSMutableData *const addData = [NSMutableData data];
+    NSMutableData *const instructions = [NSMutableData data];
+    NSMutableData *const addresses = [NSMutableData data];
+
+    // Index the source's aligned blocks by hash; each slot holds a block's offset + 1, so that 0 means empty.
+    const size_t blockCount = sourceLength / ART_VCDIFF_BLOCK_LENGTH;
+    size_t tableSize = 1;
+    while (tableSize < blockCount * 2) {
+        tableSize <<= 1;
+    }
+    uint32_t *const table = blockCount > 0 ? calloc(tableSize, sizeof(uint32_t)) : NULL;
+    if (table) {
+        for (size_t block = 0; block < blockCount; block++) {
+            const size_t offset = block * ART_VCDIFF_BLOCK_LENGTH;
+            const size_t slot = ARTVcdiffHash(sourceBytes + offset) & (tableSize - 1);
+            if (table[slot] == 0) {
+                table[slot] = (uint32_t)offset + 1;
+            }
+        }
+    }
+
+    // The hash of the block starting at `position` is rolled forward one byte at a time.
+    uint32_t highestPower = 1;
+    for (int i = 1; i < ART_VCDIFF_BLOCK_LENGTH; i++) {
+        highestPower *= ART_VCDIFF_HASH_MULTIPLIER;
+    }
+
+    size_t literalStart = 0;
+    size_t position = 0;
+    BOOL hashIsValid = NO;
+    uint32_t hash = 0;
+    while (table && position + ART_VCDIFF_BLOCK_LENGTH <= targetLength) {
+        if (!hashIsValid) {
+            hash = ARTVcdiffHash(targetBytes + position);
+            hashIsValid = YES;
+        }
+
+        const uint32_t candidate = table[hash & (tableSize - 1)];
+        if (candidate != 0 && memcmp(sourceBytes + candidate - 1, targetBytes + position, ART_VCDIFF_BLOCK_LENGTH) == 0) {
+            size_t matchSource = candidate - 1;
+            size_t matchTarget = position;
+            size_t matchLength = ART_VCDIFF_BLOCK_LENGTH;
+            while (matchSource + matchLength < sourceLength && matchTarget + matchLength < targetLength && sourceBytes[matchSource + matchLength] == targetBytes[matchTarget + matchLength]) {
+                matchLength++;
+            }
+            // Take back any of the pending literal bytes that also match.
+            while (matchSource > 0 && matchTarget > literalStart && sourceBytes[matchSource - 1] == targetBytes[matchTarget - 1]) {
+                matchSource--;
+                matchTarget--;
+                matchLength++;
+            }
+
+            if (matchTarget > literalStart) {
+                [instructions appendBytes:(uint8_t[]){ART_VCDIFF_ADD} length:1];
+                ARTVcdiffAppendVarint(instructions, matchTarget - literalStart);
+                [addData appendBytes:targetBytes + literalStart length:matchTarget - literalStart];
+            }
+            [instructions appendBytes:(uint8_t[]){ART_VCDIFF_COPY_SELF} length:1];
+            ARTVcdiffAppendVarint(instructions, matchLength);
+            // VCD_SELF addresses are absolute; the source segment comes first in the address space.
+            ARTVcdiffAppendVarint(addresses, matchSource);
+
+            position = matchTarget + matchLength;
+            literalStart = position;
+            hashIsValid = NO;
+            continue;
+        }
+
+        if (position + ART_VCDIFF_BLOCK_LENGTH < targetLength) {
+            hash = (hash - targetBytes[position] * highestPower) * ART_VCDIFF_HASH_MULTIPLIER + targetBytes[position + ART_VCDIFF_BLOCK_LENGTH];
+        }
+        position++;
+    }
+    free(table);
+
+    if (targetLength > literalStart) {
+        [instructions appendBytes:(uint8_t[]){ART_VCDIFF_ADD} length:1];
+        ARTVcdiffAppendVarint(instructions, targetLength - literalStart);
+        [addData appendBytes:targetBytes + literalStart length:targetLength - literalStart];
+    }
+
+    NSMutableData *const output = [NSMutableData dataWithCapacity:addData.length + instructions.length + addresses.length + 32];
+    // Header: magic, version 0, no secondary compressor or custom code table
+    [output appendBytes:(uint8_t[]){0xd6, 0xc3, 0xc4, 0x00, 0x00} length:5];
+
+    // A single window, whose source segment is the whole of `source`
+    [output appendBytes:(uint8_t[]){0x01 /* VCD_SOURCE */} length:1];
+    ARTVcdiffAppendVarint(output, sourceLength);
+    ARTVcdiffAppendVarint(output, 0);
+
+    const NSUInteger deltaEncodingLength = ARTVcdiffVarintLength(targetLength) + 1 + ARTVcdiffVarintLength(addData.length) + ARTVcdiffVarintLength(instructions.length) + ARTVcdiffVarintLength(addresses.length) + addData.length + instructions.length + addresses.length;
+    ARTVcdiffAppendVarint(output, deltaEncodingLength);
+    ARTVcdiffAppendVarint(output, targetLength);
+    [output appendBytes:(uint8_t[]){0x00 /* Delta_Indicator: no compression */} length:1];
+    ARTVcdiffAppendVarint(output, addData.length);
+    ARTVcdiffAppendVarint(output, instructions.length);
+    ARTVcdiffAppendVarint(output, addresses.length);
+    [output appendData:addData];
+    [output appendData:instructions];
+    [output appendData:addresses];
+
+    return output;
+}
+
+@end
@@ -3,6 +3,7 @@
 #import "ARTDefault+Private.h"
 #import "ARTStatus.h"
 #import "ARTHttp.h"
+#import "ARTHostStatsTracker.h"
 
 void (^const ARTFallback_shuffleArray)(NSMutableArray *) = ^void(NSMutableArray *a) {
     for (NSUInteger i = a.count; i > 1; i--) {
@@ -17,6 +18,10 @@ void (^const ARTFallback_shuffleArray)(NSMutableArray *) = ^void(NSMutableArray
 @implementation ARTFallback
 
 - (instancetype)initWithFallbackHosts:(nullable NSArray<NSString *> *)fallbackHosts shuffleArray:(void (^)(NSMutableArray *))shuffleArray {
+    return [self initWithFallbackHosts:fallbackHosts shuffleArray:shuffleArray hostStatsTracker:nil];
+}
+
+- (instancetype)initWithFallbackHosts:(nullable NSArray<NSString *> *)fallbackHosts shuffleArray:(void (^)(NSMutableArray *))shuffleArray hostStatsTracker:(nullable ARTHostStatsTracker *)hostStatsTracker {
     self = [super init];
     if (self) {
         if (fallbackHosts == nil || fallbackHosts.count == 0) {
@@ -24,6 +29,11 @@ void (^const ARTFallback_shuffleArray)(NSMutableArray *) = ^void(NSMutableArray
         }
         self.hosts = [[NSMutableArray alloc] initWithArray:fallbackHosts];
         shuffleArray(self.hosts);
+        if (hostStatsTracker) {
+            // Hosts are popped from the end; ranking them in popping order keeps the shuffled order between equally ranked hosts
+            NSArray<NSString *> *const rankedHosts = [hostStatsTracker rankHosts:self.hosts.reverseObjectEnumerator.allObjects];
+            self.hosts = [[NSMutableArray alloc] initWithArray:rankedHosts.reverseObjectEnumerator.allObjects];
+        }
     }
     return self;
 }
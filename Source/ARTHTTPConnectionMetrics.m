@@ -0,0 +1,78 @@
+#import "ARTHTTPConnectionMetrics.h"
+
+@implementation ARTHTTPConnectionMetrics {
+    NSUInteger _requestCount;
+    NSUInteger _reusedConnectionCount;
+    NSUInteger _openedConnectionCount;
+    NSUInteger _http2RequestCount;
+    NSTimeInterval _totalConnectDuration;
+}
+
+- (void)recordTransactionMetrics:(NSURLSessionTaskTransactionMetrics *)metrics {
+    // Transactions served from the local cache never touched the network.
+    if (metrics.resourceFetchType != NSURLSessionTaskMetricsResourceFetchTypeNetworkLoad) {
+        return;
+    }
+    @synchronized (self) {
+        _requestCount++;
+        if (metrics.reusedConnection) {
+            _reusedConnectionCount++;
+        } else {
+            _openedConnectionCount++;
+            if (metrics.connectStartDate && metrics.connectEndDate) {
+                _totalConnectDuration += [metrics.connectEndDate timeIntervalSinceDate:metrics.connectStartDate];
+            }
+        }
+        if ([metrics.networkProtocolName isEqualToString:@"h2"]) {
+            _http2RequestCount++;
+        }
+    }
+}
+
+- (void)reset {
+    @synchronized (self) {
+        _requestCount = 0;
+        _reusedConnectionCount = 0;
+        _openedConnectionCount = 0;
+        _http2RequestCount = 0;
+        _totalConnectDuration = 0;
+    }
+}
+
+- (NSUInteger)requestCount {
+    @synchronized (self) {
+        return _requestCount;
+    }
+}
+
+- (NSUInteger)reusedConnectionCount {
+    @synchronized (self) {
+        return _reusedConnectionCount;
+    }
+}
+
+- (NSUInteger)openedConnectionCount {
+    @synchronized (self) {
+        return _openedConnectionCount;
+    }
+}
+
+- (NSUInteger)http2RequestCount {
+    @synchronized (self) {
+        return _http2RequestCount;
+    }
+}
+
+- (NSTimeInterval)totalConnectDuration {
+    @synchronized (self) {
+        return _totalConnectDuration;
+    }
+}
+
+- (NSString *)description {
+    @synchronized (self) {
+        return [NSString stringWithFormat:@"<%@: %p> { requests: %lu, reused: %lu, opened: %lu, http2: %lu, connectDuration: %.3fs }", self.class, self, (unsigned long)_requestCount, (unsigned long)_reusedConnectionCount, (unsigned long)_openedConnectionCount, (unsigned long)_http2RequestCount, _totalConnectDuration];
+    }
+}
+
+@end
@@ -0,0 +1,24 @@
+#import "ARTHostStats+Private.h"
+
+@implementation ARTHostStats
+
+- (instancetype)initWithHost:(NSString *)host
+              averageLatency:(NSTimeInterval)averageLatency
+                   errorRate:(double)errorRate
+                 sampleCount:(NSUInteger)sampleCount
+             expectedLatency:(NSTimeInterval)expectedLatency {
+    if (self = [super init]) {
+        _host = host;
+        _averageLatency = averageLatency;
+        _errorRate = errorRate;
+        _sampleCount = sampleCount;
+        _expectedLatency = expectedLatency;
+    }
+    return self;
+}
+
+- (NSString *)description {
+    return [NSString stringWithFormat:@"<%@: %p> { host: %@, averageLatency: %.3fs, errorRate: %.2f, sampleCount: %lu, expectedLatency: %.3fs }", self.class, self, self.host, self.averageLatency, self.errorRate, (unsigned long)self.sampleCount, self.expectedLatency];
+}
+
+@end
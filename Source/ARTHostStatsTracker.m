@@ -0,0 +1,129 @@
+#import "ARTHostStatsTracker.h"
+#import "ARTHostStats+Private.h"
+
+// The weight of the newest sample in the moving averages; higher values forget history faster.
+static const double ARTHostStatsSmoothingFactor = 0.3;
+
+@interface ARTHostStatsRecord : NSObject
+
+@property (nonatomic) NSTimeInterval averageLatency;
+@property (nonatomic) NSUInteger latencySampleCount;
+@property (nonatomic) double errorRate;
+@property (nonatomic) NSUInteger sampleCount;
+
+@end
+
+@implementation ARTHostStatsRecord
+@end
+
+@implementation ARTHostStatsTracker {
+    NSTimeInterval _failurePenalty;
+    NSMutableDictionary<NSString *, ARTHostStatsRecord *> *_records;
+}
+
+- (instancetype)initWithFailurePenalty:(NSTimeInterval)failurePenalty {
+    if (self = [super init]) {
+        _failurePenalty = failurePenalty;
+        _records = [NSMutableDictionary dictionary];
+    }
+    return self;
+}
+
+- (ARTHostStatsRecord *)recordForHost:(NSString *)host {
+    ARTHostStatsRecord *record = _records[host];
+    if (!record) {
+        record = [[ARTHostStatsRecord alloc] init];
+        _records[host] = record;
+    }
+    return record;
+}
+
+- (void)recordSuccessForHost:(NSString *)host latency:(NSTimeInterval)latency {
+    @synchronized (self) {
+        ARTHostStatsRecord *const record = [self recordForHost:host];
+        if (record.latencySampleCount == 0) {
+            record.averageLatency = latency;
+        } else {
+            record.averageLatency = ARTHostStatsSmoothingFactor * latency + (1 - ARTHostStatsSmoothingFactor) * record.averageLatency;
+        }
+        record.latencySampleCount++;
+        record.errorRate = (1 - ARTHostStatsSmoothingFactor) * record.errorRate;
+        record.sampleCount++;
+    }
+}
+
+- (void)recordFailureForHost:(NSString *)host {
+    @synchronized (self) {
+        ARTHostStatsRecord *const record = [self recordForHost:host];
+        record.errorRate = ARTHostStatsSmoothingFactor + (1 - ARTHostStatsSmoothingFactor) * record.errorRate;
+        record.sampleCount++;
+    }
+}
+
+- (void)reset {
+    @synchronized (self) {
+        [_records removeAllObjects];
+    }
+}
+
+// Must be called while synchronized.
+- (NSTimeInterval)defaultLatency {
+    NSTimeInterval total = 0;
+    NSUInteger count = 0;
+    for (ARTHostStatsRecord *record in _records.allValues) {
+        if (record.latencySampleCount > 0) {
+            total += record.averageLatency;
+            count++;
+        }
+    }
+    return count > 0 ? total / count : 0;
+}
+
+// Must be called while synchronized.
+- (NSTimeInterval)expectedLatencyOfRecord:(nullable ARTHostStatsRecord *)record defaultLatency:(NSTimeInterval)defaultLatency {
+    const NSTimeInterval latency = record.latencySampleCount > 0 ? record.averageLatency : defaultLatency;
+    return latency + record.errorRate * _failurePenalty;
+}
+
+// Must be called while synchronized.
+- (NSArray<NSString *> *)rankHosts_nosync:(NSArray<NSString *> *)hosts expectedLatencies:(NSDictionary<NSString *, NSNumber *> **)expectedLatenciesPtr {
+    const NSTimeInterval defaultLatency = [self defaultLatency];
+    NSMutableDictionary<NSString *, NSNumber *> *const expectedLatencies = [NSMutableDictionary dictionaryWithCapacity:hosts.count];
+    for (NSString *host in hosts) {
+        expectedLatencies[host] = @([self expectedLatencyOfRecord:_records[host] defaultLatency:defaultLatency]);
+    }
+    if (expectedLatenciesPtr) {
+        *expectedLatenciesPtr = expectedLatencies;
+    }
+    return [hosts sortedArrayWithOptions:NSSortStable usingComparator:^NSComparisonResult(NSString *host1, NSString *host2) {
+        return [expectedLatencies[host1] compare:expectedLatencies[host2]];
+    }];
+}
+
+- (NSArray<NSString *> *)rankHosts:(NSArray<NSString *> *)hosts {
+    @synchronized (self) {
+        if (_records.count == 0) {
+            return hosts;
+        }
+        return [self rankHosts_nosync:hosts expectedLatencies:nil];
+    }
+}
+
+- (NSArray<ARTHostStats *> *)statsForHosts:(NSArray<NSString *> *)hosts {
+    @synchronized (self) {
+        NSDictionary<NSString *, NSNumber *> *expectedLatencies = nil;
+        NSArray<NSString *> *const rankedHosts = [self rankHosts_nosync:hosts expectedLatencies:&expectedLatencies];
+        NSMutableArray<ARTHostStats *> *const stats = [NSMutableArray arrayWithCapacity:rankedHosts.count];
+        for (NSString *host in rankedHosts) {
+            ARTHostStatsRecord *const record = _records[host];
+            [stats addObject:[[ARTHostStats alloc] initWithHost:host
+                                                 averageLatency:record.averageLatency
+                                                      errorRate:record.errorRate
+                                                    sampleCount:record.sampleCount
+                                                expectedLatency:expectedLatencies[host].doubleValue]];
+        }
+        return stats;
+    }
+}
+
+@end
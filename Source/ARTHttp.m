@@ -1,7 +1,9 @@
 #import "ARTHttp+Private.h"
 #import "ARTURLSessionServerTrust.h"
+#import "ARTClientOptions.h"
 #import "ARTConstants.h"
 #import "ARTInternalLog.h"
+#import "ARTGCD.h"
 
 @interface ARTHttp ()
 
@@ -9,12 +11,27 @@
 
 @end
 
+/**
+ A request that is waiting for a free slot because `maxConcurrentHTTPRequests` has been reached. Cancelling it before it starts removes it from the queue; cancelling it afterwards cancels the underlying task.
+ */
+@interface ARTHttpPendingRequest : NSObject <ARTCancellable>
+
+@property (readonly, nonatomic) NSURLRequest *request;
+@property (readonly, nonatomic) ARTURLRequestCallback callback;
+@property (nullable, nonatomic) NSObject<ARTCancellable> *task;
+
+- (instancetype)initWithRequest:(NSURLRequest *)request http:(ARTHttp *)http callback:(ARTURLRequestCallback)callback;
+
+@end
+
 Class configuredUrlSessionClass = nil;
 
 #pragma mark - ARTHttp
 
 @implementation ARTHttp {
     ARTInternalLog *_logger;
+    NSUInteger _maxConcurrentRequests;
+    NSMutableArray<ARTHttpPendingRequest *> *_pendingRequests;
 }
 
 + (void)setURLSessionClass:(const Class)urlSessionClass {
@@ -22,11 +39,22 @@ Class configuredUrlSessionClass = nil;
 }
 
 - (instancetype)initWithQueue:(dispatch_queue_t)queue logger:(ARTInternalLog *)logger {
+    return [self initWithQueue:queue options:nil logger:logger];
+}
+
+- (instancetype)initWithQueue:(dispatch_queue_t)queue options:(ARTClientOptions *)options logger:(ARTInternalLog *)logger {
     self = [super init];
     if (self) {
         const Class urlSessionClass = configuredUrlSessionClass ? configuredUrlSessionClass : [ARTURLSessionServerTrust class];
-        _urlSession = [[urlSessionClass alloc] init:queue];
+        if (options.sharesHTTPSession && [urlSessionClass instancesRespondToSelector:@selector(init:sharingSession:)]) {
+            _urlSession = [[urlSessionClass alloc] init:queue sharingSession:YES];
+        }
+        else {
+            _urlSession = [[urlSessionClass alloc] init:queue];
+        }
         _logger = logger;
+        _maxConcurrentRequests = options.maxConcurrentHTTPRequests;
+        _pendingRequests = [NSMutableArray array];
     }
     return self;
 }
@@ -39,14 +67,71 @@ Class configuredUrlSessionClass = nil;
     return _urlSession.queue;
 }
 
+- (NSUInteger)pendingRequestCount {
+    return _pendingRequests.count;
+}
+
+- (ARTHTTPConnectionMetrics *)connectionMetrics {
+    if ([_urlSession respondsToSelector:@selector(connectionMetrics)]) {
+        return _urlSession.connectionMetrics;
+    }
+    return nil;
+}
+
 - (void)dealloc {
     [_urlSession finishTasksAndInvalidate];
 }
 
 - (NSObject<ARTCancellable> *)executeRequest:(NSMutableURLRequest *)request completion:(ARTURLRequestCallback)callback {
+    if (_maxConcurrentRequests == 0) {
+        return [self startRequest:request completion:callback];
+    }
+
+    ARTHttpPendingRequest *const pendingRequest = [[ARTHttpPendingRequest alloc] initWithRequest:request http:self callback:callback];
+    if (_inFlightRequestCount < _maxConcurrentRequests) {
+        [self startPendingRequest:pendingRequest];
+    }
+    else {
+        ARTLogDebug(self.logger, @"HTTP:%p %lu requests in flight; queueing %@ %@", self, (unsigned long)_inFlightRequestCount, request.HTTPMethod, request.URL.absoluteString);
+        [_pendingRequests addObject:pendingRequest];
+    }
+    return pendingRequest;
+}
+
+- (void)startPendingRequest:(ARTHttpPendingRequest *)pendingRequest {
+    pendingRequest.task = [self startRequest:pendingRequest.request completion:^(NSHTTPURLResponse *response, NSData *data, NSError *error) {
+        [self startNextPendingRequests];
+        pendingRequest.callback(response, data, error);
+    }];
+}
+
+- (void)startNextPendingRequests {
+    while (_pendingRequests.count > 0 && _inFlightRequestCount < _maxConcurrentRequests) {
+        ARTHttpPendingRequest *const next = _pendingRequests.firstObject;
+        [_pendingRequests removeObjectAtIndex:0];
+        [self startPendingRequest:next];
+    }
+}
+
+- (void)cancelPendingRequest:(ARTHttpPendingRequest *)pendingRequest {
+    if (pendingRequest.task) {
+        [pendingRequest.task cancel];
+        return;
+    }
+    if (![_pendingRequests containsObject:pendingRequest]) {
+        return;
+    }
+    [_pendingRequests removeObject:pendingRequest];
+    ARTLogDebug(self.logger, @"HTTP:%p cancelled queued %@ %@", self, pendingRequest.request.HTTPMethod, pendingRequest.request.URL.absoluteString);
+    pendingRequest.callback(nil, nil, [NSError errorWithDomain:NSURLErrorDomain code:NSURLErrorCancelled userInfo:nil]);
+}
+
+- (NSObject<ARTCancellable> *)startRequest:(NSURLRequest *)request completion:(ARTURLRequestCallback)callback {
     ARTLogDebug(self.logger, @"--> %@ %@\n  Body: %@\n  Headers: %@", request.HTTPMethod, request.URL.absoluteString, [self debugDescriptionOfBodyWithData:request.HTTPBody], request.allHTTPHeaderFields);
 
+    _inFlightRequestCount++;
     return [_urlSession get:request completion:^(NSHTTPURLResponse *response, NSData *data, NSError *error) {
+        self->_inFlightRequestCount--;
         NSHTTPURLResponse *httpResponse = (NSHTTPURLResponse *)response;
         if (error) {
             ARTLogError(self.logger, @"<-- %@ %@: error %@", request.HTTPMethod, request.URL.absoluteString, error);
@@ -73,3 +158,30 @@ Class configuredUrlSessionClass = nil;
 }
 
 @end
+
+#pragma mark - ARTHttpPendingRequest
+
+@implementation ARTHttpPendingRequest {
+    __weak ARTHttp *_http; // weak because the http owns its pending requests
+}
+
+- (instancetype)initWithRequest:(NSURLRequest *)request http:(ARTHttp *)http callback:(ARTURLRequestCallback)callback {
+    if (self = [super init]) {
+        _request = request;
+        _http = http;
+        _callback = callback;
+    }
+    return self;
+}
+
+- (void)cancel {
+    ARTHttp *const http = _http;
+    if (!http) {
+        return;
+    }
+    art_dispatch_async(http.queue, ^{
+        [http cancelPendingRequest:self];
+    });
+}
+
+@end
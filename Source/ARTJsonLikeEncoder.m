@@ -18,6 +18,7 @@
 #import "ARTProtocolMessage+Private.h"
 #import "ARTPublishResult.h"
 #import "ARTPublishResultSerial.h"
+#import "ARTBatchPresenceResult.h"
 #import "ARTUpdateDeleteResult.h"
 #import "ARTNSDictionary+ARTDictionaryUtil.h"
 #import "ARTNSDate+ARTUtil.h"
@@ -1133,6 +1134,46 @@
     return [self publishResultFromDictionary:[self decodeDictionary:data error:error]];
 }
 
+- (ARTBatchPresenceResult *)decodeBatchPresenceResult:(NSData *)data error:(NSError **)error {
+    return [self batchPresenceResultFromDictionary:[self decodeDictionary:data error:error]];
+}
+
+- (ARTBatchPresenceResult *)batchPresenceResultFromDictionary:(NSDictionary *)input {
+    ARTLogVerbose(_logger, @"RS:%p ARTJsonLikeEncoder<%@>: batchPresenceResultFromDictionary %@", _rest, [_delegate formatAsString], input);
+    if (![input isKindOfClass:[NSDictionary class]]) {
+        return nil;
+    }
+    NSArray *results = [input objectForKey:@"results"];
+    if (![results isKindOfClass:[NSArray class]]) {
+        return nil;
+    }
+
+    NSMutableArray<ARTBatchPresenceSuccessResult *> *successes = [NSMutableArray array];
+    NSMutableArray<ARTBatchPresenceFailureResult *> *failures = [NSMutableArray array];
+    for (NSDictionary *item in results) {
+        if (![item isKindOfClass:[NSDictionary class]]) {
+            return nil;
+        }
+        NSString *channel = [item artString:@"channel"];
+        if (!channel) {
+            return nil;
+        }
+        NSDictionary *error = [item objectForKey:@"error"];
+        if ([error isKindOfClass:[NSDictionary class]]) {
+            ARTErrorInfo *errorInfo = [ARTErrorInfo createWithCode:[[error artNumber:@"code"] intValue] status:[[error artNumber:@"statusCode"] intValue] message:[error artString:@"message"]];
+            [failures addObject:[[ARTBatchPresenceFailureResult alloc] initWithChannel:channel error:errorInfo]];
+            continue;
+        }
+        NSArray *presence = [self presenceMessagesFromArray:[item objectForKey:@"presence"] ?: @[]];
+        if (!presence) {
+            return nil;
+        }
+        [successes addObject:[[ARTBatchPresenceSuccessResult alloc] initWithChannel:channel presence:presence]];
+    }
+
+    return [[ARTBatchPresenceResult alloc] initWithSuccesses:successes failures:failures];
+}
+
 - (ARTUpdateDeleteResult *)updateDeleteResultFromDictionary:(NSDictionary *)input {
     ARTLogVerbose(_logger, @"RS:%p ARTJsonLikeEncoder<%@>: updateDeleteResultFromDictionary %@", _rest, [_delegate formatAsString], input);
     if (![input isKindOfClass:[NSDictionary class]]) {
@@ -9,6 +9,7 @@
 #import "ARTInternalLog.h"
 #import "ARTTypes+Private.h"
 #import "ARTPushActivationStateMachine+Private.h"
+#import "ARTPushPersistenceCodec.h"
 
 NSString *const ARTDevicePlatform = @"ios";
 
@@ -32,6 +33,7 @@ NSString *const ARTDevicePushTransportType = @"apns";
 NSString *const ARTDeviceIdKey = @"ARTDeviceId";
 NSString *const ARTDeviceSecretKey = @"ARTDeviceSecret";
 NSString *const ARTDeviceIdentityTokenKey = @"ARTDeviceIdentityToken";
+NSString *const ARTDeviceCompactIdentityTokenKey = @"ARTDeviceIdentityTokenCompact";
 NSString *const ARTAPNSDeviceTokenKey = @"ARTAPNSDeviceToken";
 NSString *const ARTClientIdKey = @"ARTClientId";
 
@@ -93,9 +95,16 @@ NSString* ARTAPNSDeviceTokenKeyOfType(NSString *tokenType) {
         device.id = deviceId;
         device.secret = deviceSecret;
 
-        ARTDeviceIdentityTokenDetails *identityTokenDetails = [ARTDeviceIdentityTokenDetails art_unarchiveFromStorage:storage
-                                                                                                                  key:ARTDeviceIdentityTokenKey
-                                                                                                           withLogger:logger];
+        NSData *const identityTokenData = [ARTPushPersistenceCodec dataForKey:ARTDeviceCompactIdentityTokenKey legacyKey:ARTDeviceIdentityTokenKey storage:storage];
+        ARTDeviceIdentityTokenDetails *identityTokenDetails = identityTokenData ? [ARTPushPersistenceCodec identityTokenDetailsWithData:identityTokenData logger:logger] : nil;
+        if (identityTokenDetails && ![ARTPushPersistenceCodec isEncodedData:identityTokenData]) {
+            // Persisted by an older SDK version; unlike the activation state, it isn't rewritten until the device is registered again
+            [ARTPushPersistenceCodec setCompactData:[ARTPushPersistenceCodec dataWithIdentityTokenDetails:identityTokenDetails]
+                                            archive:[ARTPushPersistenceCodec writesLegacyArchivesToStorage:storage] ? identityTokenData : nil
+                                             forKey:ARTDeviceCompactIdentityTokenKey
+                                          legacyKey:ARTDeviceIdentityTokenKey
+                                            storage:storage];
+        }
         device->_identityTokenDetails = identityTokenDetails;
 
         NSString *clientId = [storage objectForKey:ARTClientIdKey];
@@ -184,14 +193,19 @@ NSString* ARTAPNSDeviceTokenKeyOfType(NSString *tokenType) {
 }
 
 - (void)setAndPersistIdentityTokenDetails:(ARTDeviceIdentityTokenDetails *)tokenDetails {
-    NSData *tokenData = [tokenDetails art_archiveWithLogger:self.logger];
+    NSData *tokenData = tokenDetails ? [ARTPushPersistenceCodec dataWithIdentityTokenDetails:tokenDetails] : nil;
+    NSData *tokenArchive = [ARTPushPersistenceCodec writesLegacyArchivesToStorage:self.storage] ? [tokenDetails art_archiveWithLogger:self.logger] : nil;
     BOOL adoptClientId = (self.clientId == nil && tokenDetails.clientId != nil);
     _identityTokenDetails = tokenDetails;
     if (adoptClientId) {
         self.clientId = tokenDetails.clientId;
     }
     [self.storage performBatchUpdate:^(id<ARTDeviceStorage> writer) {
-        [writer setObject:tokenData forKey:ARTDeviceIdentityTokenKey];
+        [ARTPushPersistenceCodec setCompactData:tokenData
+                                        archive:tokenArchive
+                                         forKey:ARTDeviceCompactIdentityTokenKey
+                                      legacyKey:ARTDeviceIdentityTokenKey
+                                        storage:writer];
         if (adoptClientId) {
             [writer setObject:tokenDetails.clientId forKey:ARTClientIdKey];
         }
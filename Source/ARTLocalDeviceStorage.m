@@ -4,6 +4,11 @@
 #import "ARTInternalLog.h"
 #import "ARTLocalDevice+Private.h"
 #import "ARTPushActivationStateMachine+Private.h"
+#import "ARTTimeProvider.h"
+#import "ARTGCD.h"
+#if TARGET_OS_IOS
+#import <UIKit/UIKit.h>
+#endif
 
 static NSString *const ARTLocalDeviceStorageDirectoryName = @"Ably";
 static NSString *const ARTLocalDeviceStorageFileName = @"LocalDevice.plist";
@@ -23,6 +28,11 @@ NSString *const ARTMigratedFromLegacyStorageKey = @"ARTMigratedFromLegacyStorage
     NSInteger _batchDepth;
     BOOL _isModified;
 
+    // Write-behind; see `enableWriteBehindWithInterval:timeProvider:`. Writes happen on `_writeQueue`, in order.
+    id<ARTTimeProvider> _timeProvider;
+    dispatch_queue_t _writeQueue;
+    id<ARTSchedulerHandle> _scheduledWrite;
+
     ARTLegacyKeychainSecretReader _legacyKeychainReader;
 }
 
@@ -72,6 +82,13 @@ NSString *const ARTMigratedFromLegacyStorageKey = @"ARTMigratedFromLegacyStorage
     return self;
 }
 
+- (void)dealloc {
+    [[NSNotificationCenter defaultCenter] removeObserver:self];
+    [_scheduledWrite cancel];
+    // A scheduled write keeps the storage alive while it runs, so nothing can be writing now.
+    [self writeCacheIfModified];
+}
+
 + (NSURL *)defaultBaseDirectoryURL {
     NSFileManager *fm = [NSFileManager defaultManager];
     NSError *error = nil;
@@ -89,6 +106,10 @@ NSString *const ARTMigratedFromLegacyStorageKey = @"ARTMigratedFromLegacyStorage
     return [appSupport URLByAppendingPathComponent:ARTLocalDeviceStorageDirectoryName];
 }
 
+- (ARTAtomicFileStorage *)fileStorage {
+    return _store;
+}
+
 #pragma mark - Logging helpers
 
 - (id)valueToLogForValue:(id)value {
@@ -157,6 +178,77 @@ NSString *const ARTMigratedFromLegacyStorageKey = @"ARTMigratedFromLegacyStorage
     }
 }
 
+#pragma mark - Write-behind
+
+- (void)enableWriteBehindWithInterval:(NSTimeInterval)interval timeProvider:(id<ARTTimeProvider>)timeProvider {
+    [_lock lock];
+    if (interval > 0 && !_writeQueue) {
+        _timeProvider = timeProvider;
+        _writeQueue = dispatch_queue_create("io.ably.localDeviceStorage.write", DISPATCH_QUEUE_SERIAL);
+#if TARGET_OS_IOS
+        [[NSNotificationCenter defaultCenter] addObserver:self selector:@selector(flush) name:UIApplicationDidEnterBackgroundNotification object:nil];
+        [[NSNotificationCenter defaultCenter] addObserver:self selector:@selector(flush) name:UIApplicationWillTerminateNotification object:nil];
+#endif
+    }
+    _writeBehindInterval = interval;
+    [_lock unlock];
+    if (interval <= 0) {
+        [self flush];
+    }
+}
+
+- (void)flush {
+    [_lock lock];
+    [_scheduledWrite cancel];
+    _scheduledWrite = nil;
+    dispatch_queue_t const writeQueue = _writeQueue;
+    if (!writeQueue) {
+        [self writeCacheIfModified];
+    }
+    [_lock unlock];
+
+    if (writeQueue) {
+        // After any write already in progress
+        art_dispatch_sync(writeQueue, ^{
+            [self writeSnapshotIfModified];
+        });
+    }
+}
+
+- (void)scheduleWrite {
+    if (_scheduledWrite) {
+        return;
+    }
+    __weak ARTLocalDeviceStorage *weakSelf = self;
+    _scheduledWrite = [_timeProvider scheduleAfter:_writeBehindInterval queue:_writeQueue block:^{
+        [weakSelf writeSnapshotIfModified];
+    }];
+}
+
+// Must be called on `_writeQueue`. Copies the cache, so that the file is written without blocking readers and writers.
+- (void)writeSnapshotIfModified {
+    [_lock lock];
+    [_scheduledWrite cancel];
+    _scheduledWrite = nil;
+    NSDictionary<NSString *, id> *const snapshot = _isModified ? [_cache copy] : nil;
+    _isModified = NO;
+    [_lock unlock];
+
+    if (!snapshot) {
+        return;
+    }
+    NSError *error = nil;
+    if (![_store save:snapshot error:&error]) {
+        ARTLogError(_logger, @"ARTLocalDeviceStorage: persist failed for %@: %@", _store.fileURL.lastPathComponent, error.localizedDescription);
+        // Retried with the next mutation or flush.
+        [_lock lock];
+        _isModified = YES;
+        [_lock unlock];
+        return;
+    }
+    ARTLogDebug(_logger, @"ARTLocalDeviceStorage: flushed %lu keys: (%@) (to %@)", (unsigned long)snapshot.count, [snapshot.allKeys componentsJoinedByString:@", "], _store.fileURL.lastPathComponent);
+}
+
 #pragma mark - Internal write helpers
 
 - (void)mutateCacheForKey:(NSString *)key value:(nullable id)value {
@@ -177,6 +269,15 @@ NSString *const ARTMigratedFromLegacyStorageKey = @"ARTMigratedFromLegacyStorage
 }
 
 - (void)flushIfModified {
+    if (!_isModified) return;
+    if (_writeBehindInterval > 0) {
+        [self scheduleWrite];
+        return;
+    }
+    [self writeCacheIfModified];
+}
+
+- (void)writeCacheIfModified {
     if (!_isModified) return;
     NSError *error = nil;
     if (![_store save:_cache error:&error]) {
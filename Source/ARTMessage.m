@@ -53,6 +53,13 @@
     return message;
 }
 
+- (NSString *)deltaBaseId {
+    if (!self.extras || ![self.encoding containsString:@"vcdiff"]) {
+        return nil;
+    }
+    return [[[self.extras toJSON:nil] objectForKey:@"delta"] objectForKey:@"from"];
+}
+
 - (NSInteger)messageSize {
     // TO3l8*
     return [super messageSize] + [self.name lengthOfBytesUsingEncoding:NSUTF8StringEncoding];
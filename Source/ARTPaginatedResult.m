@@ -1,5 +1,6 @@
 #import "ARTPaginatedResult+Private.h"
 #import "ARTPaginatedResult+Subclass.h"
+#import "ARTPaginatedResultIterator+Private.h"
 
 #import "ARTHttp.h"
 #import "ARTAuth.h"
@@ -32,6 +33,7 @@
 @synthesize hasNext = _hasNext;
 @synthesize isLast = _isLast;
 @synthesize items = _items;
+@synthesize responseProcessor = _responseProcessor;
 
 - (instancetype)init {
     if (self = [super init]) {
@@ -144,42 +146,66 @@
     [self.class executePaginated:_rest withRequest:_relNext andResponseProcessor:_responseProcessor wrapperSDKAgents:_wrapperSDKAgents logger:_logger callback:callback];
 }
 
+- (ARTPaginatedResultIterator<id> *)iteratorWithPrefetchDepth:(NSUInteger)prefetchDepth {
+    [self initializedViaInitCheck];
+
+    return [[ARTPaginatedResultIterator alloc] initWithPage:self prefetchDepth:prefetchDepth];
+}
+
 + (void)executePaginated:(ARTRestInternal *)rest withRequest:(NSMutableURLRequest *)request andResponseProcessor:(ARTPaginatedResultResponseProcessor)responseProcessor wrapperSDKAgents:(nullable NSStringDictionary *)wrapperSDKAgents logger:(ARTInternalLog *)logger callback:(void (^)(ARTPaginatedResult<id> *_Nullable result, ARTErrorInfo *_Nullable error))callback {
+    [self executePaginated:rest withRequest:request andResponseProcessor:responseProcessor wrapperSDKAgents:wrapperSDKAgents decodeQueue:nil logger:logger callback:callback];
+}
+
++ (void)executePaginated:(ARTRestInternal *)rest withRequest:(NSMutableURLRequest *)request andResponseProcessor:(ARTPaginatedResultResponseProcessor)responseProcessor wrapperSDKAgents:(nullable NSStringDictionary *)wrapperSDKAgents decodeQueue:(nullable dispatch_queue_t)decodeQueue logger:(ARTInternalLog *)logger callback:(void (^)(ARTPaginatedResult<id> *_Nullable result, ARTErrorInfo *_Nullable error))callback {
     ARTLogDebug(logger, @"Paginated request: %@", request);
 
     [rest executeRequest:request withAuthOption:ARTAuthenticationOn wrapperSDKAgents:wrapperSDKAgents completion:^(NSHTTPURLResponse *response, NSData *data, NSError *error) {
         if (error) {
             callback(nil, [ARTErrorInfo createFromNSError:error]);
-        } else {
-            ARTLogDebug(logger, @"Paginated response: %@", response);
-            ARTLogDebug(logger, @"Paginated response data: %@", [[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding]);
+            return;
+        }
+
+        ARTLogDebug(logger, @"Paginated response: %@", response);
+        ARTLogDebug(logger, @"Paginated response data: %@", [[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding]);
 
+        if (decodeQueue) {
+            art_dispatch_async(decodeQueue, ^{
+                NSError *decodeError = nil;
+                NSArray *items = responseProcessor(response, data, &decodeError);
+                art_dispatch_async(rest.queue, ^{
+                    [self completePaginated:rest withRequest:request response:response items:items decodeError:decodeError andResponseProcessor:responseProcessor wrapperSDKAgents:wrapperSDKAgents logger:logger callback:callback];
+                });
+            });
+        } else {
             NSError *decodeError = nil;
             NSArray *items = responseProcessor(response, data, &decodeError);
+            [self completePaginated:rest withRequest:request response:response items:items decodeError:decodeError andResponseProcessor:responseProcessor wrapperSDKAgents:wrapperSDKAgents logger:logger callback:callback];
+        }
+    }];
+}
 
-            if (decodeError) {
-                callback(nil, [ARTErrorInfo createFromNSError:decodeError]);
-                return;
-            }
++ (void)completePaginated:(ARTRestInternal *)rest withRequest:(NSMutableURLRequest *)request response:(NSHTTPURLResponse *)response items:(nullable NSArray *)items decodeError:(nullable NSError *)decodeError andResponseProcessor:(ARTPaginatedResultResponseProcessor)responseProcessor wrapperSDKAgents:(nullable NSStringDictionary *)wrapperSDKAgents logger:(ARTInternalLog *)logger callback:(void (^)(ARTPaginatedResult<id> *_Nullable result, ARTErrorInfo *_Nullable error))callback {
+    if (decodeError) {
+        callback(nil, [ARTErrorInfo createFromNSError:decodeError]);
+        return;
+    }
 
-            NSDictionary *links = [response extractLinks];
+    NSDictionary *links = [response extractLinks];
 
-            NSMutableURLRequest *firstRel = [NSMutableURLRequest requestWithPath:links[@"first"] relativeTo:request];
-            NSMutableURLRequest *currentRel = [NSMutableURLRequest requestWithPath:links[@"current"] relativeTo:request];
-            NSMutableURLRequest *nextRel = [NSMutableURLRequest requestWithPath:links[@"next"] relativeTo:request];
+    NSMutableURLRequest *firstRel = [NSMutableURLRequest requestWithPath:links[@"first"] relativeTo:request];
+    NSMutableURLRequest *currentRel = [NSMutableURLRequest requestWithPath:links[@"current"] relativeTo:request];
+    NSMutableURLRequest *nextRel = [NSMutableURLRequest requestWithPath:links[@"next"] relativeTo:request];
 
-            ARTPaginatedResult *result = [[ARTPaginatedResult alloc] initWithItems:items
-                                                                              rest:rest
-                                                                          relFirst:firstRel
-                                                                        relCurrent:currentRel
-                                                                           relNext:nextRel
-                                                                 responseProcessor:responseProcessor
-                                                                  wrapperSDKAgents:wrapperSDKAgents
-                                                                            logger:logger];
+    ARTPaginatedResult *result = [[ARTPaginatedResult alloc] initWithItems:items
+                                                                      rest:rest
+                                                                  relFirst:firstRel
+                                                                relCurrent:currentRel
+                                                                   relNext:nextRel
+                                                         responseProcessor:responseProcessor
+                                                          wrapperSDKAgents:wrapperSDKAgents
+                                                                    logger:logger];
 
-            callback(result, nil);
-        }
-    }];
+    callback(result, nil);
 }
 
 @end
@@ -0,0 +1,137 @@
+#import "ARTPaginatedResultIterator+Private.h"
+#import "ARTPaginatedResult+Private.h"
+#import "ARTPaginatedResult+Subclass.h"
+#import "ARTRest+Private.h"
+#import "ARTInternalLog.h"
+#import "ARTGCD.h"
+#import "ARTQueuedDealloc.h"
+
+typedef void (^ARTPaginatedResultIteratorCallback)(ARTPaginatedResult *_Nullable page, ARTErrorInfo *_Nullable error);
+
+@implementation ARTPaginatedResultIterator {
+    // All of the below instance variables are only accessed on _queue
+    ARTRestInternal *_rest;
+    dispatch_queue_t _userQueue;
+    dispatch_queue_t _queue;
+    dispatch_queue_t _decodeQueue;
+    ARTPaginatedResultResponseProcessor _responseProcessor;
+    NSStringDictionary *_Nullable _wrapperSDKAgents;
+    ARTInternalLog *_logger;
+    ARTQueuedDealloc *_dealloc;
+
+    NSMutableArray<ARTPaginatedResult *> *_bufferedPages;
+    NSMutableArray<ARTPaginatedResultIteratorCallback> *_waitingCallbacks;
+    NSMutableURLRequest *_Nullable _nextRequest;
+    ARTErrorInfo *_Nullable _error;
+    BOOL _fetching;
+    BOOL _cancelled;
+}
+
+- (instancetype)initWithPage:(ARTPaginatedResult *)page prefetchDepth:(NSUInteger)prefetchDepth {
+    if (self = [super init]) {
+        _prefetchDepth = MAX(prefetchDepth, 1);
+        _rest = page.rest;
+        _userQueue = page.userQueue;
+        _queue = page.queue;
+        _decodeQueue = dispatch_queue_create("io.ably.paginatedResultIterator.decode", dispatch_queue_attr_make_with_qos_class(DISPATCH_QUEUE_SERIAL, QOS_CLASS_UTILITY, 0));
+        _responseProcessor = page.responseProcessor;
+        _wrapperSDKAgents = page.wrapperSDKAgents;
+        _logger = page.logger;
+        // Owned by user code, like ARTPaginatedResult; see the explanation there.
+        _dealloc = [[ARTQueuedDealloc alloc] init:_rest queue:_queue];
+
+        _bufferedPages = [NSMutableArray arrayWithObject:page];
+        _waitingCallbacks = [NSMutableArray array];
+        _nextRequest = page.relNext;
+
+        art_dispatch_async(_queue, ^{
+            [self prefetch];
+        });
+    }
+
+    return self;
+}
+
+- (NSUInteger)bufferedPageCount_nosync {
+    return _bufferedPages.count;
+}
+
+- (void)next:(void (^)(ARTPaginatedResult *_Nullable page, ARTErrorInfo *_Nullable error))callback {
+    ARTPaginatedResultIteratorCallback userCallback = ^(ARTPaginatedResult *page, ARTErrorInfo *error) {
+        art_dispatch_async(self->_userQueue, ^{
+            callback(page, error);
+        });
+    };
+
+    art_dispatch_async(_queue, ^{
+        [self->_waitingCallbacks addObject:userCallback];
+        [self deliver];
+        [self prefetch];
+    });
+}
+
+- (void)cancel {
+    art_dispatch_async(_queue, ^{
+        ARTLogDebug(self->_logger, @"PaginatedResultIterator:%p cancelled with %lu pages buffered", self, (unsigned long)self->_bufferedPages.count);
+        self->_cancelled = YES;
+        self->_nextRequest = nil;
+        [self->_bufferedPages removeAllObjects];
+        [self deliver];
+    });
+}
+
+// Answers the waiting callbacks with whatever is available.
+- (void)deliver {
+    while (_waitingCallbacks.count > 0) {
+        ARTPaginatedResultIteratorCallback callback = _waitingCallbacks.firstObject;
+        if (_bufferedPages.count > 0) {
+            ARTPaginatedResult *const page = _bufferedPages.firstObject;
+            [_bufferedPages removeObjectAtIndex:0];
+            callback(page, nil);
+        }
+        else if (_error) {
+            ARTErrorInfo *const error = _error;
+            // The error is reported once, in place of the page that couldn't be fetched; the iteration ends there.
+            _error = nil;
+            callback(nil, error);
+        }
+        else if ((_fetching || _nextRequest) && !_cancelled) {
+            return;
+        }
+        else {
+            callback(nil, nil);
+        }
+        [_waitingCallbacks removeObjectAtIndex:0];
+    }
+}
+
+// Fetches the next page unless enough pages are buffered already. Pages can only be fetched one at a time, since each one holds the link to the next.
+- (void)prefetch {
+    if (_fetching || _cancelled || !_nextRequest || _bufferedPages.count >= _prefetchDepth) {
+        return;
+    }
+
+    NSMutableURLRequest *const request = _nextRequest;
+    _nextRequest = nil;
+    _fetching = YES;
+    ARTLogDebug(_logger, @"PaginatedResultIterator:%p prefetching page (%lu buffered)", self, (unsigned long)_bufferedPages.count);
+
+    [ARTPaginatedResult executePaginated:_rest withRequest:request andResponseProcessor:_responseProcessor wrapperSDKAgents:_wrapperSDKAgents decodeQueue:_decodeQueue logger:_logger callback:^(ARTPaginatedResult *page, ARTErrorInfo *error) {
+        self->_fetching = NO;
+        if (self->_cancelled) {
+            [self deliver];
+            return;
+        }
+        if (error) {
+            self->_error = error;
+        }
+        else {
+            [self->_bufferedPages addObject:page];
+            self->_nextRequest = page.relNext;
+        }
+        [self deliver];
+        [self prefetch];
+    }];
+}
+
+@end
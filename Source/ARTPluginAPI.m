@@ -12,6 +12,7 @@
 #import "ARTPublishResultSerial+Private.h"
 #import "ARTConnection+Private.h"
 #import "ARTRealtimeChannelOptions.h"
+#import "ARTAuth+Private.h"
 
 static ARTErrorInfo *_ourPublicErrorInfo(id<APPublicErrorInfo> pluginPublicErrorInfo) {
     if (![pluginPublicErrorInfo isKindOfClass:[ARTErrorInfo class]]) {
@@ -211,6 +212,27 @@ static ARTLogLevel _convertPluginLogLevel(APLogLevel pluginLogLevel) {
     return result;
 }
 
+- (BOOL)nosync_isEncryptedChannel:(id<APRealtimeChannel>)channel {
+    ARTRealtimeChannelInternal *internalChannel = _internalRealtimeChannel(channel);
+    dispatch_assert_queue(internalChannel.queue);
+
+    return internalChannel.options_nosync.cipher != nil;
+}
+
+- (NSString *)nosync_appIdForClient:(id<APRealtimeClient>)client {
+    ARTRealtimeInternal *internalRealtimeClient = _internalRealtimeClient(client);
+    dispatch_assert_queue(internalRealtimeClient.queue);
+
+    return [internalRealtimeClient.auth appId];
+}
+
+- (NSString *)nosync_clientIdForClient:(id<APRealtimeClient>)client {
+    ARTRealtimeInternal *internalRealtimeClient = _internalRealtimeClient(client);
+    dispatch_assert_queue(internalRealtimeClient.queue);
+
+    return internalRealtimeClient.auth.clientId_nosync;
+}
+
 - (id<APPublicErrorInfo>)nosync_connectionStateErrorForClient:(id<APRealtimeClient>)client {
     ARTRealtimeInternal *internalRealtimeClient = _internalRealtimeClient(client);
     dispatch_assert_queue(internalRealtimeClient.queue);
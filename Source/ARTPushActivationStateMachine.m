@@ -2,6 +2,7 @@
 #import "ARTPush.h"
 #import "ARTPushActivationEvent.h"
 #import "ARTPushActivationState.h"
+#import "ARTPushPersistenceCodec.h"
 #import "ARTRest+Private.h"
 #import "ARTInternalLog.h"
 #import "ARTJsonEncoder.h"
@@ -21,6 +22,8 @@
 // `TARGET_OS_IOS`. The rest of the state machine is iOS-only.
 NSString *const ARTPushActivationCurrentStateKey = @"ARTPushActivationCurrentState";
 NSString *const ARTPushActivationPendingEventsKey = @"ARTPushActivationPendingEvents";
+NSString *const ARTPushActivationCompactCurrentStateKey = @"ARTPushActivationCurrentStateCompact";
+NSString *const ARTPushActivationCompactPendingEventsKey = @"ARTPushActivationPendingEventsCompact";
 
 #if TARGET_OS_IOS
 
@@ -59,10 +62,9 @@ NS_ASSUME_NONNULL_END
         ARTLocalDevice *localDevice = rest.device_nosync;
         _storage = localDevice.storage;
 
-        // Unarchiving
-        _current = [ARTPushActivationState art_unarchiveFromStorage:_storage
-                                                                key:ARTPushActivationCurrentStateKey
-                                                         withLogger:logger];
+        // Unarchiving; data persisted only as an archive, by older SDK versions, is also written in the compact format on the next `persist`
+        NSData *const stateData = [ARTPushPersistenceCodec dataForKey:ARTPushActivationCompactCurrentStateKey legacyKey:ARTPushActivationCurrentStateKey storage:_storage];
+        _current = stateData ? [ARTPushPersistenceCodec stateWithData:stateData machine:self logger:logger] : nil;
         if (!_current) {
             _current = [[ARTPushActivationStateNotActivated alloc] initWithMachine:self logger:logger];
         } else {
@@ -71,9 +73,8 @@ NS_ASSUME_NONNULL_END
             }
             _current.machine = self;
         }
-        _pendingEvents = [ARTPushActivationEvent art_unarchiveFromStorage:_storage
-                                                                      key:ARTPushActivationPendingEventsKey
-                                                               withLogger:logger];
+        NSData *const eventsData = [ARTPushPersistenceCodec dataForKey:ARTPushActivationCompactPendingEventsKey legacyKey:ARTPushActivationPendingEventsKey storage:_storage];
+        _pendingEvents = eventsData ? [ARTPushPersistenceCodec eventsWithData:eventsData logger:logger] : nil;
         if (!_pendingEvents) {
             _pendingEvents = [NSMutableArray array];
         }
@@ -164,16 +165,23 @@ art_dispatch_async(_queue, ^{
 }
 
 - (void)persist {
-    NSData *stateData = nil;
-    if ([_current isKindOfClass:[ARTPushActivationPersistentState class]]) {
-        stateData = [_current art_archiveWithLogger:_logger];
-    }
-    NSData *eventsData = [_pendingEvents art_archiveWithLogger:_logger];
+    const BOOL persistsState = [_current isKindOfClass:[ARTPushActivationPersistentState class]];
+    const BOOL writesArchives = [ARTPushPersistenceCodec writesLegacyArchivesToStorage:_storage];
+    NSData *const stateArchive = persistsState && writesArchives ? [_current art_archiveWithLogger:_logger] : nil;
+    NSData *const eventsArchive = writesArchives ? [_pendingEvents art_archiveWithLogger:_logger] : nil;
     [_storage performBatchUpdate:^(id<ARTDeviceStorage> writer) {
-        if (stateData != nil) {
-            [writer setObject:stateData forKey:ARTPushActivationCurrentStateKey];
+        if (persistsState) {
+            [ARTPushPersistenceCodec setCompactData:[ARTPushPersistenceCodec dataWithState:self->_current]
+                                            archive:stateArchive
+                                             forKey:ARTPushActivationCompactCurrentStateKey
+                                          legacyKey:ARTPushActivationCurrentStateKey
+                                            storage:writer];
         }
-        [writer setObject:eventsData forKey:ARTPushActivationPendingEventsKey];
+        [ARTPushPersistenceCodec setCompactData:[ARTPushPersistenceCodec dataWithEvents:self->_pendingEvents]
+                                        archive:eventsArchive
+                                         forKey:ARTPushActivationCompactPendingEventsKey
+                                      legacyKey:ARTPushActivationPendingEventsKey
+                                        storage:writer];
     }];
 }
 
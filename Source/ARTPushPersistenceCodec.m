@@ -0,0 +1,376 @@
+#import "ARTPushPersistenceCodec.h"
+#import "ARTPushActivationState.h"
+#import "ARTPushActivationEvent.h"
+#import "ARTDeviceIdentityTokenDetails.h"
+#import "ARTStatus.h"
+#import "ARTTypes+Private.h"
+#import "ARTInternalLog.h"
+#import "ARTDeviceStorage.h"
+
+const uint8_t ARTPushPersistenceCodecVersion = 1;
+
+NSString *const ARTPushPersistenceLegacyArchivesUntilKey = @"ARTPushPersistenceLegacyArchivesUntil";
+
+// Long enough to cover the downgrades that follow a bad update, without keeping the archives around indefinitely.
+static const NSTimeInterval ARTPushPersistenceLegacyArchivesWindow = 90 * 24 * 60 * 60;
+
+// Header: magic, version, kind.
+static const uint8_t ARTPushPersistenceCodecMagic[] = { 'A', 'R', 'T', 'P' };
+#define ART_PUSH_PERSISTENCE_HEADER_LENGTH (sizeof(ARTPushPersistenceCodecMagic) + 2)
+
+typedef NS_ENUM(uint8_t, ARTPushPersistenceKind) {
+    ARTPushPersistenceKindState = 1,
+    ARTPushPersistenceKindEvents = 2,
+    ARTPushPersistenceKindIdentityTokenDetails = 3,
+};
+
+// The codes persisted for each class. Never reuse a code: data with a code that a newer SDK version added is rejected, not misread.
+static NSArray<Class> *ARTPushPersistenceStateClasses(void) {
+    static NSArray<Class> *classes;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        classes = @[
+            [ARTPushActivationStateNotActivated class],                 // 1
+            [ARTPushActivationStateWaitingForPushDeviceDetails class],  // 2
+            [ARTPushActivationStateWaitingForNewPushDeviceDetails class], // 3
+            [ARTPushActivationStateAfterRegistrationSyncFailed class],  // 4
+        ];
+    });
+    return classes;
+}
+
+static NSArray<Class> *ARTPushPersistenceEventClasses(void) {
+    static NSArray<Class> *classes;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        classes = @[
+            [ARTPushActivationEventCalledActivate class],                   // 1
+            [ARTPushActivationEventCalledDeactivate class],                 // 2
+            [ARTPushActivationEventGotPushDeviceDetails class],             // 3
+            [ARTPushActivationEventGettingPushDeviceDetailsFailed class],   // 4
+            [ARTPushActivationEventGotDeviceRegistration class],            // 5
+            [ARTPushActivationEventGettingDeviceRegistrationFailed class],  // 6
+            [ARTPushActivationEventRegistrationSynced class],               // 7
+            [ARTPushActivationEventSyncRegistrationFailed class],           // 8
+            [ARTPushActivationEventDeregistered class],                     // 9
+            [ARTPushActivationEventDeregistrationFailed class],             // 10
+        ];
+    });
+    return classes;
+}
+
+// Codes start at 1; 0 means "unknown".
+static uint8_t ARTPushPersistenceCodeForClass(NSArray<Class> *classes, Class cls) {
+    const NSUInteger index = [classes indexOfObjectIdenticalTo:cls];
+    return index == NSNotFound ? 0 : (uint8_t)(index + 1);
+}
+
+#pragma mark - Writing
+
+static void ARTPushPersistenceAppendVarint(NSMutableData *output, uint64_t value) {
+    uint8_t buffer[10];
+    size_t length = 0;
+    do {
+        uint8_t byte = value & 0x7f;
+        value >>= 7;
+        if (value) {
+            byte |= 0x80;
+        }
+        buffer[length++] = byte;
+    } while (value);
+    [output appendBytes:buffer length:length];
+}
+
+static void ARTPushPersistenceAppendInteger(NSMutableData *output, int64_t value) {
+    // Zigzag, so that small negative values stay short
+    ARTPushPersistenceAppendVarint(output, ((uint64_t)value << 1) ^ (uint64_t)(value >> 63));
+}
+
+// Length + 1, then UTF-8; 0 for nil.
+static void ARTPushPersistenceAppendString(NSMutableData *output, NSString *string) {
+    if (!string) {
+        ARTPushPersistenceAppendVarint(output, 0);
+        return;
+    }
+    NSData *const utf8 = [string dataUsingEncoding:NSUTF8StringEncoding];
+    ARTPushPersistenceAppendVarint(output, utf8.length + 1);
+    [output appendData:utf8];
+}
+
+// Milliseconds since 1970 + 1; 0 for nil.
+static void ARTPushPersistenceAppendDate(NSMutableData *output, NSDate *date) {
+    ARTPushPersistenceAppendVarint(output, date ? dateToMilliseconds(date) + 1 : 0);
+}
+
+static NSMutableData *ARTPushPersistenceDataWithHeader(ARTPushPersistenceKind kind) {
+    NSMutableData *const output = [NSMutableData dataWithCapacity:64];
+    [output appendBytes:ARTPushPersistenceCodecMagic length:sizeof(ARTPushPersistenceCodecMagic)];
+    const uint8_t versionAndKind[] = { ARTPushPersistenceCodecVersion, kind };
+    [output appendBytes:versionAndKind length:sizeof(versionAndKind)];
+    return output;
+}
+
+static void ARTPushPersistenceAppendIdentityTokenDetails(NSMutableData *output, ARTDeviceIdentityTokenDetails *details) {
+    ARTPushPersistenceAppendString(output, details.token);
+    ARTPushPersistenceAppendDate(output, details.issued);
+    ARTPushPersistenceAppendDate(output, details.expires);
+    ARTPushPersistenceAppendString(output, details.capability);
+    ARTPushPersistenceAppendString(output, details.clientId);
+}
+
+#pragma mark - Reading
+
+typedef struct {
+    const uint8_t *bytes;
+    NSUInteger length;
+    NSUInteger offset;
+} ARTPushPersistenceReader;
+
+static BOOL ARTPushPersistenceReadByte(ARTPushPersistenceReader *reader, uint8_t *value) {
+    if (reader->offset >= reader->length) {
+        return NO;
+    }
+    *value = reader->bytes[reader->offset++];
+    return YES;
+}
+
+static BOOL ARTPushPersistenceReadVarint(ARTPushPersistenceReader *reader, uint64_t *value) {
+    uint64_t result = 0;
+    for (unsigned shift = 0; shift < 64; shift += 7) {
+        uint8_t byte;
+        if (!ARTPushPersistenceReadByte(reader, &byte)) {
+            return NO;
+        }
+        result |= (uint64_t)(byte & 0x7f) << shift;
+        if (!(byte & 0x80)) {
+            *value = result;
+            return YES;
+        }
+    }
+    return NO;
+}
+
+static BOOL ARTPushPersistenceReadInteger(ARTPushPersistenceReader *reader, int64_t *value) {
+    uint64_t zigzag;
+    if (!ARTPushPersistenceReadVarint(reader, &zigzag)) {
+        return NO;
+    }
+    *value = (int64_t)(zigzag >> 1) ^ -(int64_t)(zigzag & 1);
+    return YES;
+}
+
+static BOOL ARTPushPersistenceReadString(ARTPushPersistenceReader *reader, NSString *_Nullable *string) {
+    uint64_t lengthPlusOne;
+    if (!ARTPushPersistenceReadVarint(reader, &lengthPlusOne)) {
+        return NO;
+    }
+    if (lengthPlusOne == 0) {
+        *string = nil;
+        return YES;
+    }
+    const uint64_t length = lengthPlusOne - 1;
+    if (length > reader->length - reader->offset) {
+        return NO;
+    }
+    NSString *const result = [[NSString alloc] initWithBytes:reader->bytes + reader->offset length:(NSUInteger)length encoding:NSUTF8StringEncoding];
+    if (!result) {
+        return NO;
+    }
+    reader->offset += (NSUInteger)length;
+    *string = result;
+    return YES;
+}
+
+static BOOL ARTPushPersistenceReadDate(ARTPushPersistenceReader *reader, NSDate *_Nullable *date) {
+    uint64_t millisecondsPlusOne;
+    if (!ARTPushPersistenceReadVarint(reader, &millisecondsPlusOne)) {
+        return NO;
+    }
+    *date = millisecondsPlusOne == 0 ? nil : [NSDate dateWithTimeIntervalSince1970:(millisecondsPlusOne - 1) / 1000.0];
+    return YES;
+}
+
+static ARTDeviceIdentityTokenDetails *ARTPushPersistenceReadIdentityTokenDetails(ARTPushPersistenceReader *reader) {
+    NSString *token, *capability, *clientId;
+    NSDate *issued, *expires;
+    if (!ARTPushPersistenceReadString(reader, &token) ||
+        !ARTPushPersistenceReadDate(reader, &issued) ||
+        !ARTPushPersistenceReadDate(reader, &expires) ||
+        !ARTPushPersistenceReadString(reader, &capability) ||
+        !ARTPushPersistenceReadString(reader, &clientId)) {
+        return nil;
+    }
+    return [[ARTDeviceIdentityTokenDetails alloc] initWithToken:token issued:issued expires:expires capability:capability clientId:clientId];
+}
+
+// Returns NO if `data` isn't encoded data of `kind` that this version can read.
+static BOOL ARTPushPersistenceReaderInit(ARTPushPersistenceReader *reader, NSData *data, ARTPushPersistenceKind kind) {
+    if (![ARTPushPersistenceCodec isEncodedData:data]) {
+        return NO;
+    }
+    reader->bytes = data.bytes;
+    reader->length = data.length;
+    reader->offset = ART_PUSH_PERSISTENCE_HEADER_LENGTH;
+    return reader->bytes[sizeof(ARTPushPersistenceCodecMagic)] == ARTPushPersistenceCodecVersion && reader->bytes[sizeof(ARTPushPersistenceCodecMagic) + 1] == kind;
+}
+
+#pragma mark - ARTPushPersistenceCodec
+
+@implementation ARTPushPersistenceCodec
+
++ (BOOL)isEncodedData:(NSData *)data {
+    return data.length >= ART_PUSH_PERSISTENCE_HEADER_LENGTH && memcmp(data.bytes, ARTPushPersistenceCodecMagic, sizeof(ARTPushPersistenceCodecMagic)) == 0;
+}
+
++ (NSData *)dataWithState:(ARTPushActivationState *)state {
+    const uint8_t code = ARTPushPersistenceCodeForClass(ARTPushPersistenceStateClasses(), [state class]);
+    if (code == 0) {
+        return nil;
+    }
+    NSMutableData *const output = ARTPushPersistenceDataWithHeader(ARTPushPersistenceKindState);
+    [output appendBytes:&code length:1];
+    return output;
+}
+
++ (NSData *)dataWithEvents:(NSArray<ARTPushActivationEvent *> *)events {
+    NSMutableData *const output = ARTPushPersistenceDataWithHeader(ARTPushPersistenceKindEvents);
+    ARTPushPersistenceAppendVarint(output, events.count);
+    for (ARTPushActivationEvent *event in events) {
+        const uint8_t code = ARTPushPersistenceCodeForClass(ARTPushPersistenceEventClasses(), [event class]);
+        if (code == 0) {
+            return nil;
+        }
+        [output appendBytes:&code length:1];
+        if ([event isKindOfClass:[ARTPushActivationErrorEvent class]]) {
+            ARTErrorInfo *const error = ((ARTPushActivationErrorEvent *)event).error;
+            const uint8_t hasError = error != nil;
+            [output appendBytes:&hasError length:1];
+            if (error) {
+                ARTPushPersistenceAppendInteger(output, error.code);
+                ARTPushPersistenceAppendInteger(output, error.statusCode);
+                ARTPushPersistenceAppendString(output, error.message);
+                ARTPushPersistenceAppendString(output, error.requestId);
+            }
+        }
+        else if ([event isKindOfClass:[ARTPushActivationDeviceIdentityEvent class]]) {
+            ARTDeviceIdentityTokenDetails *const details = ((ARTPushActivationDeviceIdentityEvent *)event).identityTokenDetails;
+            const uint8_t hasDetails = details != nil;
+            [output appendBytes:&hasDetails length:1];
+            if (details) {
+                ARTPushPersistenceAppendIdentityTokenDetails(output, details);
+            }
+        }
+    }
+    return output;
+}
+
++ (NSData *)dataWithIdentityTokenDetails:(ARTDeviceIdentityTokenDetails *)identityTokenDetails {
+    NSMutableData *const output = ARTPushPersistenceDataWithHeader(ARTPushPersistenceKindIdentityTokenDetails);
+    ARTPushPersistenceAppendIdentityTokenDetails(output, identityTokenDetails);
+    return output;
+}
+
++ (ARTPushActivationState *)stateWithData:(NSData *)data machine:(ARTPushActivationStateMachine *)machine logger:(ARTInternalLog *)logger {
+    if (![self isEncodedData:data]) {
+        return [ARTPushActivationState art_unarchiveFromData:data withLogger:logger];
+    }
+    ARTPushPersistenceReader reader;
+    uint8_t code;
+    NSArray<Class> *const classes = ARTPushPersistenceStateClasses();
+    if (!ARTPushPersistenceReaderInit(&reader, data, ARTPushPersistenceKindState) || !ARTPushPersistenceReadByte(&reader, &code) || code == 0 || code > classes.count) {
+        ARTLogError(logger, @"%@: can't decode push activation state (%lu bytes)", self, (unsigned long)data.length);
+        return nil;
+    }
+    return [[classes[code - 1] alloc] initWithMachine:machine logger:logger];
+}
+
++ (NSMutableArray<ARTPushActivationEvent *> *)eventsWithData:(NSData *)data logger:(ARTInternalLog *)logger {
+    if (![self isEncodedData:data]) {
+        return [ARTPushActivationEvent art_unarchiveFromData:data withLogger:logger];
+    }
+    ARTPushPersistenceReader reader;
+    uint64_t count;
+    if (!ARTPushPersistenceReaderInit(&reader, data, ARTPushPersistenceKindEvents) || !ARTPushPersistenceReadVarint(&reader, &count) || count > data.length) {
+        ARTLogError(logger, @"%@: can't decode push activation events (%lu bytes)", self, (unsigned long)data.length);
+        return nil;
+    }
+
+    NSArray<Class> *const classes = ARTPushPersistenceEventClasses();
+    NSMutableArray<ARTPushActivationEvent *> *const events = [NSMutableArray arrayWithCapacity:(NSUInteger)count];
+    for (uint64_t i = 0; i < count; i++) {
+        uint8_t code;
+        if (!ARTPushPersistenceReadByte(&reader, &code) || code == 0 || code > classes.count) {
+            ARTLogError(logger, @"%@: can't decode push activation event %llu of %llu", self, (unsigned long long)i, (unsigned long long)count);
+            return nil;
+        }
+        Class const cls = classes[code - 1];
+        const BOOL isErrorEvent = [cls isSubclassOfClass:[ARTPushActivationErrorEvent class]];
+        const BOOL isDeviceIdentityEvent = [cls isSubclassOfClass:[ARTPushActivationDeviceIdentityEvent class]];
+        uint8_t hasValue = 0;
+        ARTPushActivationEvent *event = nil;
+        if ((isErrorEvent || isDeviceIdentityEvent) && !ARTPushPersistenceReadByte(&reader, &hasValue)) {
+            // Truncated
+        }
+        else if (isErrorEvent) {
+            ARTErrorInfo *error = nil;
+            int64_t errorCode, statusCode;
+            NSString *message, *requestId;
+            if (hasValue &&
+                ARTPushPersistenceReadInteger(&reader, &errorCode) &&
+                ARTPushPersistenceReadInteger(&reader, &statusCode) &&
+                ARTPushPersistenceReadString(&reader, &message) &&
+                ARTPushPersistenceReadString(&reader, &requestId)) {
+                error = [ARTErrorInfo createWithCode:(NSInteger)errorCode status:(NSInteger)statusCode message:message ?: @"" requestId:requestId];
+            }
+            event = (hasValue && !error) ? nil : [cls newWithError:error];
+        }
+        else if (isDeviceIdentityEvent) {
+            ARTDeviceIdentityTokenDetails *const details = hasValue ? ARTPushPersistenceReadIdentityTokenDetails(&reader) : nil;
+            event = (hasValue && !details) ? nil : [[cls alloc] initWithIdentityTokenDetails:details];
+        }
+        else {
+            event = [cls new];
+        }
+        if (!event) {
+            ARTLogError(logger, @"%@: can't decode push activation event %llu of %llu", self, (unsigned long long)i, (unsigned long long)count);
+            return nil;
+        }
+        [events addObject:event];
+    }
+    return events;
+}
+
++ (BOOL)writesLegacyArchivesToStorage:(id<ARTDeviceStorage>)storage {
+    NSDate *const until = [storage objectForKey:ARTPushPersistenceLegacyArchivesUntilKey];
+    if (![until isKindOfClass:[NSDate class]]) {
+        [storage setObject:[NSDate dateWithTimeIntervalSinceNow:ARTPushPersistenceLegacyArchivesWindow] forKey:ARTPushPersistenceLegacyArchivesUntilKey];
+        return YES;
+    }
+    return [until timeIntervalSinceNow] > 0;
+}
+
++ (void)setCompactData:(NSData *)compactData archive:(NSData *)archive forKey:(NSString *)key legacyKey:(NSString *)legacyKey storage:(id<ARTDeviceStorage>)storage {
+    [storage performBatchUpdate:^(id<ARTDeviceStorage> writer) {
+        [writer setObject:compactData forKey:key];
+        [writer setObject:compactData ? archive : nil forKey:legacyKey];
+    }];
+}
+
++ (NSData *)dataForKey:(NSString *)key legacyKey:(NSString *)legacyKey storage:(id<ARTDeviceStorage>)storage {
+    NSData *const compactData = [storage objectForKey:key];
+    return [compactData isKindOfClass:[NSData class]] ? compactData : [storage objectForKey:legacyKey];
+}
+
++ (ARTDeviceIdentityTokenDetails *)identityTokenDetailsWithData:(NSData *)data logger:(ARTInternalLog *)logger {
+    if (![self isEncodedData:data]) {
+        return [ARTDeviceIdentityTokenDetails art_unarchiveFromData:data withLogger:logger];
+    }
+    ARTPushPersistenceReader reader;
+    ARTDeviceIdentityTokenDetails *const details = ARTPushPersistenceReaderInit(&reader, data, ARTPushPersistenceKindIdentityTokenDetails) ? ARTPushPersistenceReadIdentityTokenDetails(&reader) : nil;
+    if (!details) {
+        ARTLogError(logger, @"%@: can't decode device identity token details (%lu bytes)", self, (unsigned long)data.length);
+    }
+    return details;
+}
+
+@end
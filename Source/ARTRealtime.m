@@ -33,6 +33,7 @@
 #import "ARTRealtimeTransport.h"
 #import "ARTFallback.h"
 #import "ARTFallbackHosts.h"
+#import "ARTHostStatsTracker.h"
 #import "ARTAuthDetails.h"
 #import "ARTGCD.h"
 #import "ARTEncoder.h"
@@ -179,6 +180,10 @@
     return [_internal stats:query wrapperSDKAgents:nil callback:callback error:errorPtr];
 }
 
+- (NSArray<ARTHostStats *> *)fallbackHostRanking {
+    return _internal.rest.fallbackHostRanking;
+}
+
 - (void)connect {
     [_internal connect];
 }
@@ -233,6 +238,7 @@ typedef NS_ENUM(NSUInteger, ARTNetworkState) {
     ARTNetworkState _networkState;
     id<ARTRealtimeTransport> _transport;
     ARTFallback *_fallbacks;
+    id<ARTContinuousClockInstant> _transportConnectStartedAt;
     __weak ARTEventListener *_connectionRetryFromSuspendedListener;
     __weak ARTEventListener *_connectionRetryFromDisconnectedListener;
     __weak ARTEventListener *_connectingTimeoutListener;
@@ -376,6 +382,11 @@ typedef NS_ENUM(NSUInteger, ARTNetworkState) {
     }
 }
 
+- (BOOL)authShouldRenewTokenProactively:(ARTAuthInternal *)auth {
+    // RTC8a: Only a connected client can apply a new token in-band; otherwise it gets one when it next connects, if needed.
+    return self.connection.state_nosync == ARTRealtimeConnected;
+}
+
 - (void)performPendingAuthorizationWithState:(ARTRealtimeConnectionState)state error:(nullable ARTErrorInfo *)error {
     void (^pendingAuthorization)(ARTRealtimeConnectionState, ARTErrorInfo *_Nullable) = [self.pendingAuthorizations art_dequeue];
     if (!pendingAuthorization) {
@@ -782,6 +793,10 @@ wrapperSDKAgents:(nullable NSStringDictionary *)wrapperSDKAgents
             break;
         }
         case ARTRealtimeConnected: {
+            if (_transportConnectStartedAt && self.transport.host) {
+                [self.rest.hostStatsTracker recordSuccessForHost:self.transport.host latency:[[_timeProvider continuousClockNow] timeIntervalSinceInstant:_transportConnectStartedAt]];
+                _transportConnectStartedAt = nil;
+            }
             _fallbacks = nil; // RTN17a
             _connectionLostAt = nil;
             self.options.recover = nil; // RTN16k
@@ -953,6 +968,8 @@ wrapperSDKAgents:(nullable NSStringDictionary *)wrapperSDKAgents
             ARTConnectionStateChangeParams *const params = [[ARTConnectionStateChangeParams alloc] initWithErrorInfo:message.error];
             params.resumed = resumed;  // RTN19a
             [self performTransitionToState:ARTRealtimeConnected withParams:params];
+            // A proactive renewal that fell due while the client wasn't connected can now be applied in-band (RTC8a)
+            [self.auth renewTokenIfRenewalWasDeferred];
 
             break;
         }
@@ -1122,15 +1139,19 @@ wrapperSDKAgents:(nullable NSStringDictionary *)wrapperSDKAgents
 
 - (void)transportReconnectWithRenewedToken {
     _renewingToken = true;
+    [self.auth invalidateSharedToken];
     [self resetTransportWithResumeKey:_transport.resumeKey];
     [_connectingTimeoutListener restartTimer];
     [self transportConnectForcingNewToken:true newConnection:true];
 }
 
 - (void)transportConnectForcingNewToken:(BOOL)forceNewToken newConnection:(BOOL)newConnection {
+    // The connect latency recorded for the host starts when the transport does, so that it doesn't include any time spent authorising
+    _transportConnectStartedAt = nil;
     ARTClientOptions *options = [self.options copy];
     if ([options isBasicAuth]) {
         // Basic
+        _transportConnectStartedAt = [_timeProvider continuousClockNow];
         [self.transport connectWithKey:options.key];
     }
     else {
@@ -1140,6 +1161,7 @@ wrapperSDKAgents:(nullable NSStringDictionary *)wrapperSDKAgents
         if (!forceNewToken && [self.auth tokenRemainsValid]) {
             // Reuse token
             ARTLogDebug(self.logger, @"R:%p reusing token for auth", self);
+            _transportConnectStartedAt = [_timeProvider continuousClockNow];
             [self.transport connectWithToken:self.auth.tokenDetails.token];
         }
         else {
@@ -1182,6 +1204,7 @@ wrapperSDKAgents:(nullable NSStringDictionary *)wrapperSDKAgents
                         [self resetTransportWithResumeKey:self->_transport.resumeKey];
                     }
                     if (newConnection) {
+                        self->_transportConnectStartedAt = [self->_timeProvider continuousClockNow];
                         [self.transport connectWithToken:tokenDetails.token];
                     }
                 }];
@@ -1714,9 +1737,13 @@ wrapperSDKAgents:(nullable NSStringDictionary *)wrapperSDKAgents
 
     if (![self isSuspendMode] && [self shouldRetryWithFallbackForError:transportError options:clientOptions]) {
         ARTLogDebug(self.logger, @"R:%p host is down; can retry with fallback host", self);
+        if (transport.host) {
+            [self.rest.hostStatsTracker recordFailureForHost:transport.host];
+        }
+        _transportConnectStartedAt = nil;
         if (!_fallbacks) {
             NSArray *hosts = [ARTFallbackHosts hostsFromOptions:clientOptions];
-            _fallbacks = [[ARTFallback alloc] initWithFallbackHosts:hosts shuffleArray:clientOptions.testOptions.shuffleArray];
+            _fallbacks = [[ARTFallback alloc] initWithFallbackHosts:hosts shuffleArray:clientOptions.testOptions.shuffleArray hostStatsTracker:self.rest.hostStatsTracker];
         }
         if (_fallbacks) {
             if (_fallbacks.isEmpty) {
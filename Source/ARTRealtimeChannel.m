@@ -5,6 +5,8 @@
 #import "ARTRealtime+Private.h"
 #import "ARTMessage.h"
 #import "ARTBaseMessage+Private.h"
+#import "ARTDeltaEncoder.h"
+#import "ARTDeltaBaseCache.h"
 #import "ARTAuth.h"
 #import "ARTRealtimePresence+Private.h"
 #import "ARTRealtimeAnnotations+Private.h"
@@ -303,6 +305,7 @@ NS_ASSUME_NONNULL_END
     dispatch_queue_t _userQueue;
     ARTErrorInfo *_errorReason;
     ARTChannelMode _modes;
+    ARTDeltaEncoder *_deltaEncoder; // nil unless options.publishesDeltas
 }
 
 - (instancetype)initWithRealtime:(ARTRealtimeInternal *)realtime andName:(NSString *)name withOptions:(ARTRealtimeChannelOptions *)options logger:(ARTInternalLog *)logger {
@@ -314,6 +317,7 @@ NS_ASSUME_NONNULL_END
         _restChannel = [_realtime.rest.channels _getChannel:self.name options:options addPrefix:true];
         _state = ARTRealtimeChannelInitialized;
         _modes = 0;
+        [self updateDeltaEncoderWithOptions:options];
         _attachSerial = nil;
         _realtimePresence = [[ARTRealtimePresenceInternal alloc] initWithChannel:self logger:self.logger];
         _realtimeAnnotations = [[ARTRealtimeAnnotationsInternal alloc] initWithChannel:self logger:self.logger];
@@ -459,15 +463,34 @@ art_dispatch_sync(_queue, ^{
     ARTProtocolMessage *msg = [[ARTProtocolMessage alloc] init];
     msg.action = ARTProtocolMessageMessage;
     msg.channel = self.name;
-    msg.messages = data;
+    msg.messages = self->_deltaEncoder ? [self->_deltaEncoder encodeMessages:data] : data;
 
+    ARTDeltaEncoder *const deltaEncoder = self->_deltaEncoder;
     [self publishProtocolMessage:msg callback:^void(ARTMessageSendStatus *status) {
+        if (status.status.errorInfo) {
+            // Subscribers won't have this message to apply the next delta to.
+            [deltaEncoder reset];
+        }
         if (callback)
             callback(status.publishResult, status.status.errorInfo);
     }];
 });
 }
 
+// Whether the channel asked Realtime for deltas with the `delta` channel param. Realtime then only sends deltas that the channel can decode once it has reattached (RTL18), which it can't promise of those that publishers send (see `ARTRealtimeChannelOptions.publishesDeltas`).
+- (BOOL)requestsServerDeltas_nosync {
+    return self.options_nosync.params[@"delta"] != nil;
+}
+
+- (void)updateDeltaEncoderWithOptions:(ARTRealtimeChannelOptions *)options {
+    if (!options.publishesDeltas || options.cipher) {
+        _deltaEncoder = nil;
+    }
+    else if (!_deltaEncoder || _deltaEncoder.keyframeInterval != options.deltaKeyframeInterval) {
+        _deltaEncoder = [[ARTDeltaEncoder alloc] initWithKeyframeInterval:options.deltaKeyframeInterval];
+    }
+}
+
 #ifdef ABLY_SUPPORTS_PLUGINS
 - (void)sendObjectWithObjectMessages:(NSArray<id<APObjectMessageProtocol>> *)objectMessages
                           completion:(void (^)(ARTPublishResult *_Nullable publishResult, ARTErrorInfo *_Nullable error))completion {
@@ -805,6 +828,12 @@ art_dispatch_sync(_queue, ^{
     if (message.resumed) {
         ARTLogDebug(self.logger, @"R:%p C:%p (%@) channel has resumed", _realtime, self, self.name);
     }
+    // Subscribers that attached since, or that missed messages while this client was disconnected, have no base for a delta against the last message published before now.
+    [_deltaEncoder reset];
+    if (!message.resumed) {
+        // The messages that follow don't necessarily continue from those received before (RTL19), and the first of them isn't a delta
+        [self.dataEncoder removeAllDeltaBases];
+    }
     // RTL15a
     self.attachSerial = message.channelSerial;
 
@@ -870,6 +899,7 @@ art_dispatch_sync(_queue, ^{
     }
 
     self.attachSerial = nil;
+    [self.dataEncoder removeAllDeltaBases];
 
     ARTErrorInfo *errorInfo = message.error ? message.error : [ARTErrorInfo createWithCode:0 message:@"channel has detached"];
     ARTChannelStateChangeParams *const params = [[ARTChannelStateChangeParams alloc] initWithState:ARTStateNotAttached errorInfo:errorInfo];
@@ -903,6 +933,7 @@ art_dispatch_sync(_queue, ^{
 - (void)onMessage:(ARTProtocolMessage *)pm {
     int i = 0;
 
+    ARTDataEncoder *dataEncoder = self.dataEncoder;
     ARTMessage *firstMessage = pm.messages.firstObject;
     if (firstMessage.extras) {
         NSError *extrasDecodeError;
@@ -912,7 +943,8 @@ art_dispatch_sync(_queue, ^{
         }
         else {
             NSString *const deltaFrom = [[extras objectForKey:@"delta"] objectForKey:@"from"];
-            if (deltaFrom && _lastPayloadMessageId && ![deltaFrom isEqualToString:_lastPayloadMessageId]) {
+            // A delta relative to an earlier message can still be decoded while that message's payload is cached.
+            if (deltaFrom && [self requestsServerDeltas_nosync] && _lastPayloadMessageId && ![deltaFrom isEqualToString:_lastPayloadMessageId] && ![dataEncoder.deltaBaseCache containsBaseForId:deltaFrom]) {
                 ARTErrorInfo *incompatibleIdError = [ARTErrorInfo createWithCode:ARTErrorUnableToDecodeMessage message:[NSString stringWithFormat:@"previous id '%@' is incompatible with message delta %@", _lastPayloadMessageId, firstMessage]];
                 ARTLogError(self.logger, @"R:%p C:%p (%@) %@", _realtime, self, self.name, incompatibleIdError.message);
                 for (int j = i + 1; j < pm.messages.count; j++) {
@@ -924,13 +956,31 @@ art_dispatch_sync(_queue, ^{
         }
     }
 
-    ARTDataEncoder *dataEncoder = self.dataEncoder;
+    NSArray<ARTDataEncoderOutput *> *decodedPayloads = nil;
+    NSMutableArray *payloads = [NSMutableArray arrayWithCapacity:pm.messages.count];
+    NSMutableArray *encodings = [NSMutableArray arrayWithCapacity:pm.messages.count];
+    NSMutableArray *identifiers = [NSMutableArray arrayWithCapacity:pm.messages.count];
+    NSMutableArray *deltaBaseIds = [NSMutableArray arrayWithCapacity:pm.messages.count];
+    if (dataEncoder) {
+        int j = 0;
+        for (ARTMessage *m in pm.messages) {
+            [payloads addObject:m.data ? m.data : [NSNull null]];
+            [encodings addObject:m.encoding ? m.encoding : [NSNull null]];
+            // The same id as the message is given below
+            [identifiers addObject:m.id ? m.id : [NSString stringWithFormat:@"%@:%d", pm.id, j]];
+            NSString *const deltaBaseId = [m deltaBaseId];
+            [deltaBaseIds addObject:deltaBaseId ? deltaBaseId : [NSNull null]];
+            ++j;
+        }
+        decodedPayloads = [dataEncoder decodeBatch:payloads encodings:encodings identifiers:identifiers deltaBaseIds:deltaBaseIds];
+    }
+
     for (ARTMessage *m in pm.messages) {
         ARTMessage *msg = m;
 
         if (msg.data && dataEncoder) {
             NSError *decodeError = nil;
-            msg = [msg decodeWithEncoder:dataEncoder error:&decodeError];
+            msg = [msg decodeWithEncoderOutput:decodedPayloads[i] error:&decodeError];
             if (decodeError) {
                 ARTErrorInfo *errorInfo = [ARTErrorInfo wrap:[ARTErrorInfo createWithCode:ARTErrorUnableToDecodeMessage message:decodeError.localizedFailureReason] prepend:@"Failed to decode data: "];
                 ARTLogError(self.logger, @"R:%p C:%p (%@) %@", _realtime, self, self.name, errorInfo.message);
@@ -939,8 +989,19 @@ art_dispatch_sync(_queue, ^{
                 [self emit:stateChange.event with:stateChange];
 
                 if (decodeError.code == ARTErrorUnableToDecodeMessage) {
-                    [self startDecodeFailureRecoveryWithErrorInfo:errorInfo];
-                    return;
+                    if ([self requestsServerDeltas_nosync]) {
+                        [self startDecodeFailureRecoveryWithErrorInfo:errorInfo];
+                        return;
+                    }
+                    // A delta from a publisher that publishes deltas (see `ARTRealtimeChannelOptions.publishesDeltas`) relative to a message that this client didn't receive. Reattaching wouldn't replay that message, so skip the delta; the publisher's next message in full can be decoded.
+                    ARTLogVerbose(self.logger, @"R:%p C:%p (%@) message skipped %@", _realtime, self, self.name, m);
+                    ++i;
+                    if (i < pm.messages.count && i >= decodedPayloads.count) {
+                        // Batch decoding stopped at this message; decode the rest
+                        NSRange const rest = NSMakeRange(i, pm.messages.count - i);
+                        decodedPayloads = [[decodedPayloads subarrayWithRange:NSMakeRange(0, i)] arrayByAddingObjectsFromArray:[dataEncoder decodeBatch:[payloads subarrayWithRange:rest] encodings:[encodings subarrayWithRange:rest] identifiers:[identifiers subarrayWithRange:rest] deltaBaseIds:[deltaBaseIds subarrayWithRange:rest]]];
+                    }
+                    continue;
                 }
             }
         }
@@ -1269,6 +1330,8 @@ art_dispatch_sync(_queue, ^{
 
     ARTLogWarn(self.logger, @"R:%p C:%p (%@) starting delta decode failure recovery process", _realtime, self, self.name);
     _decodeFailureRecoveryInProgress = true;
+    // A base that failed to decode a delta can't be trusted to decode another (RTL18)
+    [self.dataEncoder removeAllDeltaBases];
     ARTAttachRequestParams *const params = [[ARTAttachRequestParams alloc] initWithReason:error];
     [self internalAttach:^(ARTErrorInfo *e) {
         self->_decodeFailureRecoveryInProgress = false;
@@ -1325,6 +1388,7 @@ art_dispatch_sync(_queue, ^{
 - (void)setOptions_nosync:(ARTRealtimeChannelOptions *_Nullable)options callback:(nullable ARTCallback)callback {
     [self setOptions_nosync:options];
     [self.restChannel setOptions_nosync:options];
+    [self updateDeltaEncoderWithOptions:options];
 
     if (!options.modes && !options.params) {
         if (callback)
@@ -5,11 +5,14 @@
     NSStringDictionary *_params;
     ARTChannelMode _modes;
     BOOL _attachOnSubscribe;
+    BOOL _publishesDeltas;
+    NSUInteger _deltaKeyframeInterval;
 }
 
 - (instancetype)init {
     if (self = [super init]) {
         _attachOnSubscribe = true;
+        _deltaKeyframeInterval = 10;
     }
     return self;
 }
@@ -17,6 +20,7 @@
 - (instancetype)initWithCipher:(id<ARTCipherParamsCompatible>)cipherParams {
     if (self = [super initWithCipher:cipherParams]) {
         _attachOnSubscribe = true;
+        _deltaKeyframeInterval = 10;
     }
     return self;
 }
@@ -27,6 +31,8 @@
     copied->_params = _params;
     copied->_modes = _modes;
     copied->_attachOnSubscribe = _attachOnSubscribe;
+    copied->_publishesDeltas = _publishesDeltas;
+    copied->_deltaKeyframeInterval = _deltaKeyframeInterval;
 
     return copied;
 }
@@ -70,4 +76,30 @@
     _attachOnSubscribe = value;
 }
 
+- (BOOL)publishesDeltas {
+    return _publishesDeltas;
+}
+
+- (void)setPublishesDeltas:(BOOL)publishesDeltas {
+    if (self.isFrozen) {
+        @throw [NSException exceptionWithName:NSObjectInaccessibleException
+                                       reason:[NSString stringWithFormat:@"%@: You can't change options after you've passed it to receiver.", self.class]
+                                     userInfo:nil];
+    }
+    _publishesDeltas = publishesDeltas;
+}
+
+- (NSUInteger)deltaKeyframeInterval {
+    return _deltaKeyframeInterval;
+}
+
+- (void)setDeltaKeyframeInterval:(NSUInteger)deltaKeyframeInterval {
+    if (self.isFrozen) {
+        @throw [NSException exceptionWithName:NSObjectInaccessibleException
+                                       reason:[NSString stringWithFormat:@"%@: You can't change options after you've passed it to receiver.", self.class]
+                                     userInfo:nil];
+    }
+    _deltaKeyframeInterval = deltaKeyframeInterval;
+}
+
 @end
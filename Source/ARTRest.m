@@ -17,8 +17,12 @@
 #import "ARTClientOptions+Private.h"
 #import "ARTDefault.h"
 #import "ARTStats.h"
+#import "ARTBatchPresenceResult.h"
+#import "ARTBaseMessage+Private.h"
+#import "ARTDataEncoder.h"
 #import "ARTFallback+Private.h"
 #import "ARTFallbackHosts.h"
+#import "ARTHostStatsTracker.h"
 #import "ARTNSDictionary+ARTDictionaryUtil.h"
 #import "ARTNSArray+ARTFunctional.h"
 #import "ARTRestChannel.h"
@@ -126,6 +130,19 @@
     return [_internal stats:query wrapperSDKAgents:nil callback:callback error:errorPtr];
 }
 
+- (BOOL)batchPresence:(NSArray<NSString *> *)channels callback:(ARTBatchPresenceCallback)callback error:(NSError *_Nullable *_Nullable)errorPtr {
+    return [_internal batchPresence:channels wrapperSDKAgents:nil callback:callback error:errorPtr];
+}
+
+- (void)prewarmConnections:(ARTCallback)callback {
+    [_internal prewarmConnectionsWithWrapperSDKAgents:nil
+                                           completion:callback];
+}
+
+- (NSArray<ARTHostStats *> *)fallbackHostRanking {
+    return _internal.fallbackHostRanking;
+}
+
 - (ARTRestChannels *)channels {
     return [[ARTRestChannels alloc] initWithInternal:_internal.channels queuedDealloc:_dealloc];
 }
@@ -160,6 +177,36 @@ NS_ASSUME_NONNULL_BEGIN
 
 @end
 
+/**
+ The state of a request sent with `ARTClientOptions.httpHedgingDelay` enabled: it may be in flight to several hosts at once, and finishes with the first response that doesn't call for a fallback. Only accessed on the `ARTRestInternal` queue.
+ */
+@interface ARTHedgedRequest : NSObject <ARTCancellable>
+
+@property (nonatomic) NSURLRequest *request;
+@property (nonatomic, readonly) ARTFallback *fallbacks;
+@property (nullable, nonatomic, readonly) NSString *requestId;
+@property (nullable, nonatomic, readonly) NSDictionary<NSString *, NSString *> *wrapperSDKAgents;
+@property (nullable, nonatomic, readonly) ARTURLRequestCallback callback;
+@property (nonatomic, readonly) NSMutableArray<NSObject<ARTCancellable> *> *tasks;
+@property (nullable, nonatomic) id<ARTSchedulerHandle> hedgeTimer;
+@property (nonatomic) NSUInteger attemptCount;
+@property (nonatomic) NSUInteger outstandingCount;
+@property (nonatomic) NSUInteger tokenRenewalCount;
+@property (nonatomic) BOOL cancelled;
+@property (nonatomic) BOOL finished;
+@property (nullable, nonatomic) NSHTTPURLResponse *lastResponse;
+@property (nullable, nonatomic) NSData *lastData;
+@property (nullable, nonatomic) NSError *lastError;
+
+- (instancetype)initWithRequest:(NSURLRequest *)request
+                      fallbacks:(ARTFallback *)fallbacks
+                      requestId:(nullable NSString *)requestId
+               wrapperSDKAgents:(nullable NSDictionary<NSString *, NSString *> *)wrapperSDKAgents
+                          queue:(dispatch_queue_t)queue
+                       callback:(nullable ARTURLRequestCallback)callback;
+
+@end
+
 NS_ASSUME_NONNULL_END
 
 @implementation ARTRestInternal {
@@ -183,6 +230,7 @@ NS_ASSUME_NONNULL_END
         _options = [options copy];
         _logger = logger;
         _timeProvider = options.testOptions.timeProvider;
+        _hostStatsTracker = [[ARTHostStatsTracker alloc] initWithFailurePenalty:options.httpRequestTimeout];
         _queue = options.internalDispatchQueue;
         _userQueue = options.dispatchQueue;
 #if TARGET_OS_IOS
@@ -190,11 +238,15 @@ NS_ASSUME_NONNULL_END
             _storage = [[ARTThrowingLocalDeviceStorage alloc] init];
         }
         else {
-            _storage = [ARTLocalDeviceStorage newWithLogger:_logger
-                                                  logValues:_options.testOptions.logLocalDeviceStorageValues];
+            ARTLocalDeviceStorage *const storage = [ARTLocalDeviceStorage newWithLogger:_logger
+                                                                              logValues:_options.testOptions.logLocalDeviceStorageValues];
+            if (_options.localDeviceStorageWriteBehindInterval > 0) {
+                [storage enableWriteBehindWithInterval:_options.localDeviceStorageWriteBehindInterval timeProvider:_timeProvider];
+            }
+            _storage = storage;
         }
 #endif
-        _http = [[ARTHttp alloc] initWithQueue:_queue logger:_logger];
+        _http = [[ARTHttp alloc] initWithQueue:_queue options:_options logger:_logger];
         ARTLogVerbose(_logger, @"RS:%p %p alloc HTTP", self, _http);
         _httpExecutor = options.testOptions.httpExecutor ?: _http;
 
@@ -324,7 +376,184 @@ NS_ASSUME_NONNULL_END
 - (NSObject<ARTCancellable> *)executeRequest:(NSURLRequest *)request
                             wrapperSDKAgents:(nullable NSDictionary<NSString *, NSString *> *)wrapperSDKAgents
                                   completion:(ARTURLRequestCallback)callback {
-    return [self executeRequest:request fallbacks:nil retries:0 originalRequestId:nil wrapperSDKAgents:wrapperSDKAgents completion:callback];
+    if ([self shouldHedgeRequest:request]) {
+        return [self executeHedgedRequest:request wrapperSDKAgents:wrapperSDKAgents completion:callback];
+    }
+    return [self executeRequest:request fallbacks:nil retries:0 originalRequestId:nil wrapperSDKAgents:wrapperSDKAgents renewsToken:YES completion:callback];
+}
+
+- (BOOL)shouldHedgeRequest:(NSURLRequest *)request {
+    if (_options.httpHedgingDelay <= 0 || ![request isKindOfClass:[NSMutableURLRequest class]]) {
+        return NO;
+    }
+    if ([request.URL.host isEqualToString:self.options.authUrl.host]) {
+        return NO;
+    }
+    // Sending a request more than once must be harmless: reads are, and so are writes carrying a request ID, by which Ably recognises the duplicates.
+    const BOOL idempotent = [request.HTTPMethod isEqualToString:@"GET"] || [request.HTTPMethod isEqualToString:@"HEAD"] || _options.addRequestIds;
+    return idempotent && [ARTFallbackHosts hostsFromOptions:_options].count > 0;
+}
+
+- (NSObject<ARTCancellable> *)executeHedgedRequest:(NSURLRequest *)request
+                                  wrapperSDKAgents:(nullable NSDictionary<NSString *, NSString *> *)wrapperSDKAgents
+                                        completion:(ARTURLRequestCallback)callback {
+    NSString *requestId = nil;
+    if (_options.addRequestIds) {
+        NSString *randomId = [NSUUID new].UUIDString;
+        requestId = [[randomId dataUsingEncoding:NSUTF8StringEncoding] base64EncodedStringWithOptions:0];
+    }
+    NSArray *hosts = [ARTFallbackHosts hostsFromOptions:_options];
+    ARTFallback *fallbacks = [[ARTFallback alloc] initWithFallbackHosts:hosts shuffleArray:_options.testOptions.shuffleArray hostStatsTracker:_hostStatsTracker];
+    ARTHedgedRequest *hedgedRequest = [[ARTHedgedRequest alloc] initWithRequest:request
+                                                                      fallbacks:fallbacks
+                                                                      requestId:requestId
+                                                               wrapperSDKAgents:wrapperSDKAgents
+                                                                          queue:_queue
+                                                                       callback:callback];
+    [self startHedgedAttempt:hedgedRequest host:nil];
+    return hedgedRequest;
+}
+
+/**
+ Sends `hedgedRequest` to `host`, or to the host it was built for if `host` is `nil`, and arms the timer that sends it to the next fallback host if no response arrives within `httpHedgingDelay`.
+ */
+- (void)startHedgedAttempt:(ARTHedgedRequest *)hedgedRequest host:(nullable NSString *)host {
+    NSMutableURLRequest *attemptRequest = [hedgedRequest.request mutableCopy];
+    if (host) {
+        [attemptRequest setValue:host forHTTPHeaderField:@"Host"];
+        attemptRequest.URL = [NSURL copyFromURL:attemptRequest.URL withHost:host];
+    }
+    hedgedRequest.attemptCount++;
+    hedgedRequest.outstandingCount++;
+    const NSUInteger tokenRenewalCount = hedgedRequest.tokenRenewalCount;
+
+    ARTLogDebug(self.logger, @"RS:%p sending hedged request attempt %lu to %@", self, (unsigned long)hedgedRequest.attemptCount, attemptRequest.URL.host);
+    // Passing the fallbacks makes every attempt carry the same request ID; the retry count suppresses the sequential fallback of each attempt, since fallbacks are driven from here instead. Token renewal is driven from here too, so that the attempts it starts belong to the hedged request.
+    NSObject<ARTCancellable> *task = [self executeRequest:attemptRequest
+                                                fallbacks:hedgedRequest.fallbacks
+                                                  retries:_options.httpMaxRetryCount
+                                        originalRequestId:hedgedRequest.requestId
+                                         wrapperSDKAgents:hedgedRequest.wrapperSDKAgents
+                                              renewsToken:NO
+                                               completion:^(NSHTTPURLResponse *response, NSData *data, NSError *error) {
+        if (tokenRenewalCount != hedgedRequest.tokenRenewalCount) {
+            // Sent with a token that has since been renewed; the attempt sent with the new one supersedes it
+            return;
+        }
+        [self hedgedRequest:hedgedRequest attemptToHost:host didCompleteWithResponse:response data:data error:error];
+    }];
+    if (task) {
+        [hedgedRequest.tasks addObject:task];
+    }
+
+    [hedgedRequest.hedgeTimer cancel];
+    if (!hedgedRequest.finished) {
+        hedgedRequest.hedgeTimer = [self.timeProvider scheduleAfter:_options.httpHedgingDelay queue:_queue block:^{
+            ARTLogDebug(self.logger, @"RS:%p no response within %.3fs; hedging request", self, self->_options.httpHedgingDelay);
+            [self startNextHedgedAttempt:hedgedRequest];
+        }];
+    }
+}
+
+- (BOOL)startNextHedgedAttempt:(ARTHedgedRequest *)hedgedRequest {
+    if (hedgedRequest.finished || hedgedRequest.cancelled || hedgedRequest.attemptCount > _options.httpMaxRetryCount) {
+        return NO;
+    }
+    NSString *host = [hedgedRequest.fallbacks popFallbackHost];
+    if (host == nil) {
+        return NO;
+    }
+    [self startHedgedAttempt:hedgedRequest host:host];
+    return YES;
+}
+
+- (void)hedgedRequest:(ARTHedgedRequest *)hedgedRequest
+        attemptToHost:(nullable NSString *)host
+didCompleteWithResponse:(NSHTTPURLResponse *)response
+                 data:(NSData *)data
+                error:(NSError *)error {
+    hedgedRequest.outstandingCount--;
+    if (hedgedRequest.finished) {
+        return;
+    }
+
+    if (response.statusCode >= 400 && [error isKindOfClass:[ARTErrorInfo class]]) {
+        ARTErrorInfo *errorInfo = (ARTErrorInfo *)error;
+        // Make a single attempt to reissue the token and resend the request
+        if ([self shouldRenewToken:&errorInfo] && _tokenErrorRetries < 1 && !hedgedRequest.cancelled) {
+            [self renewTokenForHedgedRequest:hedgedRequest];
+            return;
+        }
+        error = errorInfo;
+    }
+
+    hedgedRequest.lastResponse = response;
+    hedgedRequest.lastData = data;
+    hedgedRequest.lastError = error;
+
+    if ([self shouldRetryWithFallback:hedgedRequest.request response:response error:error]) {
+        // Don't wait for the timer; a failed host is as good a reason to try the next one as a slow one.
+        if ([self startNextHedgedAttempt:hedgedRequest] || hedgedRequest.outstandingCount > 0) {
+            return;
+        }
+    }
+    else {
+        if (host && error == nil) {
+            ARTLogDebug(self.logger, @"RS:%p hedged request answered first by fallback host %@", self, host);
+            self.currentFallbackHost = host;
+            self.prioritizedHost = host;
+        }
+    }
+
+    [self finishHedgedRequest:hedgedRequest];
+}
+
+/**
+ Requests a new token and resends `hedgedRequest` with it, once one of its attempts has been rejected for its token. The attempts still in flight with the rejected token are cancelled, and their responses ignored.
+ */
+- (void)renewTokenForHedgedRequest:(ARTHedgedRequest *)hedgedRequest {
+    ARTLogDebug(self.logger, @"RS:%p renewing token and retrying hedged request %@", self, hedgedRequest.request);
+    _tokenErrorRetries = _tokenErrorRetries + 1;
+    hedgedRequest.tokenRenewalCount++;
+    hedgedRequest.outstandingCount = 0;
+    [hedgedRequest.hedgeTimer cancel];
+    for (NSObject<ARTCancellable> *task in hedgedRequest.tasks) {
+        [task cancel];
+    }
+    [hedgedRequest.tasks removeAllObjects];
+
+    const NSUInteger tokenRenewalCount = hedgedRequest.tokenRenewalCount;
+    NSObject<ARTCancellable> *task = [self.auth _authorize:nil options:self.options callback:^(ARTTokenDetails *tokenDetails, NSError *error) {
+        if (tokenRenewalCount != hedgedRequest.tokenRenewalCount || hedgedRequest.finished) {
+            return;
+        }
+        if (error || hedgedRequest.cancelled) {
+            ARTLogDebug(self.logger, @"RS:%p ARTRestInternal reissuing token failed %@", self, error);
+            hedgedRequest.lastResponse = nil;
+            hedgedRequest.lastData = nil;
+            hedgedRequest.lastError = error ?: [ARTErrorInfo createWithCode:kCFURLErrorCancelled message:@"Request has been canceled"];
+            [self finishHedgedRequest:hedgedRequest];
+            return;
+        }
+        NSMutableURLRequest *request = [hedgedRequest.request mutableCopy];
+        [request setValue:[self prepareTokenAuthorisationHeader:tokenDetails.token] forHTTPHeaderField:@"Authorization"];
+        hedgedRequest.request = request;
+        [self startHedgedAttempt:hedgedRequest host:nil];
+    }];
+    if (task) {
+        [hedgedRequest.tasks addObject:task];
+    }
+}
+
+- (void)finishHedgedRequest:(ARTHedgedRequest *)hedgedRequest {
+    hedgedRequest.finished = YES;
+    [hedgedRequest.hedgeTimer cancel];
+    for (NSObject<ARTCancellable> *task in hedgedRequest.tasks) {
+        [task cancel];
+    }
+    if (hedgedRequest.callback) {
+        hedgedRequest.callback(hedgedRequest.lastResponse, hedgedRequest.lastData, hedgedRequest.lastError);
+    }
 }
 
 - (NSString *)agentIdentifierWithWrapperSDKAgents:(nullable NSDictionary<NSString *, NSString *> *)wrapperSDKAgents {
@@ -343,12 +572,14 @@ NS_ASSUME_NONNULL_END
 
 /**
  originalRequestId is used only for fallback requests. It should never be used to execute request by yourself, it's passed from within below method.
+ renewsToken is NO only for the attempts of a hedged request, which renews the token itself so that its cancellation covers the resent request.
  */
 - (NSObject<ARTCancellable> *)executeRequest:(NSURLRequest *)request
                                    fallbacks:(ARTFallback *)fallbacks
                                      retries:(NSUInteger)retries
                            originalRequestId:(nullable NSString *)originalRequestId
                             wrapperSDKAgents:(nullable NSDictionary<NSString *, NSString *> *)wrapperSDKAgents
+                                 renewsToken:(BOOL)renewsToken
                                   completion:(ARTURLRequestCallback)callback {
     NSString *requestId = nil;
     __block ARTFallback *blockFallbacks = fallbacks;
@@ -391,8 +622,11 @@ NS_ASSUME_NONNULL_END
 
 
     ARTLogDebug(self.logger, @"RS:%p executing request %@", self, request);
+    id<ARTContinuousClockInstant> const requestStartedAt = [self.timeProvider continuousClockNow];
     __block NSObject<ARTCancellable> *task;
     task = [self.httpExecutor executeRequest:request completion:^(NSHTTPURLResponse *response, NSData *data, NSError *error) {
+        [self recordHostStatsForRequest:request response:response error:error startedAt:requestStartedAt];
+
         // Error messages in plaintext and HTML format (only if the URL request is different than `options.authUrl` and we don't have an error already)
         if (error == nil && data != nil && data.length != 0 && ![request.URL.host isEqualToString:[self.options.authUrl host]]) {
             NSString *contentType = [response.allHeaderFields objectForKey:@"Content-Type"];
@@ -422,7 +656,7 @@ NS_ASSUME_NONNULL_END
                 ARTErrorInfo *dataError = [self->_encoders[response.MIMEType] decodeErrorInfo:data
                                                                                    statusCode:response.statusCode
                                                                                         error:&decodeError];
-                if ([self shouldRenewToken:&dataError] && [request isKindOfClass:[NSMutableURLRequest class]]) {
+                if (renewsToken && [self shouldRenewToken:&dataError] && [request isKindOfClass:[NSMutableURLRequest class]]) {
                     ARTLogDebug(self.logger, @"RS:%p retry request %@", self, request);
                     // Make a single attempt to reissue the token and resend the request
                     if (self->_tokenErrorRetries < 1) {
@@ -456,7 +690,7 @@ NS_ASSUME_NONNULL_END
         if (retries < self->_options.httpMaxRetryCount && [self shouldRetryWithFallback:request response:response error:error]) {
             if (!blockFallbacks) {
                 NSArray *hosts = [ARTFallbackHosts hostsFromOptions:self->_options];
-                blockFallbacks = [[ARTFallback alloc] initWithFallbackHosts:hosts shuffleArray:self->_options.testOptions.shuffleArray];
+                blockFallbacks = [[ARTFallback alloc] initWithFallbackHosts:hosts shuffleArray:self->_options.testOptions.shuffleArray hostStatsTracker:self->_hostStatsTracker];
             }
             if (blockFallbacks) {
                 NSString *host = [blockFallbacks popFallbackHost];
@@ -472,6 +706,7 @@ NS_ASSUME_NONNULL_END
                                         retries:retries + 1
                               originalRequestId:originalRequestId
                                wrapperSDKAgents:wrapperSDKAgents
+                                    renewsToken:renewsToken
                                      completion:callback];
                     return;
                 }
@@ -493,9 +728,27 @@ NS_ASSUME_NONNULL_END
     return task;
 }
 
+- (void)recordHostStatsForRequest:(NSURLRequest *)request
+                         response:(nullable NSHTTPURLResponse *)response
+                            error:(nullable NSError *)error
+                        startedAt:(id<ARTContinuousClockInstant>)startedAt {
+    NSString *const host = request.URL.host;
+    if (host == nil || [host isEqualToString:self.options.authUrl.host]) {
+        return;
+    }
+    if ([self shouldRetryWithFallback:request response:response error:error]) {
+        [_hostStatsTracker recordFailureForHost:host];
+    }
+    else if (error == nil) {
+        // Any response, even an error status, shows how quickly the host answers
+        [_hostStatsTracker recordSuccessForHost:host latency:[[self.timeProvider continuousClockNow] timeIntervalSinceInstant:startedAt]];
+    }
+}
+
 - (BOOL)shouldRenewToken:(ARTErrorInfo **)errorPtr {
     if (errorPtr && *errorPtr && [[[ARTDefaultErrorChecker alloc] init] isTokenError: *errorPtr]) {
         if ([self.auth tokenIsRenewable]) {
+            [self.auth invalidateSharedToken];
             return YES;
         }
         *errorPtr = [ARTErrorInfo createWithCode:ARTStateRequestTokenFailed message:ARTAblyMessageNoMeansToRenewToken];
@@ -555,6 +808,10 @@ NS_ASSUME_NONNULL_END
     });
 }
 
+- (NSArray<ARTHostStats *> *)fallbackHostRanking {
+    return [_hostStatsTracker statsForHosts:[ARTFallbackHosts hostsFromOptions:_options] ?: @[]];
+}
+
 - (NSObject<ARTCancellable> *)_timeWithWrapperSDKAgents:(nullable NSStringDictionary *)wrapperSDKAgents
                                              completion:(ARTDateTimeCallback)callback {
     NSURL *requestUrl = [NSURL URLWithString:@"/time" relativeToURL:self.baseUrl];
@@ -581,6 +838,60 @@ NS_ASSUME_NONNULL_END
     }];
 }
 
+- (void)prewarmConnectionsWithWrapperSDKAgents:(nullable NSStringDictionary *)wrapperSDKAgents
+                                    completion:(ARTCallback)callback {
+    if (callback) {
+        ARTCallback userCallback = callback;
+        callback = ^(ARTErrorInfo *error) {
+            art_dispatch_async(self->_userQueue, ^{
+                userCallback(error);
+            });
+        };
+    }
+    art_dispatch_async(_queue, ^{
+        [self _prewarmConnectionsWithWrapperSDKAgents:wrapperSDKAgents
+                                           completion:callback];
+    });
+}
+
+- (void)_prewarmConnectionsWithWrapperSDKAgents:(nullable NSStringDictionary *)wrapperSDKAgents
+                                     completion:(ARTCallback)callback {
+    NSString *const primaryHost = self.baseUrl.host;
+    NSMutableArray<NSString *> *const hosts = [NSMutableArray arrayWithObject:primaryHost];
+    for (NSString *host in [ARTFallbackHosts hostsFromOptions:_options]) {
+        if (![hosts containsObject:host]) {
+            [hosts addObject:host];
+        }
+    }
+
+    __block NSUInteger remaining = hosts.count;
+    __block ARTErrorInfo *primaryError = nil;
+    for (NSString *host in hosts) {
+        // Sent straight to the executor: a prewarm request must reach the given host, without the fallback logic of `executeRequest:`.
+        NSURLComponents *const components = [_options restUrlComponents];
+        components.host = host;
+        components.path = @"/time";
+        NSMutableURLRequest *const request = [NSMutableURLRequest requestWithURL:components.URL];
+        request.HTTPMethod = @"GET";
+        request.timeoutInterval = _options.httpRequestTimeout;
+        [request setValue:[ARTDefault apiVersion] forHTTPHeaderField:@"X-Ably-Version"];
+        [request setValue:[self agentIdentifierWithWrapperSDKAgents:wrapperSDKAgents] forHTTPHeaderField:@"Ably-Agent"];
+
+        ARTLogDebug(self.logger, @"RS:%p prewarming connection to %@", self, host);
+        [self.httpExecutor executeRequest:request completion:^(NSHTTPURLResponse *response, NSData *data, NSError *error) {
+            if (error) {
+                ARTLogDebug(self.logger, @"RS:%p failed to prewarm connection to %@: %@", self, host, error);
+                if ([host isEqualToString:primaryHost]) {
+                    primaryError = [ARTErrorInfo createFromNSError:error];
+                }
+            }
+            if (--remaining == 0 && callback) {
+                callback(primaryError);
+            }
+        }];
+    }
+}
+
 - (BOOL)request:(NSString *)method
            path:(NSString *)path
          params:(nullable NSStringDictionary *)params
@@ -752,6 +1063,78 @@ art_dispatch_async(_queue, ^{
     return YES;
 }
 
+- (BOOL)batchPresence:(NSArray<NSString *> *)channels wrapperSDKAgents:(nullable NSStringDictionary *)wrapperSDKAgents callback:(ARTBatchPresenceCallback)callback error:(NSError **)errorPtr {
+    if (callback) {
+        ARTBatchPresenceCallback userCallback = callback;
+        callback = ^(ARTBatchPresenceResult *r, ARTErrorInfo *e) {
+            art_dispatch_async(self->_userQueue, ^{
+                userCallback(r, e);
+            });
+        };
+    }
+
+    if (channels.count == 0) {
+        if (errorPtr) {
+            *errorPtr = [NSError errorWithDomain:ARTAblyErrorDomain
+                                            code:ARTDataQueryErrorMissingRequiredFields
+                                        userInfo:@{NSLocalizedDescriptionKey:@"At least one channel name is required"}];
+        }
+        return NO;
+    }
+
+art_dispatch_async(_queue, ^{
+    NSMutableArray<NSString *> *channelNames = [NSMutableArray arrayWithCapacity:channels.count];
+    for (NSString *channel in channels) {
+        [channelNames addObject:[self.channels _addPrefix:channel]];
+    }
+
+    NSURLComponents *requestUrl = [NSURLComponents componentsWithString:@"/presence"];
+    requestUrl.queryItems = @[[NSURLQueryItem queryItemWithName:@"channels" value:[channelNames componentsJoinedByString:@","]]];
+    NSMutableURLRequest *request = [NSMutableURLRequest requestWithURL:[requestUrl URLRelativeToURL:self.baseUrl]];
+    request.HTTPMethod = @"GET";
+
+    ARTLogDebug(self.logger, @"RS:%p batch presence request %@", self, request);
+    [self executeRequest:request withAuthOption:ARTAuthenticationOn wrapperSDKAgents:wrapperSDKAgents completion:^(NSHTTPURLResponse *response, NSData *data, NSError *error) {
+        // A partially failed batch may still carry the per-channel results in its body, so try to decode it before giving up on an error.
+        ARTBatchPresenceResult *result = nil;
+        NSError *decodeError = nil;
+        id<ARTEncoder> decoder = self.encoders[response.MIMEType];
+        if (data.length > 0 && decoder) {
+            result = [decoder decodeBatchPresenceResult:data error:&decodeError];
+        }
+        if (!result) {
+            NSError *resultError = error ?: decodeError;
+            if (!resultError) {
+                NSString *errorMessage = [NSString stringWithFormat:@"Unable to decode batch presence response with MIMEType '%@'", response.MIMEType];
+                resultError = [ARTErrorInfo createWithCode:ARTErrorUnableToDecodeMessage message:errorMessage];
+            }
+            ARTLogDebug(self.logger, @"RS:%p batch presence request failed %@", self, resultError);
+            if (callback) callback(nil, [ARTErrorInfo createFromNSError:resultError]);
+            return;
+        }
+
+        ARTDataEncoder *defaultDataEncoder = [[ARTDataEncoder alloc] initWithCipherParams:nil logger:self.logger error:nil];
+        NSMutableArray<ARTBatchPresenceSuccessResult *> *successes = [NSMutableArray arrayWithCapacity:result.successCount];
+        for (ARTBatchPresenceSuccessResult *success in result.successes) {
+            // Use the channel's own data encoder where one exists, so that members of encrypted channels are decrypted.
+            ARTDataEncoder *dataEncoder = [self.channels _getIfExists:success.channel].dataEncoder ?: defaultDataEncoder;
+            NSArray<ARTPresenceMessage *> *presence = [success.presence artMap:^(ARTPresenceMessage *message) {
+                NSError *messageDecodeError = nil;
+                ARTPresenceMessage *decoded = [message decodeWithEncoder:dataEncoder error:&messageDecodeError];
+                if (messageDecodeError != nil) {
+                    ARTLogError(self.logger, @"RS:%p failed to decode presence data on channel %@: %@", self, success.channel, messageDecodeError);
+                }
+                return decoded;
+            }];
+            [successes addObject:[[ARTBatchPresenceSuccessResult alloc] initWithChannel:success.channel presence:presence]];
+        }
+
+        if (callback) callback([[ARTBatchPresenceResult alloc] initWithSuccesses:successes failures:result.failures], nil);
+    }];
+});
+    return YES;
+}
+
 - (id<ARTEncoder>)defaultEncoder {
     return self.encoders[self.defaultEncoding];
 }
@@ -887,3 +1270,40 @@ static BOOL sharedDeviceNeedsLoading_onlyAccessOnDeviceAccessQueue = YES;
 }
 
 @end
+
+#pragma mark - ARTHedgedRequest
+
+@implementation ARTHedgedRequest {
+    dispatch_queue_t _queue;
+}
+
+- (instancetype)initWithRequest:(NSURLRequest *)request
+                      fallbacks:(ARTFallback *)fallbacks
+                      requestId:(nullable NSString *)requestId
+               wrapperSDKAgents:(nullable NSDictionary<NSString *, NSString *> *)wrapperSDKAgents
+                          queue:(dispatch_queue_t)queue
+                       callback:(nullable ARTURLRequestCallback)callback {
+    if (self = [super init]) {
+        _request = [request copy];
+        _fallbacks = fallbacks;
+        _requestId = requestId;
+        _wrapperSDKAgents = wrapperSDKAgents;
+        _queue = queue;
+        _callback = callback;
+        _tasks = [NSMutableArray array];
+    }
+    return self;
+}
+
+- (void)cancel {
+    art_dispatch_async(_queue, ^{
+        // The attempts report their cancellation through the usual callback, which finishes the request.
+        self.cancelled = YES;
+        [self.hedgeTimer cancel];
+        for (NSObject<ARTCancellable> *task in self.tasks) {
+            [task cancel];
+        }
+    });
+}
+
+@end
@@ -241,17 +241,25 @@ art_dispatch_sync(_queue, ^{
 
     NSMutableURLRequest *request = [NSMutableURLRequest requestWithURL:componentsUrl.URL];
 
+    const BOOL newestFirst = query.direction == ARTQueryDirectionBackwards;
     ARTPaginatedResultResponseProcessor responseProcessor = ^NSArray<ARTMessage *> *(NSHTTPURLResponse *response, NSData *data, NSError **errorPtr) {
         id<ARTEncoder> encoder = [self->_rest.encoders objectForKey:response.MIMEType];
-        return [[encoder decodeMessages:data error:errorPtr] artMap:^(ARTMessage *message) {
+        NSArray<ARTMessage *> *const messages = [encoder decodeMessages:data error:errorPtr];
+        // Messages published as deltas (see `ARTRealtimeChannelOptions.publishesDeltas`) are relative to the message published before them, so the page is decoded oldest first, by a decoder of its own. A delta relative to a message that isn't on the page can't be decoded.
+        ARTDataEncoder *const pageDecoder = [self.dataEncoder decoderWithoutDeltaBases];
+        NSMutableArray<ARTMessage *> *const decodedMessages = [NSMutableArray arrayWithArray:messages];
+        for (NSUInteger n = 0; n < messages.count; n++) {
+            const NSUInteger index = newestFirst ? messages.count - 1 - n : n;
+            ARTMessage *const message = messages[index];
             NSError *decodeError = nil;
-            message = [message decodeWithEncoder:self.dataEncoder error:&decodeError];
+            ARTDataEncoderOutput *const output = [pageDecoder decode:message.data identifier:message.id ?: @"" deltaBaseId:[message deltaBaseId] encoding:message.encoding];
+            decodedMessages[index] = [message decodeWithEncoderOutput:output error:&decodeError];
             if (decodeError != nil) {
                 ARTErrorInfo *errorInfo = [ARTErrorInfo wrap:[ARTErrorInfo createWithCode:ARTErrorUnableToDecodeMessage message:decodeError.localizedFailureReason] prepend:@"Failed to decode data: "];
                 ARTLogError(self.logger, @"RS:%p C:%p (%@) %@", self->_rest, self, self.name, errorInfo.message);
             }
-            return message;
-        }];
+        }
+        return messages ? decodedMessages : nil;
     };
 
     ARTLogDebug(self.logger, @"RS:%p C:%p (%@) stats request %@", self->_rest, self, self.name, request);
@@ -98,4 +98,12 @@ NS_ASSUME_NONNULL_END
     return [_channels _getChannel:name options:options addPrefix:addPrefix];
 }
 
+- (ARTRestChannelInternal *)_getIfExists:(NSString *)name {
+    return [_channels _get:[_channels addPrefix:name]];
+}
+
+- (NSString *)_addPrefix:(NSString *)name {
+    return [_channels addPrefix:name];
+}
+
 @end
@@ -0,0 +1,187 @@
+#import "ARTSharedTokenCache.h"
+#import "ARTTokenDetails.h"
+#import "ARTGCD.h"
+
+@class ARTSharedTokenFetch;
+
+/**
+ A caller waiting for a token. Cancelling it stops its callback from being called.
+ */
+@interface ARTSharedTokenCacheRequest : NSObject <ARTCancellable>
+
+@property (readonly, nonatomic) dispatch_queue_t queue;
+@property (nullable, nonatomic) ARTTokenDetailsCallback callback;
+@property (nullable, nonatomic) ARTSharedTokenFetch *fetch;
+
+- (instancetype)initWithCache:(ARTSharedTokenCache *)cache queue:(dispatch_queue_t)queue callback:(ARTTokenDetailsCallback)callback;
+
+@end
+
+/**
+ A token fetch in progress, and the callers waiting for it.
+ */
+@interface ARTSharedTokenFetch : NSObject
+
+@property (readonly, nonatomic) NSString *key;
+@property (readonly, nonatomic) NSMutableArray<ARTSharedTokenCacheRequest *> *requests;
+
+- (instancetype)initWithKey:(NSString *)key;
+
+@end
+
+@implementation ARTSharedTokenFetch
+
+- (instancetype)initWithKey:(NSString *)key {
+    if (self = [super init]) {
+        _key = key;
+        _requests = [NSMutableArray array];
+    }
+    return self;
+}
+
+@end
+
+#pragma mark - ARTSharedTokenCache
+
+@implementation ARTSharedTokenCache {
+    NSMutableDictionary<NSString *, ARTTokenDetails *> *_tokens;
+    NSMutableDictionary<NSString *, ARTSharedTokenFetch *> *_fetches;
+}
+
++ (instancetype)sharedCache {
+    static ARTSharedTokenCache *cache;
+    static dispatch_once_t onceToken;
+
+    dispatch_once(&onceToken, ^{
+        cache = [[ARTSharedTokenCache alloc] init];
+    });
+
+    return cache;
+}
+
+- (instancetype)init {
+    if (self = [super init]) {
+        _tokens = [NSMutableDictionary dictionary];
+        _fetches = [NSMutableDictionary dictionary];
+    }
+    return self;
+}
+
+- (NSObject<ARTCancellable> *)tokenForKey:(NSString *)key
+                                replacing:(NSString *)currentToken
+                                  isValid:(BOOL (^)(ARTTokenDetails *))isValid
+                                    queue:(dispatch_queue_t)queue
+                                    fetch:(void (^)(ARTTokenDetailsCallback))fetch
+                                 callback:(ARTTokenDetailsCallback)callback {
+    ARTSharedTokenCacheRequest *const request = [[ARTSharedTokenCacheRequest alloc] initWithCache:self queue:queue callback:callback];
+
+    ARTSharedTokenFetch *newFetch = nil;
+    @synchronized (self) {
+        ARTTokenDetails *const cached = _tokens[key];
+        if (cached && ![cached.token isEqualToString:currentToken] && isValid(cached)) {
+            [self completeRequests:@[request] tokenDetails:cached error:nil];
+            return request;
+        }
+
+        ARTSharedTokenFetch *fetchInProgress = _fetches[key];
+        if (!fetchInProgress) {
+            fetchInProgress = newFetch = [[ARTSharedTokenFetch alloc] initWithKey:key];
+            _fetches[key] = newFetch;
+        }
+        request.fetch = fetchInProgress;
+        [fetchInProgress.requests addObject:request];
+    }
+
+    if (newFetch) {
+        fetch(^(ARTTokenDetails *tokenDetails, NSError *error) {
+            [self completeFetch:newFetch tokenDetails:tokenDetails error:error];
+        });
+    }
+    return request;
+}
+
+- (void)completeFetch:(ARTSharedTokenFetch *)fetch tokenDetails:(ARTTokenDetails *)tokenDetails error:(NSError *)error {
+    NSArray<ARTSharedTokenCacheRequest *> *requests;
+    @synchronized (self) {
+        if (_fetches[fetch.key] == fetch) {
+            [_fetches removeObjectForKey:fetch.key];
+        }
+        if (tokenDetails.token && !error) {
+            _tokens[fetch.key] = tokenDetails;
+        }
+        requests = [fetch.requests copy];
+        [fetch.requests removeAllObjects];
+    }
+    [self completeRequests:requests tokenDetails:tokenDetails error:error];
+}
+
+- (void)completeRequests:(NSArray<ARTSharedTokenCacheRequest *> *)requests tokenDetails:(ARTTokenDetails *)tokenDetails error:(NSError *)error {
+    for (ARTSharedTokenCacheRequest *request in requests) {
+        art_dispatch_async(request.queue, ^{
+            ARTTokenDetailsCallback callback;
+            @synchronized (self) {
+                callback = request.callback;
+                request.callback = nil;
+                request.fetch = nil;
+            }
+            if (callback) {
+                callback(tokenDetails, error);
+            }
+        });
+    }
+}
+
+- (void)cancelRequest:(ARTSharedTokenCacheRequest *)request {
+    @synchronized (self) {
+        request.callback = nil;
+        ARTSharedTokenFetch *const fetch = request.fetch;
+        request.fetch = nil;
+        if (!fetch) {
+            return;
+        }
+        [fetch.requests removeObject:request];
+        // Once nobody is waiting for it, a fetch that may never complete (for example, an authCallback that never calls back) mustn't hold up the next caller.
+        if (fetch.requests.count == 0 && _fetches[fetch.key] == fetch) {
+            [_fetches removeObjectForKey:fetch.key];
+        }
+    }
+}
+
+- (void)invalidateToken:(NSString *)token {
+    @synchronized (self) {
+        for (NSString *key in [_tokens allKeys]) {
+            if ([_tokens[key].token isEqualToString:token]) {
+                [_tokens removeObjectForKey:key];
+            }
+        }
+    }
+}
+
+- (void)removeAllTokens {
+    @synchronized (self) {
+        [_tokens removeAllObjects];
+    }
+}
+
+@end
+
+#pragma mark - ARTSharedTokenCacheRequest
+
+@implementation ARTSharedTokenCacheRequest {
+    __weak ARTSharedTokenCache *_cache; // weak because the cache owns the fetches that hold requests
+}
+
+- (instancetype)initWithCache:(ARTSharedTokenCache *)cache queue:(dispatch_queue_t)queue callback:(ARTTokenDetailsCallback)callback {
+    if (self = [super init]) {
+        _cache = cache;
+        _queue = queue;
+        _callback = callback;
+    }
+    return self;
+}
+
+- (void)cancel {
+    [_cache cancelRequest:self];
+}
+
+@end
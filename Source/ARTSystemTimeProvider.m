@@ -42,6 +42,15 @@
     return [[ARTSystemContinuousClockInstant alloc] initWithTime:time];
 }
 
+- (NSTimeInterval)timeIntervalSinceInstant:(id<ARTContinuousClockInstant>)other {
+    if (![other isKindOfClass:[ARTSystemContinuousClockInstant class]]) {
+        [NSException raise:NSInvalidArgumentException
+                    format:@"Cannot compare an ARTSystemContinuousClockInstant with a %@", [other class]];
+    }
+    ARTSystemContinuousClockInstant *const concreteOther = (ARTSystemContinuousClockInstant *)other;
+    return ((double)_timeInNanosecondsSinceClockReferenceInstant - (double)concreteOther->_timeInNanosecondsSinceClockReferenceInstant) / NSEC_PER_SEC;
+}
+
 @end
 
 /**
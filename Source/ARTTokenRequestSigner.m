@@ -0,0 +1,127 @@
+#import "ARTTokenRequestSigner.h"
+#import "ARTTokenParams.h"
+#import "ARTTokenRequest.h"
+#import "ARTTypes.h"
+
+#import <CommonCrypto/CommonDigest.h>
+
+// HMAC (RFC 2104) block size of SHA-256
+#define ART_HMAC_SHA256_BLOCK_LENGTH (64)
+
+static const char ARTTokenRequestSignerBase64Alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+static void ARTTokenRequestSignerUpdateWithString(CC_SHA256_CTX *context, NSString *string) {
+    char buffer[256];
+    NSUInteger usedLength = 0;
+    NSRange remaining = NSMakeRange(0, string.length);
+    // Without allocating, even for long capabilities
+    while (remaining.length > 0) {
+        NSRange converted;
+        [string getBytes:buffer maxLength:sizeof(buffer) usedLength:&usedLength encoding:NSUTF8StringEncoding options:0 range:remaining remainingRange:&converted];
+        if (usedLength == 0) {
+            break;
+        }
+        CC_SHA256_Update(context, buffer, (CC_LONG)usedLength);
+        remaining = converted;
+    }
+}
+
+static void ARTTokenRequestSignerUpdateWithNumber(CC_SHA256_CTX *context, uint64_t number) {
+    char buffer[24];
+    const int length = snprintf(buffer, sizeof(buffer), "%llu", (unsigned long long)number);
+    CC_SHA256_Update(context, buffer, (CC_LONG)length);
+}
+
+@implementation ARTTokenRequestSigner {
+    // The SHA-256 states after hashing the key XOR ipad and the key XOR opad, from which every signature starts.
+    CC_SHA256_CTX _innerContext;
+    CC_SHA256_CTX _outerContext;
+}
+
+- (instancetype)initWithKey:(NSString *)key {
+    NSArray<NSString *> *const keyComponents = decomposeKey(key);
+    if (keyComponents.count < 2) {
+        return nil;
+    }
+
+    if (self = [super init]) {
+        _key = [key copy];
+        _keyName = keyComponents[0];
+
+        NSData *const secret = [keyComponents[1] dataUsingEncoding:NSUTF8StringEncoding];
+        uint8_t block[ART_HMAC_SHA256_BLOCK_LENGTH] = {0};
+        if (secret.length > ART_HMAC_SHA256_BLOCK_LENGTH) {
+            CC_SHA256(secret.bytes, (CC_LONG)secret.length, block);
+        }
+        else {
+            memcpy(block, secret.bytes, secret.length);
+        }
+
+        uint8_t pad[ART_HMAC_SHA256_BLOCK_LENGTH];
+        for (int i = 0; i < ART_HMAC_SHA256_BLOCK_LENGTH; i++) {
+            pad[i] = block[i] ^ 0x36;
+        }
+        CC_SHA256_Init(&_innerContext);
+        CC_SHA256_Update(&_innerContext, pad, sizeof(pad));
+        for (int i = 0; i < ART_HMAC_SHA256_BLOCK_LENGTH; i++) {
+            pad[i] = block[i] ^ 0x5c;
+        }
+        CC_SHA256_Init(&_outerContext);
+        CC_SHA256_Update(&_outerContext, pad, sizeof(pad));
+        memset(block, 0, sizeof(block));
+        memset(pad, 0, sizeof(pad));
+    }
+    return self;
+}
+
+- (ARTTokenRequest *)signTokenParams:(ARTTokenParams *)tokenParams {
+    return [self signTokenParams:tokenParams nonce:tokenParams.nonce ? tokenParams.nonce : generateNonce()];
+}
+
+- (ARTTokenRequest *)signTokenParams:(ARTTokenParams *)tokenParams nonce:(NSString *)nonce {
+    static const char newline = '\n';
+
+    // The same text as `-[ARTTokenParams sign:withNonce:]` signs, hashed a piece at a time.
+    CC_SHA256_CTX context = _innerContext;
+    ARTTokenRequestSignerUpdateWithString(&context, _keyName);
+    CC_SHA256_Update(&context, &newline, 1);
+    if (tokenParams.ttl != nil) {
+        ARTTokenRequestSignerUpdateWithNumber(&context, timeIntervalToMilliseconds([tokenParams.ttl doubleValue]));
+    }
+    CC_SHA256_Update(&context, &newline, 1);
+    if (tokenParams.capability) {
+        ARTTokenRequestSignerUpdateWithString(&context, tokenParams.capability);
+    }
+    CC_SHA256_Update(&context, &newline, 1);
+    if (tokenParams.clientId) {
+        ARTTokenRequestSignerUpdateWithString(&context, tokenParams.clientId);
+    }
+    CC_SHA256_Update(&context, &newline, 1);
+    ARTTokenRequestSignerUpdateWithNumber(&context, dateToMilliseconds(tokenParams.timestamp));
+    CC_SHA256_Update(&context, &newline, 1);
+    ARTTokenRequestSignerUpdateWithString(&context, nonce);
+    CC_SHA256_Update(&context, &newline, 1);
+
+    uint8_t digest[CC_SHA256_DIGEST_LENGTH];
+    CC_SHA256_Final(digest, &context);
+    context = _outerContext;
+    CC_SHA256_Update(&context, digest, sizeof(digest));
+    CC_SHA256_Final(digest, &context);
+
+    // Base64, with padding, of the 32-byte MAC
+    char mac[((CC_SHA256_DIGEST_LENGTH + 2) / 3) * 4];
+    size_t length = 0;
+    for (size_t i = 0; i < CC_SHA256_DIGEST_LENGTH; i += 3) {
+        const uint32_t remaining = CC_SHA256_DIGEST_LENGTH - (uint32_t)i;
+        const uint32_t triple = (digest[i] << 16) | (remaining > 1 ? digest[i + 1] << 8 : 0) | (remaining > 2 ? digest[i + 2] : 0);
+        mac[length++] = ARTTokenRequestSignerBase64Alphabet[(triple >> 18) & 0x3f];
+        mac[length++] = ARTTokenRequestSignerBase64Alphabet[(triple >> 12) & 0x3f];
+        mac[length++] = remaining > 1 ? ARTTokenRequestSignerBase64Alphabet[(triple >> 6) & 0x3f] : '=';
+        mac[length++] = remaining > 2 ? ARTTokenRequestSignerBase64Alphabet[triple & 0x3f] : '=';
+    }
+
+    NSString *const macString = [[NSString alloc] initWithBytes:mac length:length encoding:NSASCIIStringEncoding];
+    return [[ARTTokenRequest alloc] initWithTokenParams:tokenParams keyName:_keyName nonce:nonce mac:macString];
+}
+
+@end
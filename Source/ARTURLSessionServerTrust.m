@@ -1,31 +1,88 @@
 #import "ARTURLSessionServerTrust.h"
+#import "ARTHTTPConnectionMetrics.h"
 #import "ARTGCD.h"
 
 @interface ARTURLSessionServerTrust() {
     NSURLSession *_session;
     dispatch_queue_t _queue;
+    BOOL _sharingSession;
+    BOOL _returnedSharedSession;
 }
 
 @end
 
 @implementation ARTURLSessionServerTrust
 
+@synthesize connectionMetrics = _connectionMetrics;
+
 - (instancetype)init:(dispatch_queue_t)queue {
+    return [self init:queue sharingSession:NO];
+}
+
+- (instancetype)init:(dispatch_queue_t)queue sharingSession:(BOOL)sharingSession {
     if (self = [super init]) {
         _queue = queue;
-        NSURLSessionConfiguration *config = [NSURLSessionConfiguration ephemeralSessionConfiguration];
+        _sharingSession = sharingSession;
+        if (sharingSession) {
+            ARTURLSessionServerTrust *const owner = [ARTURLSessionServerTrust borrowSharedSessionOwner];
+            _session = owner->_session;
+            _connectionMetrics = owner->_connectionMetrics;
+        }
+        else {
+            _connectionMetrics = [[ARTHTTPConnectionMetrics alloc] init];
+            _session = [NSURLSession sessionWithConfiguration:[ARTURLSessionServerTrust sessionConfiguration] delegate:self delegateQueue:nil];
+        }
+    }
+    return self;
+}
+
++ (NSURLSessionConfiguration *)sessionConfiguration {
+    NSURLSessionConfiguration *config = [NSURLSessionConfiguration ephemeralSessionConfiguration];
 #if TARGET_OS_MACCATALYST // if (@available(iOS 13.0, macCatalyst 13.0, ... doesn't help
-        config.TLSMinimumSupportedProtocolVersion = tls_protocol_version_TLSv12;
+    config.TLSMinimumSupportedProtocolVersion = tls_protocol_version_TLSv12;
 #else
-        if (@available(iOS 13.0, macOS 10.15, tvOS 13.0, *)) {
-            config.TLSMinimumSupportedProtocolVersion = tls_protocol_version_TLSv12;
-        } else {
-            config.TLSMinimumSupportedProtocol = kTLSProtocol12;
-        }
+    if (@available(iOS 13.0, macOS 10.15, tvOS 13.0, *)) {
+        config.TLSMinimumSupportedProtocolVersion = tls_protocol_version_TLSv12;
+    } else {
+        config.TLSMinimumSupportedProtocol = kTLSProtocol12;
+    }
 #endif
-        _session = [NSURLSession sessionWithConfiguration:config delegate:self delegateQueue:nil];
+    return config;
+}
+
+// The instance that owns the shared session (and acts as its delegate), and the number of instances created with `sharingSession` that haven't yet called `finishTasksAndInvalidate`. Guarded by `@synchronized` on the class.
+static ARTURLSessionServerTrust *sharedSessionOwner;
+static NSUInteger sharedSessionBorrowerCount;
+
++ (ARTURLSessionServerTrust *)borrowSharedSessionOwner {
+    @synchronized (self) {
+        if (!sharedSessionOwner) {
+            sharedSessionOwner = [[ARTURLSessionServerTrust alloc] init:dispatch_queue_create("io.ably.sharedURLSession", DISPATCH_QUEUE_SERIAL) sharingSession:NO];
+        }
+        sharedSessionBorrowerCount++;
+        return sharedSessionOwner;
+    }
+}
+
+// Invalidates the shared session once its last borrower has returned it; the next borrower gets a new one.
++ (void)returnSharedSessionOwner {
+    @synchronized (self) {
+        if (--sharedSessionBorrowerCount > 0) {
+            return;
+        }
+        [sharedSessionOwner finishTasksAndInvalidate];
+        sharedSessionOwner = nil;
+    }
+}
+
++ (NSUInteger)sharedSessionBorrowerCount {
+    @synchronized (self) {
+        return sharedSessionBorrowerCount;
     }
-    return self;
+}
+
+- (NSURLSession *)session {
+    return _session;
 }
 
 - (dispatch_queue_t)queue {
@@ -33,6 +90,13 @@
 }
 
 - (void)finishTasksAndInvalidate {
+    if (_sharingSession) {
+        if (!_returnedSharedSession) {
+            _returnedSharedSession = YES;
+            [ARTURLSessionServerTrust returnSharedSessionOwner];
+        }
+        return;
+    }
     [_session finishTasksAndInvalidate];
 }
 
@@ -46,4 +110,14 @@
     return task;
 }
 
+#pragma mark - NSURLSessionTaskDelegate
+
+- (void)URLSession:(NSURLSession *)session task:(NSURLSessionTask *)task didFinishCollectingMetrics:(NSURLSessionTaskMetrics *)metrics API_AVAILABLE(macos(10.12), ios(10.0), tvos(10.0)) {
+    // Earlier transactions of the same task are redirects; the last one is the response that was handed back.
+    NSURLSessionTaskTransactionMetrics *const transactionMetrics = metrics.transactionMetrics.lastObject;
+    if (transactionMetrics) {
+        [_connectionMetrics recordTransactionMetrics:transactionMetrics];
+    }
+}
+
 @end
@@ -49,6 +49,10 @@ NS_ASSUME_NONNULL_END
 }
 #endif
 
+- (NSArray<ARTHostStats *> *)fallbackHostRanking {
+    return self.underlyingRealtime.fallbackHostRanking;
+}
+
 - (void)close {
     [self.underlyingRealtime close];
 }
@@ -20,9 +20,20 @@ NS_ASSUME_NONNULL_BEGIN
 - (NSDictionary<NSString *, id> *)load;
 
 /// Writes `dictionary` to the file. The write is atomic at the file-system
-/// level (write-to-temp-and-rename). Returns `YES` on success.
+/// level: the data is written to `temporaryFileURL` and flushed to disk, and
+/// that file is then renamed over `fileURL`. If the write is interrupted, the
+/// file keeps its previous contents; a leftover temporary file is never read,
+/// and is replaced by the next write. Returns `YES` on success.
 - (BOOL)save:(NSDictionary<NSString *, id> *)dictionary error:(NSError * _Nullable * _Nullable)error;
 
+/// The file that `save:error:` writes before renaming it to `fileURL`.
+@property (nonatomic, readonly) NSURL *temporaryFileURL;
+
+/// For tests. Called by `save:error:` once the temporary file has been written,
+/// before it replaces the file; returning an error fails the save at that point,
+/// as if the process had been interrupted.
+@property (nullable, nonatomic) NSError *_Nullable (^beforeReplacingFile)(NSURL *temporaryFileURL);
+
 - (BOOL)fileExists;
 
 @end
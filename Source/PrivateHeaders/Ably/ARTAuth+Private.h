@@ -4,6 +4,7 @@
 
 @class ARTRestInternal;
 @class ARTInternalLog;
+@protocol ARTContinuousClockInstant;
 
 typedef NS_ENUM(NSUInteger, ARTAuthorizationState) {
     ARTAuthorizationSucceeded, //ItemType: nil
@@ -36,6 +37,8 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (void)createTokenRequest:(void (^)(ARTTokenRequest *_Nullable tokenRequest, NSError *_Nullable error))callback;
 
+- (nullable ARTTokenRequest *)createTokenRequestSynchronously:(nullable ARTTokenParams *)tokenParams error:(NSError *_Nullable *_Nullable)error;
+
 /// Provides the implementation for `-[ARTPluginAPI nosync_fetchServerTimeForClient:completion:]`. See documentation for that method in `APPluginAPIProtocol`.
 - (void)fetchServerTimeWithCompletion:(void (^ _Nullable)(NSDate *_Nullable serverTime, ARTErrorInfo *_Nullable error))completion;
 
@@ -44,6 +47,9 @@ NS_ASSUME_NONNULL_BEGIN
 /// Messages related to the ARTAuth
 @protocol ARTAuthDelegate <NSObject>
 - (void)auth:(ARTAuthInternal *)auth didAuthorize:(ARTTokenDetails *)tokenDetails completion:(void (^)(ARTAuthorizationState, ARTErrorInfo *_Nullable))completion;
+@optional
+/// Whether the token should be renewed now that `ARTClientOptions.tokenRenewalFraction` of its lifetime has elapsed. If not implemented, it is. If not, the renewal waits for `-[ARTAuthInternal renewTokenIfRenewalWasDeferred]`.
+- (BOOL)authShouldRenewTokenProactively:(ARTAuthInternal *)auth;
 @end
 
 @interface ARTAuthInternal ()
@@ -68,6 +74,29 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (void)cancelAuthorization:(nullable ARTErrorInfo *)error;
 
+/**
+ Authorizes with the current token params and auth options, like `_authorize:options:callback:`, but if a renewal started by this method is already in progress, waits for its result instead of requesting another token.
+ */
+- (void)_renewToken:(nullable ARTTokenDetailsCallback)callback;
+
+/// Identifies the tokens that `ARTClientOptions.sharesTokens` clients can share with each other: those requested from the same host with the same credentials, clientId and token params. `nil` if tokens requested with `options` mustn't be shared: those from an `authCallback` without an `ARTClientOptions.sharedTokenCacheIdentity`.
+- (nullable NSString *)sharedTokenCacheKeyForParams:(ARTTokenParams *)params options:(ARTAuthOptions *)options;
+
+/// Whether `tokenDetails` can still be used, judged as `tokenRemainsValid` judges the current token: by the server's time, once the offset from it is known (RSA4b1).
+- (BOOL)tokenDetailsRemainValid:(nullable ARTTokenDetails *)tokenDetails;
+
+/// Stops other `ARTClientOptions.sharesTokens` clients from being given the current token, once Ably has rejected it.
+- (void)invalidateSharedToken;
+
+/// When the current token is due to be renewed proactively (see `ARTClientOptions.tokenRenewalFraction`), if it is.
+@property (nullable, nonatomic, readonly) id<ARTContinuousClockInstant> tokenRenewalDeadline;
+
+/// Whether a proactive renewal of the current token fell due while the delegate declined it, and hasn't happened since.
+@property (nonatomic, readonly) BOOL tokenRenewalDeferred;
+
+/// Renews the current token proactively if a renewal fell due while the delegate declined it (see `authShouldRenewTokenProactively:`). The delegate calls this once it can apply a new token.
+- (void)renewTokenIfRenewalWasDeferred;
+
 - (nullable NSObject<ARTCancellable> *)_requestToken:(ARTTokenParams *_Nullable)tokenParams
                                          withOptions:(ARTAuthOptions *_Nullable)authOptions
                                             callback:(ARTTokenDetailsCallback)callback;
@@ -10,6 +10,8 @@ NS_ASSUME_NONNULL_BEGIN
 @property (nonatomic, readonly) BOOL isIdEmpty;
 
 - (id __nonnull)decodeWithEncoder:(ARTDataEncoder*)encoder error:(NSError *__nullable*__nullable)error;
+/// Like `decodeWithEncoder:error:`, for when the message's data has already been decoded (see `-[ARTDataEncoder decodeBatch:encodings:]`).
+- (id __nonnull)decodeWithEncoderOutput:(ARTDataEncoderOutput *)decoded error:(NSError *__nullable*__nullable)error;
 - (id __nonnull)encodeWithEncoder:(ARTDataEncoder*)encoder error:(NSError *__nullable*__nullable)error;
 
 @end
@@ -19,6 +19,9 @@ NS_SWIFT_SENDABLE
 /// Returns a new instant representing the receiver advanced by `duration` seconds.
 - (id<ARTContinuousClockInstant>)addingDuration:(NSTimeInterval)duration;
 
+/// Returns the number of seconds from `other` to the receiver; negative if `other` is later.
+- (NSTimeInterval)timeIntervalSinceInstant:(id<ARTContinuousClockInstant>)other NS_SWIFT_NAME(timeIntervalSince(_:));
+
 @end
 
 NS_ASSUME_NONNULL_END
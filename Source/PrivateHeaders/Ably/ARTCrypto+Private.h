@@ -15,6 +15,13 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (ARTStatus *)encrypt:(NSData *)plaintext output:(NSData *_Nullable *_Nullable)output;
 - (ARTStatus *)decrypt:(NSData *)ciphertext output:(NSData *_Nullable *_Nullable)output;
+
+/// The size of buffer that `decrypt:intoBuffer:capacity:length:` needs for a ciphertext of the given length.
+- (size_t)maxDecryptedLengthForCiphertextLength:(size_t)length;
+
+/// Like `decrypt:output:`, but writes the plaintext into `buffer` (of at least `maxDecryptedLengthForCiphertextLength:` bytes) instead of allocating its own, and sets `length` to its length. Safe to call concurrently.
+- (ARTStatus *)decrypt:(NSData *)ciphertext intoBuffer:(void *)buffer capacity:(size_t)capacity length:(size_t *)length;
+
 - (nullable NSString *)cipherName;
 - (size_t) keyLength;
 
@@ -6,6 +6,7 @@
 @class ARTCipherParams;
 @class ARTPlugin;
 @class ARTInternalLog;
+@class ARTDeltaBaseCache;
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -32,6 +33,34 @@ NS_ASSUME_NONNULL_BEGIN
 - (ARTDataEncoderOutput *)decode:(id _Nullable)data encoding:(NSString *_Nullable)encoding;
 - (ARTDataEncoderOutput *)decode:(id _Nullable)data identifier:(NSString *)identifier encoding:(NSString *_Nullable)encoding;
 
+/// Like `decode:identifier:encoding:`, where `deltaBaseId` is the id of the message that a vcdiff-encoded `data` is relative to (its `extras.delta.from`), if known. Such a delta is applied to that message's payload if it is still in `deltaBaseCache`.
+- (ARTDataEncoderOutput *)decode:(id _Nullable)data identifier:(NSString *)identifier deltaBaseId:(NSString *_Nullable)deltaBaseId encoding:(NSString *_Nullable)encoding;
+
+/// Returns an encoder with the same cipher that hasn't decoded anything, for decoding payloads that don't follow on from those that this one has decoded, such as a page of history.
+- (ARTDataEncoder *)decoderWithoutDeltaBases;
+
+/**
+ * Decodes the payloads of a batch of messages, such as those of one `ARTProtocolMessage`, with the same results as calling `decode:encoding:` for each of them in turn. `data` and `encodings` are parallel arrays, in which `NSNull` stands for a missing value; a payload that is `NSNull` is passed through without being decoded, and doesn't affect delta decoding.
+ *
+ * The encrypted payloads are all decrypted up front into a single buffer, concurrently if the batch is large enough, and their decoded `NSData` are views into that buffer (which stays allocated for as long as any of them does).
+ *
+ * Decoding stops after the first payload that fails with `ARTErrorUnableToDecodeMessage`, since delta decoding can't continue past it, so the result may have fewer outputs than there are payloads.
+ */
+- (NSArray<ARTDataEncoderOutput *> *)decodeBatch:(NSArray *)data encodings:(NSArray *)encodings;
+
+/**
+ * Like `decodeBatch:encodings:`, with the id of each message, which a later delta may refer to, and the id of the message that each delta is relative to (its `extras.delta.from`), in parallel arrays in which `NSNull` stands for a missing value.
+ *
+ * A delta that is relative to a message other than the last one decoded is applied to that message's payload if it is still in `deltaBaseCache`.
+ */
+- (NSArray<ARTDataEncoderOutput *> *)decodeBatch:(NSArray *)data encodings:(NSArray *)encodings identifiers:(nullable NSArray *)identifiers deltaBaseIds:(nullable NSArray *)deltaBaseIds;
+
+/// The delta bases left by the most recently decoded messages that had an id.
+@property (readonly, nonatomic) ARTDeltaBaseCache *deltaBaseCache;
+
+/// Forgets the base of the last decoded message and every base in `deltaBaseCache`, so that a delta can then only be decoded against a message decoded after this call. For when the messages that follow can't be relied on to continue from those decoded so far, such as after a detach or a non-resumed attach.
+- (void)removeAllDeltaBases;
+
 @end
 
 @interface NSString (ARTDataEncoder)
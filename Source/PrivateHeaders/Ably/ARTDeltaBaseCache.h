@@ -0,0 +1,37 @@
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ A bounded, least-recently-used cache of the payloads that recent messages left as the delta base (RTL19d, RTL19e), keyed by message id. It lets `ARTDataEncoder` decode a delta whose `extras.delta.from` isn't the very last message, for example on a channel on which several message names are published, instead of having to reattach (RTL18). Safe to use from any thread.
+ */
+@interface ARTDeltaBaseCache : NSObject
+
+- (instancetype)initWithCapacity:(NSUInteger)capacity;
+- (instancetype)init NS_UNAVAILABLE;
+
+/// The maximum number of bases kept; once it is reached, the least recently used base is evicted.
+@property (readonly, nonatomic) NSUInteger capacity;
+
+/// The number of bases currently kept.
+@property (readonly) NSUInteger count;
+
+/// The number of calls to `baseForId:` that found a base.
+@property (readonly) NSUInteger hitCount;
+
+/// The number of calls to `baseForId:` that didn't find a base.
+@property (readonly) NSUInteger missCount;
+
+- (void)setBase:(NSData *)base forId:(NSString *)identifier;
+
+/// Returns the base left by the message with the given id, if it is still cached, and counts the lookup as a hit or a miss.
+- (nullable NSData *)baseForId:(NSString *)identifier;
+
+/// Like `baseForId:`, but neither affects the base's recency nor counts as a lookup.
+- (BOOL)containsBaseForId:(NSString *)identifier;
+
+- (void)removeAllBases;
+
+@end
+
+NS_ASSUME_NONNULL_END
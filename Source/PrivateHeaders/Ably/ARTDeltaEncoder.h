@@ -0,0 +1,41 @@
+#import <Foundation/Foundation.h>
+
+@class ARTMessage;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ Turns the messages published on a channel into vcdiff deltas against the previous message published on it, so that a publisher that repeatedly sends slowly-changing payloads uses less upstream bandwidth (see `ARTRealtimeChannelOptions.publishesDeltas`).
+
+ A delta message has the `vcdiff` encoding and, per RTL19/RTL20, `extras.delta.from` set to the id of the message it's a delta against, so subscribers decode it exactly like a delta generated by Ably. Messages without an id are given one, since deltas need to be able to refer to them.
+
+ Not thread-safe; must be used from the channel's queue, in publishing order.
+ */
+@interface ARTDeltaEncoder : NSObject
+
+/**
+ @param keyframeInterval Every `keyframeInterval`-th message is published in full, so that a subscriber that has missed a message can recover without having to reattach. 0 or 1 means that every message is published in full.
+ */
+- (instancetype)initWithKeyframeInterval:(NSUInteger)keyframeInterval;
+- (instancetype)init NS_UNAVAILABLE;
+
+@property (readonly, nonatomic) NSUInteger keyframeInterval;
+
+/**
+ Takes messages whose data has already been encoded by an `ARTDataEncoder` without a cipher, and returns the messages to send in their place. A message is sent as a delta only if the delta is smaller than its payload.
+ */
+- (NSArray<ARTMessage *> *)encodeMessages:(NSArray<ARTMessage *> *)messages;
+
+/**
+ Forgets the previous message, so that the next one is published in full. Used when a publish fails, since subscribers won't have received the message that later deltas would be relative to.
+ */
+- (void)reset;
+
+/**
+ Returns a VCDIFF (RFC 3284) delta that transforms `source` into `target`, using the default code table and no secondary compression.
+ */
++ (NSData *)vcdiffFromSource:(NSData *)source target:(NSData *)target;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -14,6 +14,7 @@
 @class ARTLocalDevice;
 @class ARTUpdateDeleteResult;
 @class ARTPublishResult;
+@class ARTBatchPresenceResult;
 
 @protocol ARTPushRecipient;
 
@@ -89,6 +90,9 @@ NS_ASSUME_NONNULL_BEGIN
 // PublishResult
 - (nullable ARTPublishResult *)decodePublishResult:(NSData *)data error:(NSError *_Nullable *_Nullable)error;
 
+// BatchPresenceResult
+- (nullable ARTBatchPresenceResult *)decodeBatchPresenceResult:(NSData *)data error:(NSError *_Nullable *_Nullable)error;
+
 - (nullable NSArray<ARTDeviceDetails *> *)decodeDevicesDetails:(NSData *)data error:(NSError * __autoreleasing *)error;
 - (nullable ARTDeviceIdentityTokenDetails *)decodeDeviceIdentityTokenDetails:(NSData *)data error:(NSError * __autoreleasing *)error;
 
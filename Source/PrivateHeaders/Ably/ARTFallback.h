@@ -4,6 +4,7 @@ NS_ASSUME_NONNULL_BEGIN
 
 @class ARTHttpResponse;
 @class ARTClientOptions;
+@class ARTHostStatsTracker;
 
 @interface ARTFallback : NSObject
 
@@ -11,10 +12,15 @@ NS_ASSUME_NONNULL_BEGIN
  Init with fallback hosts array.
  */
 - (instancetype)initWithFallbackHosts:(nullable NSArray<NSString *> *)fallbackHosts shuffleArray:(void (^)(NSMutableArray *))shuffleArray;
+
+/**
+ Init with fallback hosts array, which is shuffled and then ordered by the expected latency of each host according to `hostStatsTracker`, so that the fastest host is popped first.
+ */
+- (instancetype)initWithFallbackHosts:(nullable NSArray<NSString *> *)fallbackHosts shuffleArray:(void (^)(NSMutableArray *))shuffleArray hostStatsTracker:(nullable ARTHostStatsTracker *)hostStatsTracker;
 - (instancetype)init NS_UNAVAILABLE;
 
 /**
- Returns a random fallback host, returns null when all hosts have been popped.
+ Returns the next fallback host to try, returns null when all hosts have been popped.
  */
 - (nullable NSString *)popFallbackHost;
 
@@ -0,0 +1,33 @@
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ Accumulates connection reuse statistics for the HTTP requests made through an `NSURLSession`, as reported by the session's task metrics. Safe to use from any thread.
+
+ When the `NSURLSession` is shared between clients (see `ARTClientOptions.sharesHTTPSession`), so is the instance of this class, and its figures then cover all of those clients.
+ */
+@interface ARTHTTPConnectionMetrics : NSObject
+
+/// The number of requests whose metrics have been recorded.
+@property (readonly) NSUInteger requestCount;
+
+/// The number of requests that were sent over an already-open connection.
+@property (readonly) NSUInteger reusedConnectionCount;
+
+/// The number of requests that had to open a new connection (DNS, TCP and TLS).
+@property (readonly) NSUInteger openedConnectionCount;
+
+/// The number of requests that were sent using HTTP/2, and so were multiplexed with other requests to the same host.
+@property (readonly) NSUInteger http2RequestCount;
+
+/// The total time spent opening the new connections counted in `openedConnectionCount`.
+@property (readonly) NSTimeInterval totalConnectDuration;
+
+- (void)recordTransactionMetrics:(NSURLSessionTaskTransactionMetrics *)metrics API_AVAILABLE(macos(10.12), ios(10.0), tvos(10.0));
+
+- (void)reset;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,15 @@
+#import <Ably/ARTHostStats.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface ARTHostStats ()
+
+- (instancetype)initWithHost:(NSString *)host
+              averageLatency:(NSTimeInterval)averageLatency
+                   errorRate:(double)errorRate
+                 sampleCount:(NSUInteger)sampleCount
+             expectedLatency:(NSTimeInterval)expectedLatency;
+
+@end
+
+NS_ASSUME_NONNULL_END
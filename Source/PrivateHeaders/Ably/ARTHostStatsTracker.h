@@ -0,0 +1,35 @@
+#import <Foundation/Foundation.h>
+
+@class ARTHostStats;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ Keeps exponentially weighted moving averages of the latency and error rate of each host that a client talks to, both over REST and over realtime connections, and ranks hosts by the latency they can be expected to deliver. Safe to use from any thread.
+ */
+@interface ARTHostStatsTracker : NSObject
+
+/**
+ @param failurePenalty The time that a failure is assumed to cost, since it's typically detected by a timeout; a host's error rate is weighted by it when computing its expected latency.
+ */
+- (instancetype)initWithFailurePenalty:(NSTimeInterval)failurePenalty;
+- (instancetype)init NS_UNAVAILABLE;
+
+- (void)recordSuccessForHost:(NSString *)host latency:(NSTimeInterval)latency;
+- (void)recordFailureForHost:(NSString *)host;
+
+/**
+ Returns `hosts` in increasing order of expected latency. A host without statistics is expected to perform like the average known host. Hosts that are expected to perform equally keep their relative order, so shuffling `hosts` beforehand still spreads the load between them.
+ */
+- (NSArray<NSString *> *)rankHosts:(NSArray<NSString *> *)hosts;
+
+/**
+ Returns the statistics of `hosts`, in the order of `rankHosts:`.
+ */
+- (NSArray<ARTHostStats *> *)statsForHosts:(NSArray<NSString *> *)hosts;
+
+- (void)reset;
+
+@end
+
+NS_ASSUME_NONNULL_END
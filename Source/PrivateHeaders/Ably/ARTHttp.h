@@ -5,6 +5,7 @@
 @class ARTErrorInfo;
 @class ARTClientOptions;
 @class ARTInternalLog;
+@class ARTHTTPConnectionMetrics;
 
 @protocol ARTEncoder;
 
@@ -24,6 +25,20 @@ NS_ASSUME_NONNULL_BEGIN
 - (instancetype)init UNAVAILABLE_ATTRIBUTE;
 - (instancetype)initWithQueue:(dispatch_queue_t)queue logger:(ARTInternalLog *)logger;
 
+/**
+ Honours `options.maxConcurrentHTTPRequests` and `options.sharesHTTPSession`. Must be used with a serial `queue`, on which `executeRequest:completion:` must also be called.
+ */
+- (instancetype)initWithQueue:(dispatch_queue_t)queue options:(nullable ARTClientOptions *)options logger:(ARTInternalLog *)logger;
+
+/// The number of requests that have been handed to the URL session and have not yet completed.
+@property (readonly, nonatomic) NSUInteger inFlightRequestCount;
+
+/// The number of requests waiting for an in-flight request to complete, because `maxConcurrentHTTPRequests` has been reached.
+@property (readonly, nonatomic) NSUInteger pendingRequestCount;
+
+/// Connection reuse statistics of the underlying URL session, or `nil` if the configured URL session class doesn't collect them.
+@property (nullable, readonly, nonatomic) ARTHTTPConnectionMetrics *connectionMetrics;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -7,6 +7,7 @@
 
 @class ARTPublishResult;
 @class ARTPublishResultSerial;
+@class ARTBatchPresenceResult;
 @protocol ARTTimeProvider;
 
 NS_ASSUME_NONNULL_BEGIN
@@ -70,6 +71,8 @@ NS_ASSUME_NONNULL_BEGIN
 - (NSDictionary *)publishResultToDictionary:(ARTPublishResult *)publishResult;
 - (NSArray *)publishResultsToArray:(NSArray<ARTPublishResult *> *)publishResults;
 
+- (nullable ARTBatchPresenceResult *)batchPresenceResultFromDictionary:(NSDictionary *)input;
+
 - (nullable NSArray *)statsFromArray:(NSArray *)input;
 - (nullable ARTStats *)statsFromDictionary:(NSDictionary *)input;
 - (nullable ARTStatsMessageTypes *)statsMessageTypesFromDictionary:(NSDictionary *)input;
@@ -8,6 +8,8 @@ NS_ASSUME_NONNULL_BEGIN
 extern NSString *const ARTDeviceIdKey;
 extern NSString *const ARTDeviceSecretKey;
 extern NSString *const ARTDeviceIdentityTokenKey;
+/// The key under which the identity token details are persisted by `ARTPushPersistenceCodec`; `ARTDeviceIdentityTokenKey` holds an `NSKeyedArchiver` archive of them, for older SDK versions.
+extern NSString *const ARTDeviceCompactIdentityTokenKey;
 extern NSString *const ARTAPNSDeviceTokenKey;
 extern NSString *const ARTClientIdKey;
 
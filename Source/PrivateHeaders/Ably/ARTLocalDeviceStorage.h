@@ -2,6 +2,8 @@
 #import "ARTDeviceStorage.h"
 
 @class ARTInternalLog;
+@class ARTAtomicFileStorage;
+@protocol ARTTimeProvider;
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -24,7 +26,8 @@ typedef NSString * _Nullable (^ARTLegacyKeychainSecretReader)(NSString *deviceId
 /// Writes are atomic: every persisted value lives in the same file and is
 /// written with a write-to-temp-and-rename, so it is impossible for, e.g., a
 /// `deviceIdentityToken` to be paired with a `deviceId` that it does not
-/// belong to.
+/// belong to. By default each mutation (or outermost batch) is written
+/// immediately; see `enableWriteBehindWithInterval:timeProvider:`.
 ///
 /// On first init, data persisted by older SDK versions (in `NSUserDefaults`
 /// and the keychain) is migrated into the new file (old entries are preserved just in case).
@@ -53,6 +56,24 @@ typedef NSString * _Nullable (^ARTLegacyKeychainSecretReader)(NSString *deviceId
 /// Returns the directory used by `+newWithLogger:logValues:`.
 + (NSURL *)defaultBaseDirectoryURL;
 
+/// Switches to write-behind: instead of rewriting the file on every mutation
+/// (or outermost batch), mutations made within `interval` of the first
+/// unwritten one are written together, with a single atomic write on a
+/// background queue. Reads always see the latest values. Pending mutations are
+/// also written by `flush`, when the app enters the background or terminates
+/// (on iOS), and when the storage is deallocated; a crash before then loses
+/// them, but never leaves the file with only some of them. An `interval` of 0
+/// writes any pending mutations and switches back to writing them immediately.
+- (void)enableWriteBehindWithInterval:(NSTimeInterval)interval timeProvider:(id<ARTTimeProvider>)timeProvider;
+
+@property (readonly) NSTimeInterval writeBehindInterval;
+
+/// Synchronously writes any mutations that write-behind hasn't written yet.
+- (void)flush;
+
+/// The file that the storage is persisted to.
+@property (readonly) ARTAtomicFileStorage *fileStorage;
+
 @end
 
 NS_ASSUME_NONNULL_END
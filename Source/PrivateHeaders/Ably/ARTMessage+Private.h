@@ -13,6 +13,9 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property (nonatomic) BOOL actionIsInternallySet;
 
+/// The id of the message that this message's vcdiff-encoded `data` is relative to (its `extras.delta.from`), or `nil` if it isn't a delta.
+- (nullable NSString *)deltaBaseId;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -16,6 +16,8 @@ NS_ASSUME_NONNULL_BEGIN
 
 typedef NSArray<ItemType> *_Nullable(^ARTPaginatedResultResponseProcessor)(NSHTTPURLResponse *_Nullable, NSData *_Nullable, NSError *_Nullable *_Nullable);
 
+@property (nonatomic, readonly) ARTPaginatedResultResponseProcessor responseProcessor;
+
 - (instancetype)initWithItems:(NSArray *)items
                          rest:(ARTRestInternal *)rest
                      relFirst:(NSMutableURLRequest *)relFirst
@@ -32,6 +34,17 @@ typedef NSArray<ItemType> *_Nullable(^ARTPaginatedResultResponseProcessor)(NSHTT
                   logger:(ARTInternalLog *)logger
                 callback:(void (^)(ARTPaginatedResult<ItemType> *_Nullable result, ARTErrorInfo *_Nullable error))callback;
 
+/**
+ Like `executePaginated:withRequest:andResponseProcessor:wrapperSDKAgents:logger:callback:`, but runs `responseProcessor` on `decodeQueue`, if given, instead of on the client's internal queue. `callback` is still called on the internal queue.
+ */
++ (void)executePaginated:(ARTRestInternal *)rest
+             withRequest:(NSMutableURLRequest *)request
+    andResponseProcessor:(ARTPaginatedResultResponseProcessor)responseProcessor
+        wrapperSDKAgents:(nullable NSStringDictionary *)wrapperSDKAgents
+             decodeQueue:(nullable dispatch_queue_t)decodeQueue
+                  logger:(ARTInternalLog *)logger
+                callback:(void (^)(ARTPaginatedResult<ItemType> *_Nullable result, ARTErrorInfo *_Nullable error))callback;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -0,0 +1,14 @@
+#import <Ably/ARTPaginatedResultIterator.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface ARTPaginatedResultIterator<ItemType> ()
+
+- (instancetype)initWithPage:(ARTPaginatedResult<ItemType> *)page prefetchDepth:(NSUInteger)prefetchDepth;
+
+/// The number of pages that have been fetched and are waiting to be returned by `next:`. Must be read on the client's internal queue.
+@property (nonatomic, readonly) NSUInteger bufferedPageCount_nosync;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -8,6 +8,9 @@ NS_ASSUME_NONNULL_BEGIN
 
 extern NSString *const ARTPushActivationCurrentStateKey;
 extern NSString *const ARTPushActivationPendingEventsKey;
+/// The keys under which the state and pending events are persisted by `ARTPushPersistenceCodec`; the keys above hold `NSKeyedArchiver` archives of the same values, for older SDK versions.
+extern NSString *const ARTPushActivationCompactCurrentStateKey;
+extern NSString *const ARTPushActivationCompactPendingEventsKey;
 
 @interface ARTPushActivationStateMachine ()
 
@@ -0,0 +1,80 @@
+#import <Foundation/Foundation.h>
+
+@class ARTPushActivationState;
+@class ARTPushActivationStateMachine;
+@class ARTPushActivationEvent;
+@class ARTDeviceIdentityTokenDetails;
+@class ARTInternalLog;
+@protocol ARTDeviceStorage;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// The version of the format written by `ARTPushPersistenceCodec`.
+extern const uint8_t ARTPushPersistenceCodecVersion;
+
+/// The key under which `writesLegacyArchivesToStorage:` persists the end of the window during which the archives are written too.
+extern NSString *const ARTPushPersistenceLegacyArchivesUntilKey;
+
+/**
+ Encodes the push activation state, the pending activation events and the device identity token details that are persisted in `ARTDeviceStorage` in a compact, versioned binary format, which is much quicker to load than the `NSKeyedArchiver` archives that older SDK versions persisted.
+
+ The decoding methods also accept those archives, so that data persisted by older SDK versions is read transparently and written in the new format the next time it is persisted. Each encoded value starts with a header that identifies the format, its version, and the kind of value.
+
+ The compact form is persisted under a key of its own. So that an app can still be downgraded to one of those versions without losing its push registration, for 90 days after the first persist the archive is persisted too, under the key that those versions read (see `writesLegacyArchivesToStorage:`). After that, the archives are removed as each value is next persisted.
+
+ An error event is persisted with its code, status code, message and request ID only.
+ */
+@interface ARTPushPersistenceCodec : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/// Whether `data` was written by this codec, as opposed to being an `NSKeyedArchiver` archive.
++ (BOOL)isEncodedData:(NSData *)data;
+
+/// Returns `nil` if `state` isn't one of the states that the state machine persists.
++ (nullable NSData *)dataWithState:(ARTPushActivationState *)state;
+
+/// Returns `nil` if any of the `events` is of an unknown class.
++ (nullable NSData *)dataWithEvents:(NSArray<ARTPushActivationEvent *> *)events;
+
++ (NSData *)dataWithIdentityTokenDetails:(ARTDeviceIdentityTokenDetails *)identityTokenDetails;
+
+/// Returns `nil`, after logging the reason, if `data` can't be decoded.
++ (nullable ARTPushActivationState *)stateWithData:(NSData *)data
+                                           machine:(ARTPushActivationStateMachine *)machine
+                                            logger:(nullable ARTInternalLog *)logger;
+
+/// Returns `nil`, after logging the reason, if `data` can't be decoded.
++ (nullable NSMutableArray<ARTPushActivationEvent *> *)eventsWithData:(NSData *)data
+                                                               logger:(nullable ARTInternalLog *)logger;
+
+/**
+ Whether the `NSKeyedArchiver` archives are still to be persisted alongside the compact data, for SDK versions that predate this codec. The first call starts the window during which they are; pass `nil` as the archive to `setCompactData:archive:forKey:legacyKey:storage:` once it has closed.
+ */
++ (BOOL)writesLegacyArchivesToStorage:(id<ARTDeviceStorage>)storage;
+
+/**
+ Persists `compactData` under `key`, and `archive`, an `NSKeyedArchiver` archive of the same value, under `legacyKey`, from which SDK versions that predate this codec read it. Either being `nil` removes its key, and `compactData` being `nil` removes both.
+ */
++ (void)setCompactData:(nullable NSData *)compactData
+               archive:(nullable NSData *)archive
+                forKey:(NSString *)key
+             legacyKey:(NSString *)legacyKey
+               storage:(id<ARTDeviceStorage>)storage;
+
+/**
+ Returns the compact data under `key`, or if there is none, the data under `legacyKey`, which an SDK version that predates this codec persisted. The decoding methods accept either.
+
+ Once there is compact data, what an older SDK version persists under `legacyKey` after a downgrade isn't read; an upgrade again continues from the state that this version last persisted.
+ */
++ (nullable NSData *)dataForKey:(NSString *)key
+                      legacyKey:(NSString *)legacyKey
+                        storage:(id<ARTDeviceStorage>)storage;
+
+/// Returns `nil`, after logging the reason, if `data` can't be decoded.
++ (nullable ARTDeviceIdentityTokenDetails *)identityTokenDetailsWithData:(NSData *)data
+                                                                  logger:(nullable ARTInternalLog *)logger;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -11,6 +11,7 @@
 @class ARTAuthInternal;
 @protocol ARTContinuousClockInstant;
 @protocol ARTTimeProvider;
+@class ARTHostStatsTracker;
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -50,6 +51,10 @@ NS_ASSUME_NONNULL_BEGIN
 
 @property (nonatomic, readonly) id<ARTTimeProvider> timeProvider;
 
+/// Latency and error statistics of the hosts this client talks to, shared with the realtime client that owns this instance, if any.
+@property (nonatomic, readonly) ARTHostStatsTracker *hostStatsTracker;
+@property (readonly) NSArray<ARTHostStats *> *fallbackHostRanking;
+
 /**
  Provides access to the instance's logger. As the name says, this property should only be used in the following cases:
 
@@ -117,6 +122,14 @@ wrapperSDKAgents:(nullable NSStringDictionary *)wrapperSDKAgents
      callback:(ARTPaginatedStatsCallback)callback
         error:(NSError *_Nullable *_Nullable)errorPtr;
 
+- (BOOL)batchPresence:(NSArray<NSString *> *)channels
+     wrapperSDKAgents:(nullable NSStringDictionary *)wrapperSDKAgents
+             callback:(ARTBatchPresenceCallback)callback
+                error:(NSError *_Nullable *_Nullable)errorPtr;
+
+- (void)prewarmConnectionsWithWrapperSDKAgents:(nullable NSStringDictionary *)wrapperSDKAgents
+                                    completion:(nullable ARTCallback)callback;
+
 @end
 
 @interface ARTRest ()
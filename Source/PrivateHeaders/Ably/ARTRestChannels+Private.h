@@ -19,6 +19,10 @@ NS_ASSUME_NONNULL_BEGIN
 - (BOOL)exists:(NSString *)name;
 - (void)release:(NSString *)name;
 
+// Must be called on the rest's queue. Unlike `get:`, never creates the channel.
+- (nullable ARTRestChannelInternal *)_getIfExists:(NSString *)name;
+- (NSString *)_addPrefix:(NSString *)name;
+
 @end
 
 @interface ARTRestChannels ()
@@ -0,0 +1,38 @@
+#import <Foundation/Foundation.h>
+#import <Ably/ARTTypes.h>
+
+@class ARTTokenDetails;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ The process-wide cache of tokens shared by the clients created with `ARTClientOptions.sharesTokens`, so that clients with the same credentials don't each request a token of their own. Safe to use from any thread.
+
+ Entries are keyed by a string that identifies the auth configuration, clientId and token params that a token was requested with; see `-[ARTAuthInternal sharedTokenCacheKeyForParams:options:]`.
+ */
+@interface ARTSharedTokenCache : NSObject
+
++ (instancetype)sharedCache;
+
+/**
+ Calls `callback` on `queue` with the token cached under `key`, if there is one for which `isValid` returns `YES` and that isn't `currentToken` (which the caller wants to replace). Otherwise, if another caller is already fetching a token for `key`, waits for that token; if not, calls `fetch` to get one, then caches it and passes it to every caller waiting for it.
+
+ @param isValid Whether a cached token can still be used. Called synchronously, on the calling thread; the caller judges expiry by its own clock, adjusted to the server's time.
+ @param fetch Called synchronously, on the calling thread, at most once. Must call the callback that it is given exactly once, even if the fetch fails.
+ @return Cancelling it stops `callback` from being called, but doesn't stop a fetch that other callers may be waiting for.
+ */
+- (NSObject<ARTCancellable> *)tokenForKey:(NSString *)key
+                                replacing:(nullable NSString *)currentToken
+                                  isValid:(BOOL (^)(ARTTokenDetails *tokenDetails))isValid
+                                    queue:(dispatch_queue_t)queue
+                                    fetch:(void (^)(ARTTokenDetailsCallback callback))fetch
+                                 callback:(ARTTokenDetailsCallback)callback;
+
+/// Removes `token` from the cache, for example because Ably has rejected it.
+- (void)invalidateToken:(NSString *)token;
+
+- (void)removeAllTokens;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,27 @@
+#import <Foundation/Foundation.h>
+
+@class ARTTokenParams;
+@class ARTTokenRequest;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ Signs token requests with an API key, like `-[ARTTokenParams sign:]`, but decomposes the key and derives the HMAC-SHA256 key pads only once, when it is created, and then builds each signature without formatting the whole text to sign. Immutable, so safe to use from any thread.
+ */
+@interface ARTTokenRequestSigner : NSObject
+
+/// Returns `nil` if `key` isn't of the form `keyName:keySecret`.
+- (nullable instancetype)initWithKey:(NSString *)key;
+- (instancetype)init NS_UNAVAILABLE;
+
+@property (readonly, nonatomic) NSString *key;
+@property (readonly, nonatomic) NSString *keyName;
+
+/// Signs `tokenParams` as they are, with their `timestamp` and, if they have one, `nonce`; otherwise, with a new nonce.
+- (ARTTokenRequest *)signTokenParams:(ARTTokenParams *)tokenParams;
+
+- (ARTTokenRequest *)signTokenParams:(ARTTokenParams *)tokenParams nonce:(NSString *)nonce;
+
+@end
+
+NS_ASSUME_NONNULL_END
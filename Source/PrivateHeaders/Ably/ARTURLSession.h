@@ -1,5 +1,7 @@
 #import <Foundation/Foundation.h>
 
+@class ARTHTTPConnectionMetrics;
+
 NS_ASSUME_NONNULL_BEGIN
 
 @protocol ARTURLSession <NSObject>
@@ -12,6 +14,15 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (void)finishTasksAndInvalidate;
 
+@optional
+
+/**
+ If `sharingSession` is `true`, requests go through a single `NSURLSession` that is shared by every instance created this way in the process, so that they can reuse (and, with HTTP/2, multiplex over) each other's connections. `finishTasksAndInvalidate` then only gives up this instance's use of the shared session, which is invalidated once every instance using it has done so.
+ */
+- (instancetype)init:(dispatch_queue_t)queue sharingSession:(BOOL)sharingSession;
+
+@property (readonly) ARTHTTPConnectionMetrics *connectionMetrics;
+
 @end
 
 NS_ASSUME_NONNULL_END
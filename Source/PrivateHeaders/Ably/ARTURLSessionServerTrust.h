@@ -7,6 +7,17 @@ NS_ASSUME_NONNULL_BEGIN
 
 @interface ARTURLSessionServerTrust : NSObject<NSURLSessionDelegate, NSURLSessionTaskDelegate, ARTURLSession>
 
+- (instancetype)init:(dispatch_queue_t)queue;
+- (instancetype)init:(dispatch_queue_t)queue sharingSession:(BOOL)sharingSession;
+
+@property (readonly) ARTHTTPConnectionMetrics *connectionMetrics;
+
+/// The session that requests go through; for an instance created with `sharingSession`, the shared one.
+@property (readonly) NSURLSession *session;
+
+/// The number of instances created with `sharingSession` that haven't yet called `finishTasksAndInvalidate`. The shared session is invalidated when this drops to zero.
+@property (class, readonly) NSUInteger sharedSessionBorrowerCount;
+
 @end
 
 NS_ASSUME_NONNULL_END
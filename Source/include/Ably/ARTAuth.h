@@ -91,6 +91,16 @@ NS_ASSUME_NONNULL_BEGIN
 NS_SWIFT_SENDABLE
 @interface ARTAuth : NSObject <ARTAuthProtocol>
 
+/**
+ * Creates and signs an Ably `ARTTokenRequest` like `-[ARTAuthProtocol createTokenRequest:options:callback:]` does with the client library stored `ARTAuthOptions`, but synchronously, so that a server can mint many of them per second. It never queries Ably for the time; the timestamp is taken from the local clock, adjusted by the offset to Ably's clock if that has already been obtained (for example, by an earlier `createTokenRequest:options:callback:` with `queryTime` set). The key material is prepared once and reused for every signature. Safe to call from any thread, including from within the client's callbacks.
+ *
+ * @param tokenParams An `ARTTokenParams` object. When `nil`, the default token parameters are used.
+ * @param error If the token request can't be created, an `ARTErrorInfo` describing why: `ARTErrorInvalidCredentials` if the client has no API `key`, or `ARTErrorInvalidRequestBody` if the token parameters' `capability` isn't valid JSON.
+ *
+ * @return The signed `ARTTokenRequest`, or `nil` on error.
+ */
+- (nullable ARTTokenRequest *)createTokenRequestSynchronously:(nullable ARTTokenParams *)tokenParams error:(NSError *_Nullable *_Nullable)error;
+
 @end
 
 NS_ASSUME_NONNULL_END
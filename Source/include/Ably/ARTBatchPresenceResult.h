@@ -0,0 +1,88 @@
+#import <Foundation/Foundation.h>
+
+@class ARTPresenceMessage;
+@class ARTErrorInfo;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Contains the presence members of a single channel that was successfully queried as part of a batch presence request.
+ */
+NS_SWIFT_SENDABLE
+@interface ARTBatchPresenceSuccessResult : NSObject
+
+/**
+ * The name of the channel.
+ */
+@property (readonly, nonatomic) NSString *channel;
+
+/**
+ * The members present on the channel.
+ */
+@property (readonly, nonatomic) NSArray<ARTPresenceMessage *> *presence;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/// :nodoc:
+- (instancetype)initWithChannel:(NSString *)channel presence:(NSArray<ARTPresenceMessage *> *)presence;
+
+@end
+
+/**
+ * Describes why a single channel could not be queried as part of a batch presence request.
+ */
+NS_SWIFT_SENDABLE
+@interface ARTBatchPresenceFailureResult : NSObject
+
+/**
+ * The name of the channel.
+ */
+@property (readonly, nonatomic) NSString *channel;
+
+/**
+ * Describes the reason the presence of this channel could not be retrieved.
+ */
+@property (readonly, nonatomic) ARTErrorInfo *error;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/// :nodoc:
+- (instancetype)initWithChannel:(NSString *)channel error:(ARTErrorInfo *)error;
+
+@end
+
+/**
+ * Contains the result of a batch presence request, made through `-[ARTRestProtocol batchPresence:callback:error:]`. A batch request may partially succeed, so the per-channel outcomes are reported separately.
+ */
+NS_SWIFT_SENDABLE
+@interface ARTBatchPresenceResult : NSObject
+
+/**
+ * The number of channels whose presence was successfully retrieved.
+ */
+@property (readonly, nonatomic) NSUInteger successCount;
+
+/**
+ * The number of channels whose presence could not be retrieved.
+ */
+@property (readonly, nonatomic) NSUInteger failureCount;
+
+/**
+ * The presence members of each channel that was successfully queried.
+ */
+@property (readonly, nonatomic) NSArray<ARTBatchPresenceSuccessResult *> *successes;
+
+/**
+ * The error of each channel that could not be queried.
+ */
+@property (readonly, nonatomic) NSArray<ARTBatchPresenceFailureResult *> *failures;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/// :nodoc:
+- (instancetype)initWithSuccesses:(NSArray<ARTBatchPresenceSuccessResult *> *)successes
+                         failures:(NSArray<ARTBatchPresenceFailureResult *> *)failures;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -137,11 +137,46 @@ extern const ARTPluginName ARTPluginNameLiveObjects;
  */
 @property (readwrite, nonatomic) NSTimeInterval httpMaxRetryDuration;
 
+/**
+ * When greater than zero, enables hedged REST requests: if the host has not responded to an idempotent request within this time, the same request is also sent to the next fallback host, the first response wins and the other requests are cancelled. Set it to about the 95th percentile of your request latency, so that only the slowest requests are duplicated. Reads are always idempotent; other requests are only hedged when `addRequestIds` is `true`, so that Ably can recognise the duplicates by their request ID. The default is `0`, which disables hedging.
+ */
+@property (readwrite, nonatomic) NSTimeInterval httpHedgingDelay;
+
 /**
  * An array of fallback hosts to be used in the case of an error necessitating the use of an alternative host. If you have been provided a set of custom fallback hosts by Ably, please specify them here.
  */
 @property (nullable, nonatomic, copy) NSArray<NSString *> *fallbackHosts;
 
+/**
+ * The maximum number of REST requests that a client sends to Ably at the same time; further requests are queued until one completes. Useful to avoid opening more parallel connections than needed, since requests to the same host over HTTP/2 are multiplexed on a single connection. The default is `0`, which means no limit.
+ */
+@property (readwrite, nonatomic) NSUInteger maxConcurrentHTTPRequests;
+
+/**
+ * When `true`, the client's REST requests share a single process-wide HTTP session with all other clients created with this option, so that they reuse each other's open (and prewarmed) connections instead of each opening its own. The default is `false`.
+ */
+@property (readwrite, nonatomic) BOOL sharesHTTPSession;
+
+/**
+ * When `true`, the client shares the tokens that it obtains with all other clients in the process created with this option and the same auth configuration (the same `key`, the same `authUrl` and auth request parameters, or an `authCallback` and the same `sharedTokenCacheIdentity`), `clientId` and `defaultTokenParams`. Clients that need a token at the same time then wait for a single token request instead of each making their own, and a client that needs a token while another client has a valid one is given that one. A token that Ably rejects is no longer shared. The default is `false`.
+ */
+@property (readwrite, nonatomic) BOOL sharesTokens;
+
+/**
+ * When `sharesTokens` is `true` and the client authenticates with an `authCallback`, identifies the identity that the callback obtains tokens for. The client only shares tokens with other clients that set the same `sharedTokenCacheIdentity`, and doesn't share tokens at all if it's `nil`, since the SDK can't tell whether two callbacks obtain tokens for the same identity. Ignored for clients that authenticate with a `key` or an `authUrl`. The default is `nil`.
+ */
+@property (nullable, readwrite, nonatomic, copy) NSString *sharedTokenCacheIdentity;
+
+/**
+ * When greater than zero, the changes to the locally persisted push device details and activation state that are made within this interval of each other are written to disk together, in the background, instead of each being written immediately. Reduces disk writes when push activation makes many changes in a row, for example on launch. Pending changes are written when the app enters the background or terminates; those made shortly before a crash may be lost, in which case the push activation state is recovered as after any other interruption. The default is `0`, which writes every change immediately.
+ */
+@property (readwrite, nonatomic) NSTimeInterval localDeviceStorageWriteBehindInterval;
+
+/**
+ * When greater than zero (and less than `1`), and the client is able to renew its token (it has an `authCallback`, `authUrl` or `key`), the client requests a new token once this fraction of the current token's lifetime has elapsed, instead of waiting for the token to be rejected. A realtime client applies the new token to its connection without disconnecting; if the renewal falls due while it isn't connected, it renews the token as soon as it connects again. For example, `0.8` renews a one-hour token after 48 minutes. The default is `0`, which disables proactive renewal.
+ */
+@property (readwrite, nonatomic) double tokenRenewalFraction;
+
 /**
  * DEPRECATED: this property is deprecated and will be removed in a future version. Enables default fallback hosts to be used.
  */
@@ -0,0 +1,40 @@
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Contains the statistics that a client has gathered about the requests and connection attempts it made to one Ably host. The client uses them to try the fallback hosts fastest first, rather than in random order.
+ */
+NS_SWIFT_SENDABLE
+@interface ARTHostStats : NSObject
+
+/**
+ * The host name.
+ */
+@property (readonly, nonatomic) NSString *host;
+
+/**
+ * The exponentially weighted moving average of the time taken by the successful requests and connection attempts to the host, in seconds. `0` until one has succeeded.
+ */
+@property (readonly, nonatomic) NSTimeInterval averageLatency;
+
+/**
+ * The exponentially weighted moving average of the proportion of requests and connection attempts to the host that failed in a way that called for a fallback host, between `0` and `1`.
+ */
+@property (readonly, nonatomic) double errorRate;
+
+/**
+ * The number of requests and connection attempts that the statistics are based on.
+ */
+@property (readonly, nonatomic) NSUInteger sampleCount;
+
+/**
+ * The time the client expects a request to the host to take, in seconds, accounting for the likelihood of it failing. Fallback hosts are tried in increasing order of this value.
+ */
+@property (readonly, nonatomic) NSTimeInterval expectedLatency;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -3,6 +3,8 @@
 #import <Ably/ARTTypes.h>
 #import <Ably/ARTStatus.h>
 
+@class ARTPaginatedResultIterator<ItemType>;
+
 NS_ASSUME_NONNULL_BEGIN
 
 /**
@@ -43,6 +45,15 @@ NS_SWIFT_SENDABLE
  */
 - (void)next:(void (^)(ARTPaginatedResult<ItemType> *_Nullable result, ARTErrorInfo *_Nullable error))callback;
 
+/**
+ * Returns an iterator over this page and all the following ones, which fetches the following pages ahead of time while the current one is being processed. Useful to go through a long history without waiting for each page to be requested.
+ *
+ * @param prefetchDepth The maximum number of pages to fetch ahead; at least 1.
+ *
+ * @return An `ARTPaginatedResultIterator` object, whose first page is this one.
+ */
+- (ARTPaginatedResultIterator<ItemType> *)iteratorWithPrefetchDepth:(NSUInteger)prefetchDepth;
+
 @end
 
 NS_ASSUME_NONNULL_END
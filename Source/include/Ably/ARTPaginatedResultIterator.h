@@ -0,0 +1,40 @@
+#import <Foundation/Foundation.h>
+
+#import <Ably/ARTTypes.h>
+
+@class ARTPaginatedResult<ItemType>;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Iterates over the pages of a paginated query, such as a channel's message history, fetching the following pages in the background while the caller processes the current one. Obtained from `-[ARTPaginatedResult iteratorWithPrefetchDepth:]`.
+ *
+ * Pages are requested one after another, since each page tells where the next one is; at most `prefetchDepth` pages that have been fetched but not yet returned by `next:` are held in memory at any time. The responses are decoded on a background queue rather than on the client's internal queue.
+ */
+NS_SWIFT_SENDABLE
+@interface ARTPaginatedResultIterator<ItemType> : NSObject
+
+/**
+ * The maximum number of pages fetched ahead of the caller.
+ */
+@property (nonatomic, readonly) NSUInteger prefetchDepth;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ * Returns the next page of results: the page the iterator was created from on the first call, then each following page in turn. Returns `nil` once there are no further pages.
+ *
+ * If fetching a page fails, the error is returned in place of that page and the iteration ends.
+ *
+ * @param callback A callback for retrieving the next page as an `ARTPaginatedResult` object with an array of `ItemType` objects.
+ */
+- (void)next:(void (^)(ARTPaginatedResult<ItemType> *_Nullable page, ARTErrorInfo *_Nullable error))callback;
+
+/**
+ * Stops fetching pages and discards those already prefetched. Subsequent calls to `next:` return `nil`.
+ */
+- (void)cancel;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -21,6 +21,7 @@
 @class ARTPush;
 @class ARTProtocolMessage;
 @class ARTRealtimeChannels;
+@class ARTHostStats;
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -86,6 +87,11 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (BOOL)stats:(nullable ARTStatsQuery *)query callback:(ARTPaginatedStatsCallback)callback error:(NSError *_Nullable *_Nullable)errorPtr;
 
+/**
+ * The fallback hosts, in the order in which the client would next try them, along with the statistics that this order is based on. The statistics cover both REST requests and realtime connection attempts.
+ */
+@property (readonly) NSArray<ARTHostStats *> *fallbackHostRanking;
+
 /**
  * Calls `-[ARTConnectionProtocol connect]` and causes the connection to open, entering the connecting state. Explicitly calling `connect` is unnecessary unless the `ARTClientOptions.autoConnect` property is disabled.
  */
@@ -63,6 +63,22 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @property (nonatomic) BOOL attachOnSubscribe;
 
+/**
+ * When `true`, each message published on this channel is sent as a vcdiff delta against the previous message published on it by this client, whenever that is smaller. This reduces the upstream bandwidth used by publishers that repeatedly send large, slowly-changing payloads, such as state documents. Defaults to false; only enable it if every client that reads the channel can decode these deltas, as described below.
+ *
+ * Subscribers and history readers decode these deltas using the message that each is relative to, so they must all use a version of this SDK that supports them; other SDKs receive the deltas undecoded. The first message published after each time the channel attaches, including after a reconnection, and every `deltaKeyframeInterval`-th message after that, is published in full, as is any message after one that fails to publish.
+ *
+ * A subscriber that hasn't received the message that a delta is relative to, for example because it attached after that message was published, skips the delta, emitting an `ARTChannelEventUpdate` with the decoding error, and resumes with the next message published in full. So that it can do so, a channel that publishes deltas should not also set the `delta` channel param: a subscriber with that param set reattaches instead of skipping. In a page of history, a delta is decoded if the message that it is relative to is on the same page, and is otherwise returned undecoded.
+ *
+ * Deltas aren't used on encrypted channels. Messages published without an `id` are given one, since deltas refer to the previous message by its `id`.
+ */
+@property (nonatomic) BOOL publishesDeltas;
+
+/**
+ * When `publishesDeltas` is `true`, one in every `deltaKeyframeInterval` messages is published in full rather than as a delta. Defaults to 10.
+ */
+@property (nonatomic) NSUInteger deltaKeyframeInterval;
+
 @end
 
 NS_ASSUME_NONNULL_END
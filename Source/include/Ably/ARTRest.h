@@ -13,6 +13,7 @@
 @class ARTCancellable;
 @class ARTStatsQuery;
 @class ARTHTTPPaginatedResponse;
+@class ARTHostStats;
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -65,6 +66,31 @@ NS_ASSUME_NONNULL_BEGIN
      callback:(ARTPaginatedStatsCallback)callback
         error:(NSError *_Nullable *_Nullable)errorPtr;
 
+/**
+ * Retrieves the presence members of multiple channels in a single REST request, rather than one `-[ARTRestPresenceProtocol get:]` request per channel. The request may partially succeed: the members of each channel that could be queried are returned alongside an `ARTErrorInfo` for each channel that could not.
+ *
+ * @param channels The names of the channels to query.
+ * @param callback A callback for retrieving an `ARTBatchPresenceResult` object.
+ * @param errorPtr A reference to the `NSError` object where an error information will be saved in case of failure.
+ *
+ * @return In case of failure returns `false` and the error information can be retrived via the `error` parameter.
+ */
+- (BOOL)batchPresence:(NSArray<NSString *> *)channels
+             callback:(ARTBatchPresenceCallback)callback
+                error:(NSError *_Nullable *_Nullable)errorPtr;
+
+/**
+ * Opens connections ahead of time to the REST host and to each of the fallback hosts, by sending an unauthenticated request to each of them, so that subsequent requests (including those that fall back to another host) don't pay for DNS resolution and the TCP and TLS handshakes. Connections are kept open by the system for as long as it allows idle connections to live; combine with `ARTClientOptions.sharesHTTPSession` to let other clients reuse them.
+ *
+ * @param callback A callback called once all the hosts have responded. It receives an error only if the REST host could not be reached; failures to reach fallback hosts are ignored.
+ */
+- (void)prewarmConnections:(nullable ARTCallback)callback;
+
+/**
+ * The fallback hosts, in the order in which the client would next try them, along with the statistics that this order is based on.
+ */
+@property (readonly) NSArray<ARTHostStats *> *fallbackHostRanking;
+
 #if TARGET_OS_IOS
 /**
  * Retrieves an `ARTLocalDevice` object that represents the current state of the device as a target for push notifications.
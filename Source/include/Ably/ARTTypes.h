@@ -19,6 +19,7 @@
 @class ARTDeviceDetails;
 @class ARTUpdateDeleteResult;
 @class ARTPublishResult;
+@class ARTBatchPresenceResult;
 @protocol ARTTokenDetailsCompatible;
 
 /// :nodoc:
@@ -572,6 +573,9 @@ typedef void (^ARTEditResultCallback)(ARTUpdateDeleteResult *_Nullable result, A
 /// :nodoc:
 typedef void (^ARTPublishResultCallback)(ARTPublishResult *_Nullable result, ARTErrorInfo *_Nullable error);
 
+/// :nodoc:
+typedef void (^ARTBatchPresenceCallback)(ARTBatchPresenceResult *_Nullable result, ARTErrorInfo *_Nullable error);
+
 /**
  * :nodoc:
  *
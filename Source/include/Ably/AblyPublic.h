@@ -29,6 +29,7 @@
 #import <Ably/ARTRealtimeAnnotations.h>
 #import <Ably/ARTStats.h>
 #import <Ably/ARTPaginatedResult.h>
+#import <Ably/ARTPaginatedResultIterator.h>
 #import <Ably/ARTHTTPPaginatedResponse.h>
 #import <Ably/ARTPush.h>
 #import <Ably/ARTPushChannel.h>
@@ -52,3 +53,5 @@
 #import <Ably/ARTUpdateDeleteResult.h>
 #import <Ably/ARTPublishResult.h>
 #import <Ably/ARTPublishResultSerial.h>
+#import <Ably/ARTHostStats.h>
+#import <Ably/ARTBatchPresenceResult.h>
@@ -5,7 +5,7 @@ import Foundation
 extension InternalDefaultLiveCounter {
     var testsOnly_siteTimeserials: [String: String] {
         mutableStateMutex.withSync { mutableState in
-            mutableState.liveObjectMutableState.siteTimeserials
+            mutableState.liveObjectMutableState.siteTimeserials.dictionary
         }
     }
 
@@ -20,7 +20,7 @@ extension InternalDefaultLiveCounter {
     /// Test-only setter for `siteTimeserials`, executing on the internal queue.
     func testsOnly_setSiteTimeserials(_ siteTimeserials: [String: String]) {
         mutableStateMutex.withSync { mutableState in
-            mutableState.liveObjectMutableState.siteTimeserials = siteTimeserials
+            mutableState.liveObjectMutableState.siteTimeserials = .init(siteTimeserials)
         }
     }
 
@@ -17,7 +17,7 @@ extension InternalDefaultLiveMap {
 
     var testsOnly_siteTimeserials: [String: String] {
         mutableStateMutex.withSync { mutableState in
-            mutableState.liveObjectMutableState.siteTimeserials
+            mutableState.liveObjectMutableState.siteTimeserials.dictionary
         }
     }
 
@@ -38,7 +38,7 @@ extension InternalDefaultLiveMap {
     /// Test-only setter for `siteTimeserials`, executing on the internal queue.
     func testsOnly_setSiteTimeserials(_ siteTimeserials: [String: String]) {
         mutableStateMutex.withSync { mutableState in
-            mutableState.liveObjectMutableState.siteTimeserials = siteTimeserials
+            mutableState.liveObjectMutableState.siteTimeserials = .init(siteTimeserials)
         }
     }
 
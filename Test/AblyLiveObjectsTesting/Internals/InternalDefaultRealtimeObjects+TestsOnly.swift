@@ -67,6 +67,12 @@ extension InternalDefaultRealtimeObjects {
         }
     }
 
+    var testsOnly_isGarbageCollectionInProgress: Bool {
+        mutableStateMutex.withSync { mutableState in
+            mutableState.isGarbageCollectionInProgress
+        }
+    }
+
     var testsOnly_onChannelAttachedHasObjects: Bool? {
         mutableStateMutex.withSync { mutableState in
             mutableState.onChannelAttachedHasObjects
@@ -11,7 +11,7 @@ extension LiveObjectMutableState {
         testsOnly_tombstonedAt tombstonedAt: Date? = nil,
     ) {
         self.init(objectID: objectID)
-        self.siteTimeserials = siteTimeserials
+        self.siteTimeserials = .init(siteTimeserials)
         self.tombstonedAt = tombstonedAt
     }
 }
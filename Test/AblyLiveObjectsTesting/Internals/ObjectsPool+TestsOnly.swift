@@ -26,5 +26,6 @@ extension ObjectsPool {
     /// Test-only setter that inserts or replaces an entry for the given object ID.
     mutating func testsOnly_setEntry(_ entry: Entry, forObjectID objectID: String) {
         entries[objectID] = entry
+        trackForGarbageCollection(objectID: objectID)
     }
 }
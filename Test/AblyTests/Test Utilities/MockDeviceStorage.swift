@@ -8,7 +8,7 @@ class MockDeviceStorage: NSObject, ARTDeviceStorage {
     var keysRead: [String] = []
     var keysWritten: [String: Any?] = [:]
 
-    private var simulateData: [String: Data] = [:]
+    private var simulateData: [String: Any] = [:]
     private var simulateString: [String: String] = [:]
 
     init(startWith state: ARTPushActivationState? = nil) {
@@ -58,6 +58,12 @@ class MockDeviceStorage: NSObject, ARTDeviceStorage {
         }
     }
 
+    func simulateOnNextRead(object value: Any, `for` key: String) {
+        accessQueue.sync {
+            simulateData[key] = value
+        }
+    }
+
     func simulateOnNextRead(string value: String, `for` key: String) {
         accessQueue.sync {
             simulateString[key] = value
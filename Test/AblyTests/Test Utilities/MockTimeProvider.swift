@@ -0,0 +1,118 @@
+import Ably
+import Foundation
+
+/// A `TimeProvider` whose clocks only move when the test calls `advance(by:)`, for tests of time-dependent behaviour that shouldn't wait for real time to pass.
+///
+/// The wall clock starts at the real time at which the provider is created, so that tokens and other values from the server are still current. The blocks that the SDK schedules only fire from `advance(by:)`.
+final class MockTimeProvider: NSObject, TimeProvider, @unchecked Sendable {
+    private let lock = NSLock()
+    private var wallClock = Date()
+    private var continuousClock: TimeInterval = 0
+    private var scheduledBlocks: [ScheduledBlock] = []
+    private var queues: [ObjectIdentifier: DispatchQueue] = [:]
+
+    private final class ScheduledBlock {
+        let fireAt: TimeInterval
+        let queue: DispatchQueue
+        let block: @Sendable () -> Void
+
+        init(fireAt: TimeInterval, queue: DispatchQueue, block: @escaping @Sendable () -> Void) {
+            self.fireAt = fireAt
+            self.queue = queue
+            self.block = block
+        }
+    }
+
+    private final class Handle: NSObject, SchedulerHandle {
+        private weak var owner: MockTimeProvider?
+        private let scheduled: ScheduledBlock
+
+        init(owner: MockTimeProvider, scheduled: ScheduledBlock) {
+            self.owner = owner
+            self.scheduled = scheduled
+        }
+
+        func cancel() {
+            owner?.cancel(scheduled)
+        }
+    }
+
+    private final class Instant: NSObject, ContinuousClockInstant, @unchecked Sendable {
+        let seconds: TimeInterval
+
+        init(seconds: TimeInterval) {
+            self.seconds = seconds
+        }
+
+        func isAfter(_ other: ContinuousClockInstant) -> Bool {
+            seconds > (other as? Instant)?.seconds ?? .infinity
+        }
+
+        func addingDuration(_ duration: TimeInterval) -> ContinuousClockInstant {
+            Instant(seconds: seconds + max(0, duration))
+        }
+
+        func timeIntervalSince(_ other: ContinuousClockInstant) -> TimeInterval {
+            seconds - ((other as? Instant)?.seconds ?? seconds)
+        }
+    }
+
+    private func withLock<T>(_ body: () -> T) -> T {
+        lock.lock()
+        defer { lock.unlock() }
+        return body()
+    }
+
+    func wallClockNow() -> Date {
+        withLock { wallClock }
+    }
+
+    func continuousClockNow() -> ContinuousClockInstant {
+        withLock { Instant(seconds: continuousClock) }
+    }
+
+    func schedule(after delay: TimeInterval, queue: DispatchQueue, block: @escaping @Sendable () -> Void) -> SchedulerHandle {
+        withLock {
+            queues[ObjectIdentifier(queue)] = queue
+            let scheduled = ScheduledBlock(fireAt: continuousClock + max(0, delay), queue: queue, block: block)
+            scheduledBlocks.append(scheduled)
+            return Handle(owner: self, scheduled: scheduled)
+        }
+    }
+
+    private func cancel(_ scheduled: ScheduledBlock) {
+        withLock {
+            scheduledBlocks.removeAll { $0 === scheduled }
+        }
+    }
+
+    /// Advances both clocks by `interval`, and runs the blocks that have fallen due, in order, along with any work that they queue on the queues that blocks have been scheduled on.
+    func advance(by interval: TimeInterval) {
+        drainQueues()
+        let now = withLock { () -> TimeInterval in
+            continuousClock += interval
+            wallClock = wallClock.addingTimeInterval(interval)
+            return continuousClock
+        }
+        while true {
+            let due = withLock { () -> [ScheduledBlock] in
+                let due = scheduledBlocks.filter { $0.fireAt <= now }.sorted { $0.fireAt < $1.fireAt }
+                scheduledBlocks.removeAll { scheduled in due.contains { $0 === scheduled } }
+                return due
+            }
+            if due.isEmpty {
+                return
+            }
+            for scheduled in due {
+                scheduled.queue.async(execute: scheduled.block)
+            }
+            drainQueues()
+        }
+    }
+
+    private func drainQueues() {
+        for queue in withLock({ Array(queues.values) }) {
+            queue.sync {}
+        }
+    }
+}
@@ -49,6 +49,9 @@ let appSetupModel: TestAppSetup = {
 }()
 
 let testTimeout = DispatchTimeInterval.seconds(20)
+
+/// Whether to run the tests that measure the performance of a large workload. They are long-running, so they only run when the `ABLY_RUN_BENCHMARKS` environment variable is set.
+let isBenchmarkingEnabled = ProcessInfo.processInfo.environment["ABLY_RUN_BENCHMARKS"] != nil
 let testResourcesPath = "ably-common/test-resources/"
 let echoServerAddress = "https://echo.ably.io/createJWT"
 
@@ -1131,6 +1134,58 @@ class MockHTTPExecutor: NSObject, ARTHTTPExecutor {
 
 }
 
+/// An `ARTURLSession` that sends nothing, and holds on to each request until the test completes it. Install it with `ARTHttp.setURLSessionClass(_:)`; it must be used from the `ARTHttp`'s queue.
+class MockURLSession: NSObject, ARTURLSession {
+
+    class Task: NSObject, ARTCancellable {
+        let request: URLRequest
+        fileprivate let callback: (HTTPURLResponse?, Data?, Error?) -> Void
+        private(set) var isCancelled = false
+
+        fileprivate init(request: URLRequest, callback: @escaping (HTTPURLResponse?, Data?, Error?) -> Void) {
+            self.request = request
+            self.callback = callback
+        }
+
+        func cancel() {
+            isCancelled = true
+        }
+    }
+
+    /// The most recently created instance.
+    private(set) static weak var last: MockURLSession?
+
+    let queue: DispatchQueue
+    /// The requests that have been started, in order, including completed ones.
+    private(set) var tasks: [Task] = []
+
+    required init(_ queue: DispatchQueue) {
+        self.queue = queue
+        super.init()
+        MockURLSession.last = self
+    }
+
+    func get(_ request: URLRequest, completion callback: @escaping (HTTPURLResponse?, Data?, Error?) -> Void) -> NSObject & ARTCancellable {
+        let task = Task(request: request, callback: callback)
+        tasks.append(task)
+        return task
+    }
+
+    func finishTasksAndInvalidate() {
+    }
+
+    /// Completes `task` successfully with an empty body.
+    func complete(_ task: Task) {
+        task.callback(HTTPURLResponse(url: task.request.url!, statusCode: 200, httpVersion: nil, headerFields: nil), nil, nil)
+    }
+
+    /// Completes `task` with `response`, and `data` as its body.
+    func complete(_ task: Task, response: HTTPURLResponse?, data: Data?) {
+        task.callback(response, data, nil)
+    }
+
+}
+
 /// Records each request and response for test purpose.
 class TestProxyHTTPExecutor: NSObject, ARTHTTPExecutor {
 
@@ -4507,4 +4507,370 @@ class AuthTests: XCTestCase {
         XCTAssertEqual(tokenDetails.clientId, originalTokenRequest.clientId)
         XCTAssertNotNil(tokenDetails.token)
     }
+
+    func test__003__proactive_token_renewal__renews_the_token_once_the_configured_fraction_of_its_lifetime_has_elapsed() throws {
+        let test = Test()
+        let options = try AblyTests.clientOptions(for: test)
+        let timeProvider = MockTimeProvider()
+        options.testOptions.timeProvider = timeProvider
+        options.tokenRenewalFraction = 0.5
+        var authCallbackCount = 0
+        options.authCallback = { _, callback in
+            authCallbackCount += 1
+            let now = timeProvider.wallClockNow()
+            callback(ARTTokenDetails(token: "token-\(authCallbackCount)", expires: now.addingTimeInterval(3600), issued: now, capability: nil, clientId: nil), nil)
+        }
+        let rest = ARTRest(options: options)
+
+        waitUntil(timeout: testTimeout) { done in
+            rest.auth.authorize { tokenDetails, error in
+                XCTAssertNil(error)
+                XCTAssertEqual(tokenDetails?.token, "token-1")
+                done()
+            }
+        }
+        XCTAssertNotNil(rest.internal.auth.tokenRenewalDeadline)
+
+        timeProvider.advance(by: 1799)
+        XCTAssertEqual(authCallbackCount, 1)
+
+        // Renewed half way through the token's lifetime
+        timeProvider.advance(by: 1)
+        expect(rest.auth.tokenDetails?.token).toEventually(equal("token-2"), timeout: testTimeout)
+        XCTAssertEqual(authCallbackCount, 2)
+    }
+
+    func test__004__proactive_token_renewal__concurrent_renewals_share_one_token_request() throws {
+        let test = Test()
+        let options = try AblyTests.clientOptions(for: test)
+        var authCallbackCount = 0
+        options.authCallback = { _, callback in
+            authCallbackCount += 1
+            let now = Date()
+            callback(ARTTokenDetails(token: "token-\(authCallbackCount)", expires: now.addingTimeInterval(3600), issued: now, capability: nil, clientId: nil), nil)
+        }
+        let rest = ARTRest(options: options)
+        // Disabled by default
+        XCTAssertNil(rest.internal.auth.tokenRenewalDeadline)
+
+        var tokens: [String?] = []
+        waitUntil(timeout: testTimeout) { done in
+            let partialDone = AblyTests.splitDone(3, done: done)
+            rest.internal.queue.async {
+                for _ in 0 ..< 3 {
+                    rest.internal.auth._renewToken { tokenDetails, error in
+                        XCTAssertNil(error)
+                        tokens.append(tokenDetails?.token)
+                        partialDone()
+                    }
+                }
+            }
+        }
+
+        XCTAssertEqual(authCallbackCount, 1)
+        XCTAssertEqual(tokens, ["token-1", "token-1", "token-1"])
+    }
+
+    // RTC8a
+    func test__005__proactive_token_renewal__a_connected_realtime_client_renews_in_band_with_an_AUTH_message() throws {
+        let test = Test()
+        let options = try AblyTests.commonAppSetup(for: test)
+        options.autoConnect = false
+        options.useTokenAuth = true
+        let tokenParams = ARTTokenParams()
+        tokenParams.ttl = 60
+        options.defaultTokenParams = tokenParams
+        // Due after three seconds, well within the connection's idle interval
+        options.tokenRenewalFraction = 0.05
+        let timeProvider = MockTimeProvider()
+        options.testOptions.timeProvider = timeProvider
+        options.testOptions.transportFactory = TestProxyTransportFactory()
+        let client = ARTRealtime(options: options)
+        defer { client.dispose(); client.close() }
+
+        waitUntil(timeout: testTimeout) { done in
+            client.connection.once(.connected) { stateChange in
+                XCTAssertNil(stateChange.reason)
+                done()
+            }
+            client.connect()
+        }
+        let firstToken = try XCTUnwrap(client.auth.tokenDetails?.token)
+        let connectionId = client.connection.id
+        let transport = try XCTUnwrap(client.internal.transport as? TestProxyTransport)
+
+        XCTAssertTrue(transport.protocolMessagesSent.filter { $0.action == .auth }.isEmpty)
+
+        // Renewed on the same connection
+        timeProvider.advance(by: 3)
+        expect(transport.protocolMessagesSent.filter { $0.action == .auth }).toEventually(haveCount(1), timeout: testTimeout)
+        expect(client.auth.tokenDetails?.token).toEventuallyNot(equal(firstToken), timeout: testTimeout)
+        let authMessage = try XCTUnwrap(transport.protocolMessagesSent.first { $0.action == .auth })
+        XCTAssertEqual(authMessage.auth?.accessToken, client.auth.tokenDetails?.token)
+        XCTAssertEqual(client.connection.state, .connected)
+        XCTAssertEqual(client.connection.id, connectionId)
+    }
+
+    // A renewal that falls due while the client isn't connected is made as soon as it connects again, with the token that it connected with.
+    func test__006__proactive_token_renewal__a_renewal_deferred_while_not_connected_is_made_once_connected() throws {
+        let test = Test()
+        let options = try AblyTests.commonAppSetup(for: test)
+        options.autoConnect = false
+        options.useTokenAuth = true
+        let tokenParams = ARTTokenParams()
+        tokenParams.ttl = 60
+        options.defaultTokenParams = tokenParams
+        options.tokenRenewalFraction = 0.05
+        let timeProvider = MockTimeProvider()
+        options.testOptions.timeProvider = timeProvider
+        options.testOptions.transportFactory = TestProxyTransportFactory()
+        let client = ARTRealtime(options: options)
+        defer { client.dispose(); client.close() }
+
+        waitUntil(timeout: testTimeout) { done in
+            client.connection.once(.connected) { _ in
+                done()
+            }
+            client.connect()
+        }
+        let firstToken = try XCTUnwrap(client.auth.tokenDetails?.token)
+
+        waitUntil(timeout: testTimeout) { done in
+            client.connection.once(.closed) { _ in
+                done()
+            }
+            client.close()
+        }
+
+        // Falls due while the client is closed
+        timeProvider.advance(by: 3)
+        XCTAssertTrue(client.internal.auth.tokenRenewalDeferred)
+        XCTAssertEqual(client.auth.tokenDetails?.token, firstToken)
+
+        waitUntil(timeout: testTimeout) { done in
+            client.connection.once(.connected) { _ in
+                done()
+            }
+            client.connect()
+        }
+        let transport = try XCTUnwrap(client.internal.transport as? TestProxyTransport)
+
+        expect(transport.protocolMessagesSent.filter { $0.action == .auth }).toEventually(haveCount(1), timeout: testTimeout)
+        expect(client.auth.tokenDetails?.token).toEventuallyNot(equal(firstToken), timeout: testTimeout)
+        XCTAssertFalse(client.internal.auth.tokenRenewalDeferred)
+        XCTAssertEqual(client.connection.state, .connected)
+    }
+
+    func test__007__shared_tokens__clients_with_the_same_credentials_share_token_requests_and_tokens() throws {
+        let test = Test()
+        let options = try AblyTests.clientOptions(for: test)
+        options.sharesTokens = true
+        options.sharedTokenCacheIdentity = UUID().uuidString
+        var authCallbackCount = 0
+        options.authCallback = { _, callback in
+            authCallbackCount += 1
+            let token = "token-\(authCallbackCount)"
+            // Slow enough for both clients to be waiting at the same time
+            DispatchQueue.main.asyncAfter(deadline: .now() + 0.2) {
+                let now = Date()
+                callback(ARTTokenDetails(token: token, expires: now.addingTimeInterval(3600), issued: now, capability: nil, clientId: nil), nil)
+            }
+        }
+        // A copy has the same authCallback block
+        let rest1 = ARTRest(options: options)
+        let rest2 = ARTRest(options: options.copy() as! ARTClientOptions)
+
+        func authorize(_ rest: ARTRest, done: @escaping () -> Void) {
+            rest.auth.authorize { _, error in
+                XCTAssertNil(error)
+                done()
+            }
+        }
+
+        waitUntil(timeout: testTimeout) { done in
+            let partialDone = AblyTests.splitDone(2, done: done)
+            authorize(rest1, done: partialDone)
+            authorize(rest2, done: partialDone)
+        }
+        XCTAssertEqual(authCallbackCount, 1)
+        XCTAssertEqual(rest1.auth.tokenDetails?.token, "token-1")
+        XCTAssertEqual(rest2.auth.tokenDetails?.token, "token-1")
+
+        // Once rejected, the token is no longer shared, and a client renewing its token gets a new one
+        rest1.internal.auth.invalidateSharedToken()
+        waitUntil(timeout: testTimeout) { done in
+            authorize(rest1, done: done)
+        }
+        XCTAssertEqual(authCallbackCount, 2)
+        XCTAssertEqual(rest1.auth.tokenDetails?.token, "token-2")
+
+        // ...which the other client is then given instead of its own
+        waitUntil(timeout: testTimeout) { done in
+            authorize(rest2, done: done)
+        }
+        XCTAssertEqual(authCallbackCount, 2)
+        XCTAssertEqual(rest2.auth.tokenDetails?.token, "token-2")
+    }
+
+    func test__008__shared_tokens__clients_with_an_authCallback_share_tokens_only_under_a_cache_identity() throws {
+        let test = Test()
+        let options = try AblyTests.clientOptions(for: test)
+        options.sharesTokens = true
+        var authCallbackCount = 0
+        options.authCallback = { _, callback in
+            authCallbackCount += 1
+            let now = Date()
+            callback(ARTTokenDetails(token: "token-\(authCallbackCount)", expires: now.addingTimeInterval(3600), issued: now, capability: nil, clientId: nil), nil)
+        }
+        let rest1 = ARTRest(options: options)
+        let rest2 = ARTRest(options: options.copy() as! ARTClientOptions)
+        XCTAssertNil(rest1.internal.auth.sharedTokenCacheKey(forParams: ARTTokenParams(), options: options))
+
+        for rest in [rest1, rest2] {
+            waitUntil(timeout: testTimeout) { done in
+                rest.auth.authorize { _, error in
+                    XCTAssertNil(error)
+                    done()
+                }
+            }
+        }
+        // Without a sharedTokenCacheIdentity, each client gets its own token
+        XCTAssertEqual(authCallbackCount, 2)
+        XCTAssertEqual(rest1.auth.tokenDetails?.token, "token-1")
+        XCTAssertEqual(rest2.auth.tokenDetails?.token, "token-2")
+    }
+
+    func test__009__shared_tokens__the_cache_key_is_canonical_for_auth_headers_and_params() throws {
+        let test = Test()
+        let rest = ARTRest(options: try AblyTests.clientOptions(for: test))
+        func key(headers: [String: String], params: [URLQueryItem]) -> String? {
+            let options = ARTAuthOptions()
+            options.authUrl = URL(string: "https://auth.example.com/token")
+            options.authHeaders = headers
+            options.authParams = params
+            return rest.internal.auth.sharedTokenCacheKey(forParams: ARTTokenParams(), options: options)
+        }
+        let a = URLQueryItem(name: "a", value: "1")
+        let b = URLQueryItem(name: "b", value: "2")
+
+        XCTAssertEqual(key(headers: ["x": "1", "y": "2"], params: [a, b]), key(headers: ["y": "2", "x": "1"], params: [b, a]))
+        XCTAssertNotEqual(key(headers: [:], params: [a, b]), key(headers: [:], params: [a]))
+        // Separators in names and values can't make different parameters look the same
+        XCTAssertNotEqual(key(headers: ["x": "1&y=2"], params: []), key(headers: ["x": "1", "y": "2"], params: []))
+        XCTAssertNotEqual(key(headers: [:], params: [URLQueryItem(name: "a", value: "1&b=2")]), key(headers: [:], params: [a, b]))
+    }
+
+    func test__010__shared_tokens__a_cached_token_that_has_expired_by_the_server_time_is_not_shared() throws {
+        let test = Test()
+        let options = try AblyTests.clientOptions(for: test)
+        options.sharesTokens = true
+        options.sharedTokenCacheIdentity = UUID().uuidString
+        var authCallbackCount = 0
+        options.authCallback = { _, callback in
+            authCallbackCount += 1
+            let now = Date()
+            callback(ARTTokenDetails(token: "token-\(authCallbackCount)", expires: now.addingTimeInterval(3600), issued: now, capability: nil, clientId: nil), nil)
+        }
+        let rest1 = ARTRest(options: options)
+        let rest2 = ARTRest(options: options.copy() as! ARTClientOptions)
+        // By the server's time, as rest2 knows it, tokens that expire within the next two hours have already expired
+        rest2.internal.auth.setTimeOffset(2 * 60 * 60)
+
+        for rest in [rest1, rest2] {
+            waitUntil(timeout: testTimeout) { done in
+                rest.auth.authorize { _, error in
+                    XCTAssertNil(error)
+                    done()
+                }
+            }
+        }
+        XCTAssertEqual(authCallbackCount, 2)
+        XCTAssertEqual(rest1.auth.tokenDetails?.token, "token-1")
+        XCTAssertEqual(rest2.auth.tokenDetails?.token, "token-2")
+    }
+
+    func test__011__token_request_signer__signs_like_token_params() throws {
+        let key = "appId.keyId:a secret that is longer than the 64-byte HMAC block size, so that it is hashed first"
+        for signingKey in [key, "appId.keyId:secret"] {
+            let signer = try XCTUnwrap(ARTTokenRequestSigner(key: signingKey))
+            for capability in [nil, "{\"*\":[\"*\"]}", "{\"\(String(repeating: "channël-", count: 60))\":[\"subscribe\"]}"] {
+                for (clientId, ttl) in [(nil, nil), ("client ✓", 3600 as NSNumber)] {
+                    let params = ARTTokenParams(clientId: clientId)
+                    params.capability = capability
+                    params.ttl = ttl
+                    params.timestamp = Date(timeIntervalSince1970: 1_700_000_000.123)
+
+                    let expected = params.sign(signingKey, withNonce: "1234567890123456")
+                    let signed = signer.signTokenParams(params, nonce: "1234567890123456")
+                    XCTAssertEqual(signed.mac, expected.mac)
+                    XCTAssertEqual(signed.keyName, expected.keyName)
+                }
+            }
+        }
+        XCTAssertNil(ARTTokenRequestSigner(key: "no secret"))
+    }
+
+    func test__012__createTokenRequestSynchronously__signs_with_the_client_key() throws {
+        let test = Test()
+        let options = try AblyTests.commonAppSetup(for: test)
+        let rest = ARTRest(options: options)
+
+        let tokenRequest = try rest.auth.createTokenRequestSynchronously(nil)
+        XCTAssertEqual(tokenRequest.keyName, options.key?.components(separatedBy: ":").first)
+        XCTAssertNotNil(tokenRequest.timestamp)
+
+        // The token request is one that Ably accepts
+        waitUntil(timeout: testTimeout) { done in
+            tokenRequest.toTokenDetails(rest.auth) { tokenDetails, error in
+                XCTAssertNil(error)
+                XCTAssertNotNil(tokenDetails?.token)
+                done()
+            }
+        }
+
+        let tokenOptions = try AblyTests.clientOptions(for: test)
+        tokenOptions.token = "token"
+        XCTAssertThrowsError(try ARTRest(options: tokenOptions).auth.createTokenRequestSynchronously(nil)) { error in
+            XCTAssertEqual((error as? ARTErrorInfo)?.code, ARTErrorCode.invalidCredentials.intValue)
+        }
+
+        let invalidCapability = ARTTokenParams()
+        invalidCapability.capability = "{"
+        XCTAssertThrowsError(try rest.auth.createTokenRequestSynchronously(invalidCapability)) { error in
+            XCTAssertEqual((error as? ARTErrorInfo)?.code, ARTErrorCode.invalidRequestBody.intValue)
+        }
+    }
+
+    // Benchmark; only run when benchmarking is enabled.
+    func test__013__createTokenRequestSynchronously__throughput() throws {
+        try XCTSkipUnless(isBenchmarkingEnabled, "Set ABLY_RUN_BENCHMARKS to run benchmarks")
+
+        let rest = ARTRest(options: ARTClientOptions(key: "appId.keyId:secret"))
+        let params = ARTTokenParams(clientId: "client")
+        params.capability = "{\"channel\":[\"publish\",\"subscribe\"]}"
+        params.ttl = 3600
+
+        var failures = 0
+        measure {
+            for _ in 0 ..< 10_000 {
+                if (try? rest.auth.createTokenRequestSynchronously(params))?.mac == nil {
+                    failures += 1
+                }
+            }
+        }
+        XCTAssertEqual(failures, 0)
+    }
+
+    func test__014__createTokenRequestSynchronously__can_be_called_on_the_internal_queue() throws {
+        let test = Test()
+        let options = try AblyTests.clientOptions(for: test)
+        options.key = "appId.keyId:secret"
+        let rest = ARTRest(options: options)
+
+        var tokenRequest: ARTTokenRequest?
+        rest.internal.queue.sync {
+            tokenRequest = try? rest.auth.createTokenRequestSynchronously(nil)
+        }
+        XCTAssertEqual(tokenRequest?.keyName, "appId.keyId")
+    }
 }
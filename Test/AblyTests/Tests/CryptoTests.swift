@@ -129,6 +129,171 @@ class CryptoTests: XCTestCase {
         XCTAssertEqual(distinctOutputs.count, 3)
     }
 
+    func test__017__Crypto__cipher__reuses_its_context_across_messages_of_different_sizes() {
+        let params = ARTCipherParams(algorithm: "aes", key: key as ARTCipherKeyCompatible)
+        let cipher = ARTCrypto.cipher(with: params, logger: InternalLog(core: MockInternalLogCore()))
+
+        var ivs = Set<Data>()
+        for length in [0, 1, 15, 16, 17, 100, 1024, 65536] {
+            let data = Data((0 ..< length).map { UInt8(truncatingIfNeeded: $0) })
+
+            var encrypted: NSData?
+            XCTAssertEqual(cipher.encrypt(data, output: &encrypted).state, .ok)
+            ivs.insert(encrypted!.subdata(with: NSMakeRange(0, 16)))
+
+            var decrypted: NSData?
+            XCTAssertEqual(cipher.decrypt(encrypted! as Data, output: &decrypted).state, .ok)
+            XCTAssertEqual(decrypted! as Data, data)
+
+            // A failed decryption must not leave state behind that affects the next message
+            var ignored: NSData?
+            XCTAssertNotEqual(cipher.decrypt(encrypted!.subdata(with: NSMakeRange(0, encrypted!.length - 1)), output: &ignored).state, .ok)
+        }
+
+        // More messages than fit in one batch of pre-generated IVs, each with a distinct IV
+        for _ in 0 ..< 100 {
+            var encrypted: NSData?
+            cipher.encrypt(Data("data".utf8), output: &encrypted)
+            ivs.insert(encrypted!.subdata(with: NSMakeRange(0, 16)))
+        }
+        XCTAssertEqual(ivs.count, 108)
+    }
+
+    // Throughput benchmarks; each iteration encrypts and then decrypts 1000 messages of the given size. Only run when benchmarking is enabled.
+
+    private func measureEncryptDecryptThroughput(messageLength: Int) throws {
+        try XCTSkipUnless(isBenchmarkingEnabled, "Set ABLY_RUN_BENCHMARKS to run benchmarks")
+
+        let params = ARTCipherParams(algorithm: "aes", key: longKey as ARTCipherKeyCompatible)
+        let cipher = ARTCrypto.cipher(with: params, logger: InternalLog(core: MockInternalLogCore()))
+        let data = Data(repeating: 0x61, count: messageLength)
+
+        var roundTripFailures = 0
+        measure {
+            for _ in 0 ..< 1000 {
+                var encrypted: NSData?
+                var decrypted: NSData?
+                if cipher.encrypt(data, output: &encrypted).state != .ok
+                    || cipher.decrypt(encrypted! as Data, output: &decrypted).state != .ok
+                    || decrypted as Data? != data {
+                    roundTripFailures += 1
+                }
+            }
+        }
+        XCTAssertEqual(roundTripFailures, 0)
+    }
+
+    func test__018__Crypto__throughput__100_byte_messages() throws {
+        try measureEncryptDecryptThroughput(messageLength: 100)
+    }
+
+    func test__019__Crypto__throughput__1_KB_messages() throws {
+        try measureEncryptDecryptThroughput(messageLength: 1024)
+    }
+
+    func test__020__Crypto__throughput__64_KB_messages() throws {
+        try measureEncryptDecryptThroughput(messageLength: 64 * 1024)
+    }
+
+    func test__021__Crypto__decodeBatch__decodes_like_decoding_one_by_one() {
+        let logger = InternalLog(core: MockInternalLogCore())
+        let cipherParams = ARTCipherParams(algorithm: "aes", key: key as ARTCipherKeyCompatible)
+        let encoder = ARTDataEncoder(cipherParams: cipherParams, logger: logger, error: nil)
+
+        // Large enough in total to be decrypted concurrently
+        var payloads: [Any] = []
+        var encodings: [Any] = []
+        for i in 0 ..< 40 {
+            let data: Any
+            switch i % 3 {
+            case 0: data = String(repeating: "a", count: i * 100)
+            case 1: data = ["index": i, "text": String(repeating: "b", count: i * 50)]
+            default: data = Data(repeating: UInt8(i), count: i * 200)
+            }
+            let encoded = encoder.encode(data)
+            XCTAssertNil(encoded.errorInfo)
+            payloads.append(encoded.data!)
+            encodings.append(encoded.encoding!)
+        }
+        // A message without data, one that isn't encrypted, and one whose ciphertext is corrupt
+        payloads.append(NSNull())
+        encodings.append(NSNull())
+        payloads.append("plain")
+        encodings.append("utf-8")
+        payloads.append(Data(repeating: 1, count: 17).base64EncodedString())
+        encodings.append("utf-8/cipher+aes-128-cbc/base64")
+
+        let outputs = encoder.decodeBatch(payloads, encodings: encodings)
+        XCTAssertEqual(outputs.count, payloads.count)
+
+        for (index, output) in outputs.enumerated() {
+            if payloads[index] is NSNull {
+                XCTAssertNil(output.data)
+                continue
+            }
+            let expected = encoder.decode(payloads[index], encoding: encodings[index] as? String)
+            XCTAssertEqual(output.data as? NSObject, expected.data as? NSObject)
+            XCTAssertEqual(output.encoding, expected.encoding)
+            XCTAssertEqual(output.errorInfo?.code, expected.errorInfo?.code)
+            XCTAssertEqual(output.errorInfo?.message, expected.errorInfo?.message)
+        }
+        XCTAssertNotNil(outputs.last?.errorInfo)
+    }
+
+    // Each message's decryption error reaches its output, whether the batch is decrypted concurrently or not.
+    func test__024__Crypto__decodeBatch__reports_each_payloads_decryption_error() {
+        let logger = InternalLog(core: MockInternalLogCore())
+        let cipherParams = ARTCipherParams(algorithm: "aes", key: key as ARTCipherKeyCompatible)
+        let encoder = ARTDataEncoder(cipherParams: cipherParams, logger: logger, error: nil)
+        let encoding = "utf-8/cipher+aes-128-cbc/base64"
+
+        for validCount in [1, 40] {
+            let valid = encoder.encode(String(repeating: "a", count: 2000))
+            var payloads: [Any] = Array(repeating: valid.data!, count: validCount)
+            var encodings: [Any] = Array(repeating: valid.encoding!, count: validCount)
+            // Too short to hold an IV, and not a whole number of blocks
+            payloads.append(Data(repeating: 1, count: 8).base64EncodedString())
+            encodings.append(encoding)
+            payloads.append(Data(repeating: 1, count: 17).base64EncodedString())
+            encodings.append(encoding)
+
+            let outputs = encoder.decodeBatch(payloads, encodings: encodings)
+            XCTAssertEqual(outputs.count, payloads.count)
+            for output in outputs.prefix(validCount) {
+                XCTAssertNil(output.errorInfo)
+            }
+
+            let tooShort = outputs[validCount].errorInfo
+            XCTAssertEqual(tooShort?.code, ARTErrorCode.invalidMessageDataOrEncoding.intValue)
+            XCTAssertEqual(tooShort?.message, "decrypt failed: ciphertext is shorter than the IV")
+            XCTAssertEqual(tooShort?.message, encoder.decode(payloads[validCount], encoding: encoding).errorInfo?.message)
+            let misaligned = outputs[validCount + 1].errorInfo
+            XCTAssertEqual(misaligned?.code, ARTErrorCode.invalidMessageDataOrEncoding.intValue)
+            XCTAssertTrue(misaligned?.message.hasPrefix("decrypt failed: ") ?? false)
+            XCTAssertEqual(misaligned?.message, encoder.decode(payloads[validCount + 1], encoding: encoding).errorInfo?.message)
+        }
+    }
+
+    func test__022__Crypto__decode__rejects_a_cipher_encoding_that_does_not_match_the_channel_cipher() throws {
+        let logger = InternalLog(core: MockInternalLogCore())
+        let encoder = try XCTUnwrap(ARTDataEncoder(cipherParams: ARTCrypto.getDefaultParams(["key": key]), logger: logger, error: nil))
+        let longKeyEncoder = try XCTUnwrap(ARTDataEncoder(cipherParams: ARTCipherParams(algorithm: "aes", key: longKey as ARTCipherKeyCompatible), logger: logger, error: nil))
+
+        let encoded = encoder.encode("foo")
+        XCTAssertEqual(encoded.encoding, "utf-8/cipher+aes-128-cbc/base64")
+        XCTAssertEqual(encoder.decode(encoded.data, encoding: encoded.encoding).data as? String, "foo")
+
+        // Another key length, or another mode, is never decrypted with a cipher other than the channel's own
+        for encoding in ["utf-8/cipher+aes-128-cbc/base64", "utf-8/cipher+aes-256-gcm/base64"] {
+            let decoded = longKeyEncoder.decode(encoded.data, encoding: encoding)
+            XCTAssertEqual(decoded.errorInfo?.code, ARTErrorCode.invalidMessageDataOrEncoding.intValue)
+            XCTAssertNil(decoded.data as? String)
+        }
+        let forged = encoder.decode(encoded.data, encoding: "utf-8/cipher+aes-128-gcm/base64")
+        XCTAssertEqual(forged.errorInfo?.code, ARTErrorCode.invalidMessageDataOrEncoding.intValue)
+        XCTAssertEqual(forged.encoding, "utf-8/cipher+aes-128-gcm")
+    }
+
     enum TestCase_ReusableTestsTestFixture {
         case should_encrypt_messages_as_expected_in_the_fixtures
         case should_decrypt_messages_as_expected_in_the_fixtures
@@ -1,4 +1,5 @@
 import Ably
+import Ably.Private
 import AblyDeltaCodec
 import Nimble
 import XCTest
@@ -251,4 +252,346 @@ class DeltaCodecTests: XCTestCase {
 
         expect(receivedMessages).toEventually(haveCount(testData.count))
     }
+
+    func test__004__DeltaCodec__encoding__produces_vcdiff_that_the_decoder_applies() throws {
+        let source = Data((0 ..< 5000).map { UInt8(truncatingIfNeeded: $0 * 7) })
+        var target = source
+        target.replaceSubrange(100 ..< 110, with: Data(repeating: 0xff, count: 3))
+        target.append(contentsOf: [1, 2, 3])
+        target.insert(contentsOf: Data(repeating: 0xee, count: 40), at: 2000)
+
+        for (base, expected) in [(source, target), (source, Data()), (Data(), target), (Data("short".utf8), Data("shorter".utf8))] {
+            let delta = ARTDeltaEncoder.vcdiff(fromSource: base, target: expected)
+            let codec = ARTDeltaCodec()
+            codec.setBase(base, withId: "base")
+            let decoded = try codec.applyDelta(delta, deltaId: "delta", baseId: "base")
+            XCTAssertEqual(decoded, expected)
+        }
+
+        XCTAssertLessThan(ARTDeltaEncoder.vcdiff(fromSource: source, target: target).count, 200)
+    }
+
+    // Publishes a sequence of payloads through the same steps as ARTRealtimeChannel and decodes them as a subscriber would.
+    func test__005__DeltaCodec__encoding__published_deltas_decode_to_the_original_messages() throws {
+        let logger = InternalLog(core: MockInternalLogCore())
+        let publisherEncoder = ARTDataEncoder(cipherParams: nil, logger: logger, error: nil)
+        let subscriberEncoder = ARTDataEncoder(cipherParams: nil, logger: logger, error: nil)
+        let deltaEncoder = ARTDeltaEncoder(keyframeInterval: 3)
+
+        var state = Dictionary(uniqueKeysWithValues: (0 ..< 50).map { ("key\($0)", "value \($0)") })
+        var payloads: [Any?] = []
+        for i in 0 ..< 4 {
+            state["key\(i)"] = "changed \(i)"
+            payloads.append(state as NSDictionary)
+        }
+        let text = String(repeating: "The quick brown fox jumps over the lazy dog. ", count: 20)
+        payloads.append(text)
+        payloads.append(text + "!")
+        payloads.append(nil)
+        payloads.append(Data(text.utf8))
+        payloads.append(Data((text + "?").utf8))
+
+        var previousId: String?
+        var deltaCount = 0
+        for payload in payloads {
+            var error: NSError?
+            let encoded = ARTMessage(name: nil, data: payload as Any).encode(with: publisherEncoder, error: &error) as! ARTMessage
+            XCTAssertNil(error)
+
+            let published = try XCTUnwrap(deltaEncoder.encodeMessages([encoded]).first)
+            XCTAssertNotNil(published.id)
+            if let encoding = published.encoding, encoding.contains("vcdiff") {
+                deltaCount += 1
+                let extras = try XCTUnwrap(published.extras?.toJSON())
+                XCTAssertEqual((extras["delta"] as? [String: String])?["from"], previousId)
+            }
+            previousId = published.id
+
+            guard published.data != nil else {
+                continue
+            }
+            let decoded = published.decode(with: subscriberEncoder, error: &error) as! ARTMessage
+            XCTAssertNil(error)
+            XCTAssertEqual(decoded.data as? NSObject, payload as? NSObject)
+        }
+
+        // One in three is a keyframe, and the change from a dictionary to a string payload isn't worth a delta
+        XCTAssertEqual(deltaCount, 4)
+    }
+
+    // Two interleaved streams of deltas, each relative to the previous message of the same stream rather than to the last message
+    func test__006__DeltaCodec__decoding__decodes_deltas_relative_to_earlier_messages_from_the_base_cache() throws {
+        let logger = InternalLog(core: MockInternalLogCore())
+        let encoder = ARTDataEncoder(cipherParams: nil, logger: logger, error: nil)
+
+        let streams = ["a", "b"].map { name in
+            (0 ..< 4).map { i in Data(String(repeating: "\(name) payload \(i) ", count: 30).utf8) }
+        }
+        var payloads: [Any] = []
+        var encodings: [Any] = []
+        var identifiers: [Any] = []
+        var deltaBaseIds: [Any] = []
+        var expected: [Data] = []
+        for i in 0 ..< 4 {
+            for (s, stream) in streams.enumerated() {
+                identifiers.append("\(s):\(i)")
+                expected.append(stream[i])
+                if i == 0 {
+                    payloads.append(stream[i].base64EncodedString())
+                    encodings.append("base64")
+                    deltaBaseIds.append(NSNull())
+                } else {
+                    payloads.append(ARTDeltaEncoder.vcdiff(fromSource: stream[i - 1], target: stream[i]).base64EncodedString())
+                    encodings.append("vcdiff/base64")
+                    deltaBaseIds.append("\(s):\(i - 1)")
+                }
+            }
+        }
+
+        let outputs = encoder.decodeBatch(payloads, encodings: encodings, identifiers: identifiers, deltaBaseIds: deltaBaseIds)
+        XCTAssertEqual(outputs.count, expected.count)
+        for (output, data) in zip(outputs, expected) {
+            XCTAssertNil(output.errorInfo)
+            XCTAssertEqual(output.data as? Data, data)
+        }
+        // A message of the other stream always comes in between, so every delta's base comes from the cache
+        XCTAssertEqual(encoder.deltaBaseCache.hitCount, 6)
+        XCTAssertEqual(encoder.deltaBaseCache.missCount, 0)
+
+        let unknownBase = encoder.decodeBatch(
+            [ARTDeltaEncoder.vcdiff(fromSource: streams[0][0], target: streams[0][1]).base64EncodedString()],
+            encodings: ["vcdiff/base64"], identifiers: ["0:4"], deltaBaseIds: ["0:-1"]
+        )
+        XCTAssertEqual(unknownBase.first?.errorInfo?.code, ARTErrorCode.unableToDecodeMessage.intValue)
+        XCTAssertEqual(encoder.deltaBaseCache.missCount, 1)
+    }
+
+    // Publishes each payload once the previous one has been published, named after its index in `deltaPayloads`.
+    private func publishSequentially(_ channel: ARTRealtimeChannel, _ payloads: ArraySlice<String>, done: @escaping () -> Void) {
+        guard let index = payloads.indices.first else {
+            done(); return
+        }
+        channel.publish(String(index), data: payloads[index]) { error in
+            XCTAssertNil(error)
+            self.publishSequentially(channel, payloads.dropFirst(), done: done)
+        }
+    }
+
+    private func deltaPublisherChannelOptions(keyframeInterval: UInt) -> ARTRealtimeChannelOptions {
+        let channelOptions = ARTRealtimeChannelOptions()
+        channelOptions.publishesDeltas = true
+        channelOptions.deltaKeyframeInterval = keyframeInterval
+        return channelOptions
+    }
+
+    private let deltaPayloads = (0 ..< 7).map { i in String(repeating: "The quick brown fox jumps over the lazy dog. ", count: 20) + String(i) }
+
+    // A subscriber that attaches after a publisher that publishes deltas has started skips the deltas that it has no base for, without reattaching, and decodes the messages from the next keyframe on.
+    func test__007__DeltaCodec__publishing__a_late_subscriber_skips_deltas_until_the_next_keyframe() throws {
+        let test = Test()
+        let options = try AblyTests.commonAppSetup(for: test)
+        let channelName = test.uniqueChannelName()
+
+        let publisherClient = AblyTests.newRealtime(options).client
+        defer { publisherClient.dispose(); publisherClient.close() }
+        let publisherChannel = publisherClient.channels.get(channelName, options: deltaPublisherChannelOptions(keyframeInterval: 4))
+        waitUntil(timeout: testTimeout) { done in
+            publisherChannel.attach { error in
+                XCTAssertNil(error)
+                done()
+            }
+        }
+
+        // Messages 0 (a keyframe) and 1 are published before the subscriber attaches
+        waitUntil(timeout: testTimeout) { done in
+            self.publishSequentially(publisherChannel, deltaPayloads[0 ..< 2], done: done)
+        }
+
+        let subscriberClient = AblyTests.newRealtime(options).client
+        defer { subscriberClient.dispose(); subscriberClient.close() }
+        let subscriberChannel = subscriberClient.channels.get(channelName)
+        waitUntil(timeout: testTimeout) { done in
+            subscriberChannel.attach { error in
+                XCTAssertNil(error)
+                done()
+            }
+        }
+
+        var receivedMessages: [ARTMessage] = []
+        subscriberChannel.subscribe { message in
+            receivedMessages.append(message)
+        }
+        var decodeErrors: [ARTErrorInfo] = []
+        subscriberChannel.on(.update) { stateChange in
+            if let reason = stateChange.reason {
+                decodeErrors.append(reason)
+            }
+        }
+        subscriberChannel.on(.attaching) { _ in
+            fail("Subscriber should not reattach")
+        }
+
+        // Messages 2 and 3 are deltas relative to messages that the subscriber didn't receive; 4 is a keyframe, and 5 and 6 are deltas relative to messages that it did
+        waitUntil(timeout: testTimeout) { done in
+            self.publishSequentially(publisherChannel, deltaPayloads[2...], done: done)
+        }
+
+        expect(receivedMessages.map(\.name)).toEventually(equal(["4", "5", "6"]), timeout: testTimeout)
+        XCTAssertEqual(receivedMessages.map { $0.data as? String }, Array(deltaPayloads[4...]))
+        XCTAssertEqual(decodeErrors.map(\.code), [ARTErrorCode.unableToDecodeMessage.intValue, ARTErrorCode.unableToDecodeMessage.intValue])
+        XCTAssertEqual(subscriberChannel.state, .attached)
+    }
+
+    func test__008__DeltaCodec__publishing__publishes_a_keyframe_after_each_attach() throws {
+        let test = Test()
+        let options = try AblyTests.commonAppSetup(for: test)
+        let client = AblyTests.newRealtime(options).client
+        defer { client.dispose(); client.close() }
+        let channel = client.channels.get(test.uniqueChannelName(), options: deltaPublisherChannelOptions(keyframeInterval: 100))
+
+        waitUntil(timeout: testTimeout) { done in
+            channel.attach { error in
+                XCTAssertNil(error)
+                done()
+            }
+        }
+        waitUntil(timeout: testTimeout) { done in
+            self.publishSequentially(channel, deltaPayloads[0 ..< 2], done: done)
+        }
+
+        waitUntil(timeout: testTimeout) { done in
+            channel.detach { error in
+                XCTAssertNil(error)
+                channel.attach { error in
+                    XCTAssertNil(error)
+                    done()
+                }
+            }
+        }
+        waitUntil(timeout: testTimeout) { done in
+            self.publishSequentially(channel, deltaPayloads[2 ..< 4], done: done)
+        }
+
+        guard let transport = client.internal.transport as? TestProxyTransport else {
+            fail("TestProxyTransport is not be assigned"); return
+        }
+        let published = transport.protocolMessagesSent.filter { $0.action == .message }.flatMap { $0.messages ?? [] }
+        XCTAssertEqual(published.count, 4)
+        let isDelta = published.map { $0.encoding?.contains("vcdiff") ?? false }
+        XCTAssertEqual(isDelta, [false, true, false, true])
+    }
+
+    // A page of history that holds deltas, together with the messages that they're relative to, is decoded in either direction.
+    func test__009__DeltaCodec__publishing__history_decodes_deltas_within_a_page() throws {
+        let test = Test()
+        let options = try AblyTests.commonAppSetup(for: test)
+        let client = AblyTests.newRealtime(options).client
+        defer { client.dispose(); client.close() }
+        let channel = client.channels.get(test.uniqueChannelName(), options: deltaPublisherChannelOptions(keyframeInterval: 4))
+
+        waitUntil(timeout: testTimeout) { done in
+            channel.attach { error in
+                XCTAssertNil(error)
+                done()
+            }
+        }
+        waitUntil(timeout: testTimeout) { done in
+            self.publishSequentially(channel, deltaPayloads[...], done: done)
+        }
+
+        for direction in [ARTQueryDirection.backwards, .forwards] {
+            let query = ARTRealtimeHistoryQuery()
+            query.direction = direction
+            var items: [ARTMessage] = []
+            expect {
+                try channel.history(query) { result, error in
+                    XCTAssertNil(error)
+                    items = result?.items ?? []
+                }
+            }.toNot(throwError())
+            expect(items).toEventually(haveCount(deltaPayloads.count), timeout: testTimeout)
+
+            let expected = direction == .backwards ? Array(deltaPayloads.reversed()) : deltaPayloads
+            XCTAssertEqual(items.map { $0.data as? String }, expected)
+            XCTAssertTrue(items.allSatisfy { $0.encoding == nil })
+        }
+    }
+
+    // Decodes two messages with ids into `encoder`, which leaves a base for each of them in its cache
+    private func decodeTwoBases(_ encoder: ARTDataEncoder) -> [Data] {
+        let payloads = (0 ..< 2).map { i in Data(String(repeating: "payload \(i) ", count: 30).utf8) }
+        let outputs = encoder.decodeBatch(payloads.map { $0.base64EncodedString() }, encodings: ["base64", "base64"], identifiers: ["m:0", "m:1"], deltaBaseIds: [NSNull(), NSNull()])
+        XCTAssertTrue(outputs.allSatisfy { $0.errorInfo == nil })
+        XCTAssertEqual(encoder.deltaBaseCache.count, 2)
+        return payloads
+    }
+
+    func test__010__DeltaCodec__decoding__a_delta_against_a_removed_base_fails() throws {
+        let encoder = ARTDataEncoder(cipherParams: nil, logger: InternalLog(core: MockInternalLogCore()), error: nil)
+        let payloads = decodeTwoBases(encoder)
+
+        encoder.removeAllDeltaBases()
+        XCTAssertEqual(encoder.deltaBaseCache.count, 0)
+
+        let target = Data(String(repeating: "payload 2 ", count: 30).utf8)
+        // Neither against the last message…
+        let againstLast = encoder.decode(ARTDeltaEncoder.vcdiff(fromSource: payloads[1], target: target).base64EncodedString(), identifier: "m:2", deltaBaseId: nil, encoding: "vcdiff/base64")
+        XCTAssertEqual(againstLast.errorInfo?.code, ARTErrorCode.unableToDecodeMessage.intValue)
+        // …nor against an earlier one
+        let againstEarlier = encoder.decode(ARTDeltaEncoder.vcdiff(fromSource: payloads[0], target: target).base64EncodedString(), identifier: "m:2", deltaBaseId: "m:0", encoding: "vcdiff/base64")
+        XCTAssertEqual(againstEarlier.errorInfo?.code, ARTErrorCode.unableToDecodeMessage.intValue)
+    }
+
+    func test__011__DeltaCodec__decoding__the_channel_forgets_its_delta_bases_when_its_messages_may_not_follow_on() throws {
+        let options = ARTClientOptions(key: "xxxx:xxxx")
+        options.autoConnect = false
+        let client = ARTRealtime(options: options)
+        defer { client.dispose(); client.close() }
+        let channelOptions = ARTRealtimeChannelOptions()
+        channelOptions.params = ["delta": "vcdiff"]
+        let channel = client.channels.get("test", options: channelOptions)
+
+        // On a change of cipher params
+        _ = decodeTwoBases(channel.internal.dataEncoder)
+        let cipherChannelOptions = ARTRealtimeChannelOptions(cipher: ["key": ARTCrypto.generateRandomKey()] as ARTCipherParamsCompatible)
+        cipherChannelOptions.params = ["delta": "vcdiff"]
+        channel.setOptions(cipherChannelOptions, callback: nil)
+        XCTAssertEqual(channel.internal.dataEncoder.deltaBaseCache.count, 0)
+
+        // On detach
+        _ = decodeTwoBases(channel.internal.dataEncoder)
+        let detached = ARTProtocolMessage()
+        detached.action = .detached
+        detached.channel = "test"
+        channel.internal.onChannelMessage(detached)
+        XCTAssertEqual(channel.internal.dataEncoder.deltaBaseCache.count, 0)
+
+        // On an attach that doesn't resume the channel, but not on one that does
+        _ = decodeTwoBases(channel.internal.dataEncoder)
+        let attached = ARTProtocolMessage()
+        attached.action = .attached
+        attached.channel = "test"
+        channel.internal.onChannelMessage(attached)
+        XCTAssertEqual(channel.internal.dataEncoder.deltaBaseCache.count, 0)
+
+        _ = decodeTwoBases(channel.internal.dataEncoder)
+        let resumed = ARTProtocolMessage()
+        resumed.action = .attached
+        resumed.channel = "test"
+        resumed.flags = Int64(ARTProtocolMessageFlag.resumed.rawValue)
+        channel.internal.onChannelMessage(resumed)
+        XCTAssertEqual(channel.internal.dataEncoder.deltaBaseCache.count, 2)
+
+        // On a delta that can't be decoded (RTL18)
+        let delta = ARTMessage(name: nil, data: Data("not a delta".utf8).base64EncodedString())
+        delta.id = "m:2"
+        delta.encoding = "vcdiff/base64"
+        delta.extras = ["delta": ["format": "vcdiff", "from": "m:unknown"]] as NSDictionary
+        let message = ARTProtocolMessage()
+        message.action = .message
+        message.channel = "test"
+        message.messages = [delta]
+        channel.internal.onChannelMessage(message)
+        XCTAssertEqual(channel.internal.dataEncoder.deltaBaseCache.count, 0)
+    }
 }
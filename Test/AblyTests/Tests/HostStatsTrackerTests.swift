@@ -0,0 +1,80 @@
+import XCTest
+import Ably.Private
+import Nimble
+
+class HostStatsTrackerTests: XCTestCase {
+    func test_rankHosts_ordersHostsByExpectedLatency() {
+        let tracker = ARTHostStatsTracker(failurePenalty: 10)
+        tracker.recordSuccess(forHost: "a.example.com", latency: 0.3)
+        tracker.recordSuccess(forHost: "b.example.com", latency: 0.1)
+        tracker.recordSuccess(forHost: "c.example.com", latency: 0.05)
+        tracker.recordFailure(forHost: "c.example.com")
+
+        // c is the fastest, but a 30% error rate costs it 3s of expected latency
+        XCTAssertEqual(tracker.rankHosts(["a.example.com", "b.example.com", "c.example.com"]), ["b.example.com", "a.example.com", "c.example.com"])
+    }
+
+    func test_rankHosts_keepsTheOrderOfHostsWithoutStatistics() {
+        let tracker = ARTHostStatsTracker(failurePenalty: 10)
+        let hosts = ["c.example.com", "a.example.com", "b.example.com"]
+
+        XCTAssertEqual(tracker.rankHosts(hosts), hosts)
+
+        // Unknown hosts are expected to perform like the average known host
+        tracker.recordSuccess(forHost: "x.example.com", latency: 0.1)
+        tracker.recordSuccess(forHost: "a.example.com", latency: 0.5)
+        XCTAssertEqual(tracker.rankHosts(hosts), ["c.example.com", "b.example.com", "a.example.com"])
+    }
+
+    func test_stats_useExponentiallyWeightedMovingAverages() throws {
+        let tracker = ARTHostStatsTracker(failurePenalty: 10)
+        tracker.recordSuccess(forHost: "a.example.com", latency: 1.0)
+        tracker.recordSuccess(forHost: "a.example.com", latency: 2.0)
+        tracker.recordFailure(forHost: "a.example.com")
+
+        let stats = try XCTUnwrap(tracker.stats(forHosts: ["a.example.com"]).first)
+        XCTAssertEqual(stats.host, "a.example.com")
+        XCTAssertEqual(stats.sampleCount, 3)
+        XCTAssertEqual(stats.averageLatency, 1.3, accuracy: 0.0001)
+        XCTAssertEqual(stats.errorRate, 0.3, accuracy: 0.0001)
+        XCTAssertEqual(stats.expectedLatency, 1.3 + 0.3 * 10, accuracy: 0.0001)
+    }
+
+    func test_fallback_popsTheFastestHostFirst() {
+        let tracker = ARTHostStatsTracker(failurePenalty: 10)
+        tracker.recordSuccess(forHost: "a.example.com", latency: 0.3)
+        tracker.recordSuccess(forHost: "b.example.com", latency: 0.1)
+        tracker.recordFailure(forHost: "c.example.com")
+
+        let fallback = ARTFallback(fallbackHosts: ["a.example.com", "b.example.com", "c.example.com"], shuffleArray: ARTFallback_shuffleArray, hostStatsTracker: tracker)
+        XCTAssertEqual(fallback?.popFallbackHost(), "b.example.com")
+        XCTAssertEqual(fallback?.popFallbackHost(), "a.example.com")
+        XCTAssertEqual(fallback?.popFallbackHost(), "c.example.com")
+        XCTAssertNil(fallback?.popFallbackHost())
+    }
+
+    func test_realtime_recordsTheConnectLatencyWithoutTheTimeSpentAuthorising() throws {
+        let test = Test()
+        let options = try AblyTests.commonAppSetup(for: test)
+        options.autoConnect = false
+        let timeProvider = MockTimeProvider()
+        options.testOptions.timeProvider = timeProvider
+        let tokenDetails = try getTestTokenDetails(for: test)
+        options.authCallback = { _, callback in
+            // Authorising takes 2s
+            timeProvider.advance(by: 2)
+            callback(tokenDetails, nil)
+        }
+        let client = ARTRealtime(options: options)
+        defer { client.dispose(); client.close() }
+
+        client.connect()
+        expect(client.connection.state).toEventually(equal(.connected), timeout: testTimeout)
+
+        let host = try XCTUnwrap(client.internal.transport?.host())
+        let stats = try XCTUnwrap(client.internal.rest.hostStatsTracker.stats(forHosts: [host]).first)
+        XCTAssertEqual(stats.sampleCount, 1)
+        // The clock only moved while authorising
+        XCTAssertEqual(stats.averageLatency, 0)
+    }
+}
@@ -2,6 +2,7 @@
 import Ably
 import Ably.Private
 import AblyTesting
+import Nimble
 import Security
 import XCTest
 
@@ -124,6 +125,103 @@ final class LocalDeviceStorageTests: XCTestCase {
         XCTAssertEqual(plist[ARTDeviceIdentityTokenKey] as? Data, Data("token-v1".utf8))
     }
 
+    // MARK: write-behind
+
+    // With write-behind, mutations made within the interval are held in memory
+    // (and readable) but only reach disk together, on `flush` at the latest.
+    func test_writeBehindCoalescesMutationsUntilFlushed() throws {
+        let storage = makeStorage()
+        storage.setObject("v0", forKey: ARTDeviceIdKey)
+        storage.enableWriteBehind(withInterval: 60, timeProvider: SystemTimeProvider())
+
+        storage.setObject("v1", forKey: ARTDeviceIdKey)
+        storage.setObject("secret-1", forKey: ARTDeviceSecretKey)
+        storage.setObject("client-1", forKey: ARTClientIdKey)
+        XCTAssertEqual(storage.object(forKey: ARTDeviceIdKey) as? String, "v1")
+
+        let fileURL = tempDirectory.appendingPathComponent("LocalDevice.plist")
+        let data = try Data(contentsOf: fileURL)
+        let plist = try XCTUnwrap(PropertyListSerialization.propertyList(from: data, options: [], format: nil) as? [String: Any])
+        XCTAssertEqual(plist[ARTDeviceIdKey] as? String, "v0")
+        XCTAssertNil(plist[ARTDeviceSecretKey])
+
+        storage.flush()
+
+        let reloaded = makeStorage()
+        XCTAssertEqual(reloaded.object(forKey: ARTDeviceIdKey) as? String, "v1")
+        XCTAssertEqual(reloaded.object(forKey: ARTDeviceSecretKey) as? String, "secret-1")
+        XCTAssertEqual(reloaded.object(forKey: ARTClientIdKey) as? String, "client-1")
+    }
+
+    func test_writeBehindWritesOnceTheIntervalElapses() {
+        let storage = makeStorage()
+        storage.enableWriteBehind(withInterval: 0.1, timeProvider: SystemTimeProvider())
+
+        storage.setObject("device-1", forKey: ARTDeviceIdKey)
+        storage.setObject("secret-1", forKey: ARTDeviceSecretKey)
+
+        expect(self.makeStorage().object(forKey: ARTDeviceSecretKey) as? String).toEventually(equal("secret-1"), timeout: testTimeout)
+        XCTAssertEqual(makeStorage().object(forKey: ARTDeviceIdKey) as? String, "device-1")
+    }
+
+    // MARK: crash consistency
+
+    // A write that is interrupted once the temporary file has been written but
+    // before it has replaced the file leaves every old value on disk.
+    func test_writeInterruptedBeforeTheRenameLeavesThePreviousValues() throws {
+        let storage = makeStorage()
+        storage.performBatchUpdate { writer in
+            writer.setObject("device-0", forKey: ARTDeviceIdKey)
+            writer.setObject("secret-0", forKey: ARTDeviceSecretKey)
+        }
+
+        var temporaryContents: [String: Any]?
+        storage.fileStorage.beforeReplacingFile = { temporaryFileURL in
+            let data = try! Data(contentsOf: temporaryFileURL)
+            temporaryContents = try! PropertyListSerialization.propertyList(from: data, options: [], format: nil) as? [String: Any]
+            return NSError(domain: "LocalDeviceStorageTests", code: 1)
+        }
+
+        storage.performBatchUpdate { writer in
+            writer.setObject("device-1", forKey: ARTDeviceIdKey)
+            writer.setObject("secret-1", forKey: ARTDeviceSecretKey)
+        }
+
+        // The new values had been written out in full…
+        XCTAssertEqual(temporaryContents?[ARTDeviceIdKey] as? String, "device-1")
+        XCTAssertEqual(temporaryContents?[ARTDeviceSecretKey] as? String, "secret-1")
+
+        // …but the file still holds the old ones, and nothing is left behind.
+        let reloaded = makeStorage()
+        XCTAssertEqual(reloaded.object(forKey: ARTDeviceIdKey) as? String, "device-0")
+        XCTAssertEqual(reloaded.object(forKey: ARTDeviceSecretKey) as? String, "secret-0")
+        XCTAssertFalse(FileManager.default.fileExists(atPath: storage.fileStorage.temporaryFileURL.path))
+
+        // Once writes succeed again, the new values reach the file together.
+        storage.fileStorage.beforeReplacingFile = nil
+        storage.flush()
+        let reloadedAfterFlush = makeStorage()
+        XCTAssertEqual(reloadedAfterFlush.object(forKey: ARTDeviceIdKey) as? String, "device-1")
+        XCTAssertEqual(reloadedAfterFlush.object(forKey: ARTDeviceSecretKey) as? String, "secret-1")
+    }
+
+    // A process killed while writing the temporary file leaves a partial file
+    // behind, which must neither be read nor get in the way of the next write.
+    func test_partialTemporaryFileLeftByACrashIsIgnored() throws {
+        let storage = makeStorage()
+        storage.setObject("device-0", forKey: ARTDeviceIdKey)
+
+        let newData = try PropertyListSerialization.data(fromPropertyList: [ARTDeviceIdKey: "device-1"], format: .binary, options: 0)
+        try newData.prefix(newData.count / 2).write(to: storage.fileStorage.temporaryFileURL)
+
+        let reloaded = makeStorage()
+        XCTAssertEqual(reloaded.object(forKey: ARTDeviceIdKey) as? String, "device-0")
+
+        reloaded.setObject("device-2", forKey: ARTDeviceIdKey)
+        XCTAssertEqual(makeStorage().object(forKey: ARTDeviceIdKey) as? String, "device-2")
+        XCTAssertFalse(FileManager.default.fileExists(atPath: storage.fileStorage.temporaryFileURL.path))
+    }
+
     // MARK: RSH3h ordering
 
     // RSH3h (the device is loaded *by* the state machine, not by the caller):
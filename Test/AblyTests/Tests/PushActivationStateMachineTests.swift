@@ -70,6 +70,151 @@ class PushActivationStateMachineTests: XCTestCase {
         expect(stateMachine.current).to(beAKindOf(ARTPushActivationStateAfterRegistrationSyncFailed.self))
     }
 
+    func test__101__Activation_state_machine__persisted_state_events_and_identity_token_round_trip_through_the_compact_format() throws {
+        let logger = InternalLog(core: MockInternalLogCore())
+        let identity = ARTDeviceIdentityTokenDetails(token: "123456", issued: Date(timeIntervalSince1970: 1_700_000_000.123), expires: Date(timeIntervalSince1970: 1_800_000_000), capability: "{\"*\":[\"*\"]}", clientId: nil)
+
+        let stateData = try XCTUnwrap(ARTPushPersistenceCodec.data(with: ARTPushActivationStateAfterRegistrationSyncFailed(machine: initialStateMachine, logger: logger)))
+        XCTAssertTrue(ARTPushPersistenceCodec.isEncodedData(stateData))
+        let state = ARTPushPersistenceCodec.state(with: stateData, machine: initialStateMachine, logger: logger)
+        expect(state).to(beAKindOf(ARTPushActivationStateAfterRegistrationSyncFailed.self))
+        XCTAssertTrue(state?.machine === initialStateMachine)
+
+        // Non-persistent states aren't encoded; the state machine archives them instead
+        XCTAssertNil(ARTPushPersistenceCodec.data(with: ARTPushActivationStateWaitingForDeviceRegistration(machine: initialStateMachine, logger: logger)))
+
+        let events: [ARTPushActivationEvent] = [
+            ARTPushActivationEventCalledActivate(),
+            ARTPushActivationEventSyncRegistrationFailed(error: ARTErrorInfo.create(withCode: 40100, status: 401, message: "unauthorized", requestId: "req-1")),
+            ARTPushActivationEventGotDeviceRegistration(identityTokenDetails: identity),
+            ARTPushActivationEventRegistrationSynced(identityTokenDetails: nil),
+        ]
+        let eventsData = try XCTUnwrap(ARTPushPersistenceCodec.data(withEvents: events))
+        let decodedEvents = try XCTUnwrap(ARTPushPersistenceCodec.events(with: eventsData, logger: logger))
+        XCTAssertEqual(decodedEvents.count, 4)
+        expect(decodedEvents[0]).to(beAKindOf(ARTPushActivationEventCalledActivate.self))
+        let errorEvent = try XCTUnwrap(decodedEvents[1] as? ARTPushActivationEventSyncRegistrationFailed)
+        XCTAssertEqual(errorEvent.error.code, 40100)
+        XCTAssertEqual(errorEvent.error.statusCode, 401)
+        XCTAssertEqual(errorEvent.error.message, "unauthorized")
+        XCTAssertEqual(errorEvent.error.requestId, "req-1")
+        let registrationEvent = try XCTUnwrap(decodedEvents[2] as? ARTPushActivationEventGotDeviceRegistration)
+        XCTAssertEqual(registrationEvent.identityTokenDetails?.token, "123456")
+        XCTAssertNil((decodedEvents[3] as? ARTPushActivationEventRegistrationSynced)?.identityTokenDetails)
+
+        let identityData = ARTPushPersistenceCodec.data(with: identity)
+        let decodedIdentity = try XCTUnwrap(ARTPushPersistenceCodec.identityTokenDetails(with: identityData, logger: logger))
+        XCTAssertEqual(decodedIdentity.token, identity.token)
+        XCTAssertEqual(decodedIdentity.issued, identity.issued)
+        XCTAssertEqual(decodedIdentity.expires, identity.expires)
+        XCTAssertEqual(decodedIdentity.capability, identity.capability)
+        XCTAssertNil(decodedIdentity.clientId)
+        XCTAssertLessThan(identityData.count, try XCTUnwrap(identity.art_archive(withLogger: nil)).count)
+
+        // Truncated data is rejected, not misread
+        XCTAssertNil(ARTPushPersistenceCodec.identityTokenDetails(with: identityData.prefix(identityData.count - 1), logger: logger))
+        XCTAssertNil(ARTPushPersistenceCodec.events(with: eventsData.prefix(eventsData.count - 1), logger: logger))
+    }
+
+    func test__102__Activation_state_machine__state_archived_by_an_older_version_is_persisted_again_in_the_compact_format() throws {
+        let storage = MockDeviceStorage(startWith: ARTPushActivationStateNotActivated(machine: initialStateMachine, logger: .init(core: MockInternalLogCore())))
+        rest.internal.storage = storage
+        let stateMachine = ARTPushActivationStateMachine(rest: rest.internal, delegate: StateMachineDelegate(), logger: .init(core: MockInternalLogCore()))
+        expect(stateMachine.current).to(beAKindOf(ARTPushActivationStateNotActivated.self))
+
+        stateMachine.send(ARTPushActivationEventCalledDeactivate())
+
+        expect(storage.keysWritten.keys).toEventually(contain(ARTPushActivationCompactCurrentStateKey), timeout: testTimeout)
+        let compactState = try XCTUnwrap(storage.keysWritten[ARTPushActivationCompactCurrentStateKey] as? Data)
+        XCTAssertTrue(ARTPushPersistenceCodec.isEncodedData(compactState))
+        let compactEvents = try XCTUnwrap(storage.keysWritten[ARTPushActivationCompactPendingEventsKey] as? Data)
+        XCTAssertTrue(ARTPushPersistenceCodec.isEncodedData(compactEvents))
+
+        // During the migration window, older versions can still read the archives under the keys that they use
+        let stateArchive = try XCTUnwrap(storage.keysWritten[ARTPushActivationCurrentStateKey] as? Data)
+        XCTAssertFalse(ARTPushPersistenceCodec.isEncodedData(stateArchive))
+        expect(ARTPushPersistenceCodec.state(with: stateArchive, machine: stateMachine, logger: nil)).to(beAKindOf(ARTPushActivationStateNotActivated.self))
+        let eventsArchive = try XCTUnwrap(storage.keysWritten[ARTPushActivationPendingEventsKey] as? Data)
+        XCTAssertFalse(ARTPushPersistenceCodec.isEncodedData(eventsArchive))
+    }
+
+    func test__103__Activation_state_machine__archives_are_persisted_alongside_the_compact_data_only_during_the_migration_window() throws {
+        let logger = InternalLog(core: MockInternalLogCore())
+        let state = ARTPushActivationStateAfterRegistrationSyncFailed(machine: initialStateMachine, logger: logger)
+        let compact = try XCTUnwrap(ARTPushPersistenceCodec.data(with: state))
+        let archive = try XCTUnwrap(state.art_archive(withLogger: nil))
+
+        // The first check starts the window
+        let newStorage = MockDeviceStorage()
+        XCTAssertTrue(ARTPushPersistenceCodec.writesLegacyArchives(to: newStorage))
+        let until = try XCTUnwrap(newStorage.keysWritten[ARTPushPersistenceLegacyArchivesUntilKey] as? Date)
+        XCTAssertEqual(until.timeIntervalSinceNow, 90 * 24 * 60 * 60, accuracy: 60)
+
+        let openStorage = MockDeviceStorage()
+        openStorage.simulateOnNextRead(object: Date.distantFuture, for: ARTPushPersistenceLegacyArchivesUntilKey)
+        XCTAssertTrue(ARTPushPersistenceCodec.writesLegacyArchives(to: openStorage))
+
+        let closedStorage = MockDeviceStorage()
+        closedStorage.simulateOnNextRead(object: Date.distantPast, for: ARTPushPersistenceLegacyArchivesUntilKey)
+        XCTAssertFalse(ARTPushPersistenceCodec.writesLegacyArchives(to: closedStorage))
+        XCTAssertNil(closedStorage.keysWritten[ARTPushPersistenceLegacyArchivesUntilKey] as? Date)
+
+        // Once it has closed, the archive is removed when the value is next persisted
+        ARTPushPersistenceCodec.setCompactData(compact, archive: nil, forKey: ARTPushActivationCompactCurrentStateKey, legacyKey: ARTPushActivationCurrentStateKey, storage: closedStorage)
+        XCTAssertEqual(closedStorage.keysWritten[ARTPushActivationCompactCurrentStateKey] as? Data, compact)
+        XCTAssertTrue(closedStorage.keysWritten.keys.contains(ARTPushActivationCurrentStateKey))
+        XCTAssertNil(closedStorage.keysWritten[ARTPushActivationCurrentStateKey] as? Data)
+
+        // The compact data is read in preference to the archive, which is then not read at all
+        let reader = MockDeviceStorage()
+        reader.simulateOnNextRead(data: archive, for: ARTPushActivationCurrentStateKey)
+        reader.simulateOnNextRead(data: compact, for: ARTPushActivationCompactCurrentStateKey)
+        XCTAssertEqual(ARTPushPersistenceCodec.data(forKey: ARTPushActivationCompactCurrentStateKey, legacyKey: ARTPushActivationCurrentStateKey, storage: reader), compact)
+        XCTAssertEqual(reader.keysRead, [ARTPushActivationCompactCurrentStateKey])
+
+        // Without compact data, as persisted by an older version, the archive is read
+        let olderVersionReader = MockDeviceStorage()
+        olderVersionReader.simulateOnNextRead(data: archive, for: ARTPushActivationCurrentStateKey)
+        XCTAssertEqual(ARTPushPersistenceCodec.data(forKey: ARTPushActivationCompactCurrentStateKey, legacyKey: ARTPushActivationCurrentStateKey, storage: olderVersionReader), archive)
+    }
+
+    // Benchmark; only run when benchmarking is enabled. Compares loading the persisted values from the compact format with unarchiving them.
+    func test__104__Activation_state_machine__loading_the_compact_format_is_faster_than_unarchiving() throws {
+        try XCTSkipUnless(isBenchmarkingEnabled, "Set ABLY_RUN_BENCHMARKS to run benchmarks")
+
+        let identity = ARTDeviceIdentityTokenDetails(token: "123456", issued: Date(), expires: Date(timeIntervalSinceNow: 3600), capability: "{\"*\":[\"*\"]}", clientId: "client")
+        let state = ARTPushActivationStateAfterRegistrationSyncFailed(machine: initialStateMachine, logger: .init(core: MockInternalLogCore()))
+        let events: [ARTPushActivationEvent] = [
+            ARTPushActivationEventCalledActivate(),
+            ARTPushActivationEventSyncRegistrationFailed(error: ARTErrorInfo.create(withCode: 40100, status: 401, message: "unauthorized", requestId: "req-1")),
+            ARTPushActivationEventGotDeviceRegistration(identityTokenDetails: identity),
+        ]
+        let compact = try (
+            state: XCTUnwrap(ARTPushPersistenceCodec.data(with: state)),
+            events: XCTUnwrap(ARTPushPersistenceCodec.data(withEvents: events)),
+            identity: ARTPushPersistenceCodec.data(with: identity)
+        )
+        let archived = try (
+            state: XCTUnwrap(state.art_archive(withLogger: nil)),
+            events: XCTUnwrap((events as NSArray).art_archive(withLogger: nil)),
+            identity: XCTUnwrap(identity.art_archive(withLogger: nil))
+        )
+
+        func secondsToLoad(_ data: (state: Data, events: Data, identity: Data)) -> TimeInterval {
+            let start = CFAbsoluteTimeGetCurrent()
+            for _ in 0 ..< 10_000 {
+                XCTAssertNotNil(ARTPushPersistenceCodec.state(with: data.state, machine: initialStateMachine, logger: nil))
+                XCTAssertEqual(ARTPushPersistenceCodec.events(with: data.events, logger: nil)?.count, events.count)
+                XCTAssertNotNil(ARTPushPersistenceCodec.identityTokenDetails(with: data.identity, logger: nil))
+            }
+            return CFAbsoluteTimeGetCurrent() - start
+        }
+
+        let archivedSeconds = secondsToLoad(archived)
+        let compactSeconds = secondsToLoad(compact)
+        XCTAssertLessThan(compactSeconds, archivedSeconds, "Loading 10000 times took \(compactSeconds)s from the compact format and \(archivedSeconds)s unarchiving")
+    }
+
     // RSH3a
 
     func beforeEach__Activation_state_machine__State_NotActivated() {
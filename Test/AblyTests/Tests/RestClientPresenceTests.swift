@@ -493,4 +493,53 @@ class RestClientPresenceTests: XCTestCase {
 
         XCTAssertEqual(decodeNumberOfCalls, 2)
     }
+
+    // RSC24
+
+    func test__RSC24__batchPresence__should_query_all_channels_in_a_single_request_and_report_partial_failures() throws {
+        let rest = ARTRest(key: "xxxx:xxxx")
+        let mockHTTPExecutor = MockHTTPExecutor()
+        rest.internal.httpExecutor = mockHTTPExecutor
+        mockHTTPExecutor.setSuccessResponse(
+            data: try JSONSerialization.data(withJSONObject: [
+                "successCount": 1,
+                "failureCount": 1,
+                "results": [
+                    ["channel": "foo", "presence": [["clientId": "john", "action": 1, "data": "online"]]],
+                    ["channel": "bar", "error": ["code": 40160, "statusCode": 401, "message": "Not permitted"]],
+                ],
+            ], options: []),
+            contentType: "application/json"
+        )
+
+        waitUntil(timeout: testTimeout) { done in
+            expect {
+                try rest.batchPresence(["foo", "bar"]) { result, error in
+                    XCTAssertNil(error)
+                    guard let result else {
+                        fail("Result is nil"); done(); return
+                    }
+                    XCTAssertEqual(result.successCount, 1)
+                    XCTAssertEqual(result.failureCount, 1)
+                    XCTAssertEqual(result.successes.first?.channel, "foo")
+                    XCTAssertEqual(result.successes.first?.presence.first?.clientId, "john")
+                    XCTAssertEqual(result.successes.first?.presence.first?.data as? String, "online")
+                    XCTAssertEqual(result.failures.first?.channel, "bar")
+                    XCTAssertEqual(result.failures.first?.error.code, 40160)
+                    done()
+                }
+            }.toNot(throwError())
+        }
+
+        XCTAssertEqual(mockHTTPExecutor.requests.count, 1)
+        let url = try XCTUnwrap(mockHTTPExecutor.requests.first?.url)
+        XCTAssertEqual(url.path, "/presence")
+        let components = try XCTUnwrap(URLComponents(url: url, resolvingAgainstBaseURL: false))
+        XCTAssertEqual(components.queryItems?.first { $0.name == "channels" }?.value, "foo,bar")
+    }
+
+    func test__RSC24__batchPresence__should_require_at_least_one_channel() {
+        let rest = ARTRest(key: "xxxx:xxxx")
+        expect { try rest.batchPresence([], callback: { _, _ in }) }.to(throwError())
+    }
 }
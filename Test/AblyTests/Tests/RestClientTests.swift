@@ -2192,4 +2192,275 @@ class RestClientTests: XCTestCase {
             }
         }
     }
+
+    func test__098__RestClient__prewarmConnections__should_send_a_request_to_the_rest_host_and_to_every_fallback_host() {
+        let options = ARTClientOptions(key: "xxxx:xxxx")
+        options.fallbackHosts = _fallbackHosts
+
+        let rest = ARTRest(options: options)
+        let mockHttpExecutor = MockHTTPExecutor()
+        rest.internal.httpExecutor = mockHttpExecutor
+
+        waitUntil(timeout: testTimeout) { done in
+            rest.prewarmConnections { error in
+                XCTAssertNil(error)
+                done()
+            }
+        }
+
+        XCTAssertEqual(mockHttpExecutor.requests.compactMap { $0.url?.host }, [options.restHost] + _fallbackHosts)
+        XCTAssertTrue(mockHttpExecutor.requests.allSatisfy { $0.url?.path == "/time" && $0.httpMethod == "GET" })
+        XCTAssertTrue(mockHttpExecutor.requests.allSatisfy { $0.value(forHTTPHeaderField: "Authorization") == nil })
+    }
+
+    func test__099__RestClient__prewarmConnections__should_report_an_error_only_if_the_rest_host_is_unreachable() {
+        let options = ARTClientOptions(key: "xxxx:xxxx")
+        options.fallbackHosts = _fallbackHosts
+
+        let rest = ARTRest(options: options)
+        let mockHttpExecutor = MockHTTPExecutor()
+        rest.internal.httpExecutor = mockHttpExecutor
+        mockHttpExecutor.simulateIncomingErrorOnNextRequest(NSError(domain: NSURLErrorDomain, code: NSURLErrorCannotConnectToHost, userInfo: nil))
+
+        waitUntil(timeout: testTimeout) { done in
+            rest.prewarmConnections { error in
+                XCTAssertEqual(error?.code, NSURLErrorCannotConnectToHost)
+                done()
+            }
+        }
+
+        XCTAssertEqual(mockHttpExecutor.requests.count, _fallbackHosts.count + 1)
+    }
+
+    func test__100__RestClient__Host_Fallback__hedged_requests__should_send_the_same_request_to_a_fallback_host_when_the_primary_host_is_slow() throws {
+        let options = ARTClientOptions(key: "xxxx:xxxx")
+        options.fallbackHosts = _fallbackHosts
+        options.addRequestIds = true
+        options.httpHedgingDelay = 0.1
+
+        let client = ARTRest(options: options)
+        let internalLog = InternalLog(clientOptions: options)
+        let mockHTTP = MockHTTP(logger: internalLog)
+        testHTTPExecutor = TestProxyHTTPExecutor(http: mockHTTP, logger: internalLog)
+        client.internal.httpExecutor = testHTTPExecutor
+        mockHTTP.setSuccessResponse(data: try JSONSerialization.data(withJSONObject: [1700000000000]), contentType: "application/json")
+        mockHTTP.setNetworkState(network: .requestTimeout(timeout: 2.0), forHost: options.restHost)
+
+        waitUntil(timeout: .seconds(1)) { done in
+            client.time { time, error in
+                XCTAssertNil(error)
+                XCTAssertNotNil(time)
+                done()
+            }
+        }
+
+        XCTAssertEqual(testHTTPExecutor.requests.count, 2)
+        let hosts = testHTTPExecutor.requests.compactMap { $0.url?.host }
+        XCTAssertEqual(hosts.first, options.restHost)
+        XCTAssertTrue(_fallbackHosts.contains(hosts.last!))
+
+        let requestIds = testHTTPExecutor.requests.map { extractURLQueryValue($0.url, key: "request_id") }
+        XCTAssertNotNil(requestIds.first!)
+        XCTAssertEqual(requestIds.first, requestIds.last)
+
+        // The fallback host that answered first is preferred from now on
+        XCTAssertEqual(client.internal.prioritizedHost, hosts.last)
+    }
+
+    func test__101__RestClient__Host_Fallback__hedged_requests__should_not_hedge_non_idempotent_requests_without_request_IDs() {
+        let test = Test()
+        let options = ARTClientOptions(key: "xxxx:xxxx")
+        options.fallbackHosts = _fallbackHosts
+        options.httpHedgingDelay = 0.1
+
+        let client = ARTRest(options: options)
+        let internalLog = InternalLog(clientOptions: options)
+        let mockHTTP = MockHTTP(logger: internalLog)
+        testHTTPExecutor = TestProxyHTTPExecutor(http: mockHTTP, logger: internalLog)
+        client.internal.httpExecutor = testHTTPExecutor
+        mockHTTP.setNetworkState(network: .requestTimeout(timeout: 0.5), forHost: options.restHost)
+
+        waitUntil(timeout: testTimeout) { done in
+            client.channels.get(test.uniqueChannelName()).publish(nil, data: "something") { _ in
+                done()
+            }
+        }
+
+        // Sequential fallback only starts once the primary host has timed out
+        XCTAssertEqual(testHTTPExecutor.requests.first?.url?.host, options.restHost)
+        XCTAssertEqual(testHTTPExecutor.requests.count, 2)
+    }
+
+    func test__102__RestClient__Host_Fallback__hedged_requests__cancelling_should_cancel_the_request_resent_after_a_token_renewal() throws {
+        ARTHttp.setURLSessionClass(MockURLSession.self)
+        defer { ARTHttp.setURLSessionClass(ARTURLSessionServerTrust.self) }
+
+        let options = ARTClientOptions()
+        options.fallbackHosts = _fallbackHosts
+        options.httpHedgingDelay = 60
+        var tokenCount = 0
+        options.authCallback = { _, completion in
+            tokenCount += 1
+            completion(ARTTokenDetails(token: "token-\(tokenCount)"), nil)
+        }
+
+        let rest = ARTRest(options: options)
+        let session = try XCTUnwrap(MockURLSession.last)
+        let queue = rest.internal.queue
+        let sentTasks = { queue.sync { session.tasks } }
+
+        var callbackCount = 0
+        let request = NSMutableURLRequest(url: URL(string: "/time")!)
+        request.httpMethod = "GET"
+        let hedgedRequest = queue.sync {
+            rest.internal.execute(request, withAuthOption: .on, wrapperSDKAgents: nil) { _, _, _ in
+                callbackCount += 1
+            }
+        }
+        expect(sentTasks().count).toEventually(equal(1), timeout: testTimeout)
+
+        // The token is rejected, so the request is resent with a new one
+        let tokenError = ErrorSimulator(value: ARTErrorCode.tokenExpired.intValue, description: "token expired", statusCode: 401, shouldPerformRequest: false)
+        queue.sync {
+            let firstTask = session.tasks[0]
+            session.complete(firstTask, response: tokenError.stubResponse(firstTask.request.url!), data: tokenError.stubData)
+        }
+        expect(sentTasks().count).toEventually(equal(2), timeout: testTimeout)
+
+        let tasks = sentTasks()
+        XCTAssertEqual(tasks[1].request.url?.host, tasks[0].request.url?.host)
+        XCTAssertNotEqual(tasks[1].request.value(forHTTPHeaderField: "Authorization"), tasks[0].request.value(forHTTPHeaderField: "Authorization"))
+        XCTAssertEqual(callbackCount, 0)
+
+        hedgedRequest?.cancel()
+
+        // The resent request belongs to the hedged request, so it's cancelled along with it
+        expect(queue.sync { tasks[1].isCancelled }).toEventually(beTrue(), timeout: testTimeout)
+        XCTAssertEqual(sentTasks().count, 2)
+    }
+
+    func test__103__RestClient__maxConcurrentHTTPRequests__should_queue_requests_beyond_the_cap_and_start_them_in_order() throws {
+        ARTHttp.setURLSessionClass(MockURLSession.self)
+        defer { ARTHttp.setURLSessionClass(ARTURLSessionServerTrust.self) }
+
+        let options = ARTClientOptions(key: "xxxx:xxxx")
+        options.maxConcurrentHTTPRequests = 2
+        let queue = DispatchQueue(label: "io.ably.tests.maxConcurrentHTTPRequests")
+        let http = ARTHttp(queue: queue, options: options, logger: InternalLog(core: MockInternalLogCore()))
+        let session = try XCTUnwrap(MockURLSession.last)
+
+        var completedPaths: [String] = []
+        queue.sync {
+            for index in 0 ..< 5 {
+                let request = URLRequest(url: URL(string: "https://example.com/\(index)")!)
+                _ = http.execute(request) { _, _, error in
+                    XCTAssertNil(error)
+                    completedPaths.append(request.url!.path)
+                }
+            }
+
+            XCTAssertEqual(session.tasks.map(\.request.url!.path), ["/0", "/1"])
+            XCTAssertEqual(http.inFlightRequestCount, 2)
+            XCTAssertEqual(http.pendingRequestCount, 3)
+
+            // Each completion frees a slot for the longest-queued request
+            session.complete(session.tasks[1])
+            XCTAssertEqual(session.tasks.map(\.request.url!.path), ["/0", "/1", "/2"])
+            session.complete(session.tasks[0])
+            session.complete(session.tasks[2])
+            XCTAssertEqual(session.tasks.map(\.request.url!.path), ["/0", "/1", "/2", "/3", "/4"])
+            XCTAssertEqual(http.inFlightRequestCount, 2)
+            XCTAssertEqual(http.pendingRequestCount, 0)
+
+            session.complete(session.tasks[3])
+            session.complete(session.tasks[4])
+            XCTAssertEqual(http.inFlightRequestCount, 0)
+        }
+
+        XCTAssertEqual(completedPaths, ["/1", "/0", "/2", "/3", "/4"])
+    }
+
+    func test__104__RestClient__maxConcurrentHTTPRequests__cancelling_a_queued_request_should_remove_it_from_the_queue() throws {
+        ARTHttp.setURLSessionClass(MockURLSession.self)
+        defer { ARTHttp.setURLSessionClass(ARTURLSessionServerTrust.self) }
+
+        let options = ARTClientOptions(key: "xxxx:xxxx")
+        options.maxConcurrentHTTPRequests = 1
+        let queue = DispatchQueue(label: "io.ably.tests.maxConcurrentHTTPRequests")
+        let http = ARTHttp(queue: queue, options: options, logger: InternalLog(core: MockInternalLogCore()))
+        let session = try XCTUnwrap(MockURLSession.last)
+
+        var errors: [String: Error] = [:]
+        var cancellables: [ARTCancellable] = []
+        queue.sync {
+            for index in 0 ..< 3 {
+                let request = URLRequest(url: URL(string: "https://example.com/\(index)")!)
+                let cancellable = http.execute(request) { _, _, error in
+                    errors[request.url!.path] = error
+                }
+                cancellables.append(cancellable!)
+            }
+        }
+
+        // Cancelling is asynchronous, on the http's queue
+        cancellables[1].cancel()
+        queue.sync {
+            XCTAssertEqual(http.pendingRequestCount, 1)
+            XCTAssertEqual((errors["/1"] as? NSError)?.code, NSURLErrorCancelled)
+
+            // The cancelled request is never started
+            session.complete(session.tasks[0])
+            XCTAssertEqual(session.tasks.map(\.request.url!.path), ["/0", "/2"])
+        }
+
+        // Cancelling a started request cancels its task
+        cancellables[2].cancel()
+        queue.sync {
+            XCTAssertTrue(session.tasks[1].isCancelled)
+            XCTAssertFalse(session.tasks[0].isCancelled)
+        }
+    }
+
+    func test__105__RestClient__sharesHTTPSession__clients_should_share_one_session_which_is_invalidated_once_the_last_of_them_is_done_with_it() {
+        let queue = DispatchQueue(label: "io.ably.tests.sharesHTTPSession")
+        XCTAssertEqual(ARTURLSessionServerTrust.sharedSessionBorrowerCount, 0)
+
+        let first = ARTURLSessionServerTrust(queue, sharingSession: true)
+        let second = ARTURLSessionServerTrust(queue, sharingSession: true)
+        let unshared = ARTURLSessionServerTrust(queue)
+        defer { unshared.finishTasksAndInvalidate() }
+        XCTAssertIdentical(first.session, second.session)
+        XCTAssertNotIdentical(unshared.session, first.session)
+        XCTAssertIdentical(first.connectionMetrics, second.connectionMetrics)
+        XCTAssertEqual(ARTURLSessionServerTrust.sharedSessionBorrowerCount, 2)
+
+        // Giving up the session twice counts once
+        first.finishTasksAndInvalidate()
+        first.finishTasksAndInvalidate()
+        XCTAssertEqual(ARTURLSessionServerTrust.sharedSessionBorrowerCount, 1)
+        let third = ARTURLSessionServerTrust(queue, sharingSession: true)
+        XCTAssertIdentical(third.session, second.session)
+
+        second.finishTasksAndInvalidate()
+        third.finishTasksAndInvalidate()
+        XCTAssertEqual(ARTURLSessionServerTrust.sharedSessionBorrowerCount, 0)
+
+        // The invalidated session is replaced by a new one
+        let fourth = ARTURLSessionServerTrust(queue, sharingSession: true)
+        defer { fourth.finishTasksAndInvalidate() }
+        XCTAssertNotIdentical(fourth.session, second.session)
+    }
+
+    func test__106__RestClient__sharesHTTPSession__releasing_the_last_client_should_give_up_the_shared_session() {
+        XCTAssertEqual(ARTURLSessionServerTrust.sharedSessionBorrowerCount, 0)
+
+        let options = ARTClientOptions(key: "xxxx:xxxx")
+        options.sharesHTTPSession = true
+        autoreleasepool {
+            let http = ARTHttp(queue: AblyTests.queue, options: options, logger: InternalLog(core: MockInternalLogCore()))
+            XCTAssertEqual(ARTURLSessionServerTrust.sharedSessionBorrowerCount, 1)
+            withExtendedLifetime(http) {}
+        }
+        XCTAssertEqual(ARTURLSessionServerTrust.sharedSessionBorrowerCount, 0)
+    }
 }
@@ -1,4 +1,5 @@
 import Ably
+import Ably.Private
 import Nimble
 import XCTest
 
@@ -6,6 +7,28 @@ private let links = "<./messages?start=0&end=1535035746063&limit=100&direction=b
 
 private let url = URL(string: "https://sandbox-rest.ably.io:443/channels/foo/messages?limit=100&direction=backwards")!
 
+/// Serves `pageCount` pages of channel history with one message each, linking every page to the following one.
+private class PagingHTTPExecutor: NSObject, ARTHTTPExecutor {
+    let pageCount: Int
+    private(set) var requests: [URLRequest] = []
+
+    init(pageCount: Int) {
+        self.pageCount = pageCount
+    }
+
+    func execute(_ request: URLRequest, completion callback: ((HTTPURLResponse?, Data?, Error?) -> Void)? = nil) -> (ARTCancellable & NSObjectProtocol)? {
+        requests.append(request)
+        let page = extractURLQueryValue(request.url, key: "page").flatMap { Int($0) } ?? 1
+        var headerFields = ["Content-Type": "application/json"]
+        if page < pageCount {
+            headerFields["Link"] = "<./messages?page=\(page + 1)>; rel=\"next\""
+        }
+        let body = try! JSONSerialization.data(withJSONObject: [["name": "page \(page)", "data": "x"]])
+        callback?(HTTPURLResponse(url: request.url!, statusCode: 200, httpVersion: nil, headerFields: headerFields), body, nil)
+        return nil
+    }
+}
+
 class RestPaginatedTests: XCTestCase {
     // XCTest invokes this method before executing the first test in the test suite. We use it to ensure that the global variables are initialized at the same moment, and in the same order, as they would have been when we used the Quick testing framework.
     override class var defaultTestSuite: XCTestSuite {
@@ -46,4 +69,39 @@ class RestPaginatedTests: XCTestCase {
 
         XCTAssertEqual(firstRequest.url?.absoluteString, "https://sandbox-rest.ably.io:443/channels/foo/messages?start=0&end=1535035746063&limit=100&direction=backwards&format=msgpack&firstEnd=1535035746063&fromDate=1535035746063&mode=all")
     }
+
+    func test__003__RestPaginated__iterator__should_return_every_page_in_order_while_prefetching_a_bounded_number_of_pages() {
+        let rest = ARTRest(key: "xxxx:xxxx")
+        let pager = PagingHTTPExecutor(pageCount: 5)
+        rest.internal.httpExecutor = pager
+        let channel = rest.channels.get("foo")
+
+        var names: [String] = []
+        waitUntil(timeout: testTimeout) { done in
+            channel.history { result, error in
+                guard let result else {
+                    fail("unexpected error \(String(describing: error))"); done(); return
+                }
+                let iterator = result.iterator(withPrefetchDepth: 2)
+                XCTAssertEqual(iterator.prefetchDepth, 2)
+
+                func consume() {
+                    iterator.next { page, error in
+                        XCTAssertNil(error)
+                        guard let page else {
+                            done(); return
+                        }
+                        // The history request, plus at most `prefetchDepth` pages fetched ahead of the one being consumed
+                        XCTAssertLessThanOrEqual(pager.requests.count, names.count + 1 + 2)
+                        names += page.items.compactMap { $0.name }
+                        consume()
+                    }
+                }
+                consume()
+            }
+        }
+
+        XCTAssertEqual(names, ["page 1", "page 2", "page 3", "page 4", "page 5"])
+        XCTAssertEqual(pager.requests.count, 5)
+    }
 }
@@ -28,6 +28,16 @@ class SystemTimeProviderTests: XCTestCase {
         XCTAssertTrue(advancedByOneSecond.isAfter(postSleepNow))
     }
 
+    func test_continuousClock_timeIntervalSince() {
+        let provider = SystemTimeProvider()
+
+        let now = provider.continuousClockNow()
+        let later = now.addingDuration(1.5)
+
+        XCTAssertEqual(later.timeIntervalSince(now), 1.5, accuracy: 0.001)
+        XCTAssertEqual(now.timeIntervalSince(later), -1.5, accuracy: 0.001)
+    }
+
     func test_schedule_derefsBlockAfterInvoke() {
         let invokedExpectation = self.expectation(description: "scheduled block invoked")
 
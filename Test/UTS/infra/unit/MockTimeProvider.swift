@@ -73,6 +73,11 @@ final class MockTimeProvider: NSObject, TimeProvider, @unchecked Sendable {
         func addingDuration(_ duration: TimeInterval) -> ContinuousClockInstant {
             Instant(nanoseconds: nanoseconds + UInt64(max(0, duration) * 1_000_000_000))
         }
+
+        func timeIntervalSince(_ other: ContinuousClockInstant) -> TimeInterval {
+            guard let other = other as? Instant else { return 0 }
+            return (Double(nanoseconds) - Double(other.nanoseconds)) / 1_000_000_000
+        }
     }
 
     private var scheduledBlocks: [ScheduledBlock] = []
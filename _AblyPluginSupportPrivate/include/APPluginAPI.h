@@ -115,6 +115,15 @@ NS_SWIFT_SENDABLE
 /// `ObjectSubscribe`/`ObjectPublish` bits are reported. Used by the RTO2a2/RTO2b2 channel-mode guards.
 - (APChannelMode)nosync_objectChannelModesForChannel:(id<APRealtimeChannel>)channel;
 
+/// Whether the channel's options have cipher params, i.e. whether its messages are encrypted.
+- (BOOL)nosync_isEncryptedChannel:(id<APRealtimeChannel>)channel;
+
+/// The ID of the Ably app that the client uses, taken from its key or token, or `nil` if it doesn't know it yet (for example, before it has obtained its first token from an `authCallback`).
+- (nullable NSString *)nosync_appIdForClient:(id<APRealtimeClient>)client;
+
+/// The client's `clientId`, from its options or its token, or `nil` if it has none.
+- (nullable NSString *)nosync_clientIdForClient:(id<APRealtimeClient>)client;
+
 /// The error that makes the client's connection unpublishable, or `nil` if the connection is in a
 /// state from which messages can be published. When not active, returns the connection's current error
 /// reason if it has one. Spec: RTO15b (the publish adheres to the RTL6c connection-state conditions).